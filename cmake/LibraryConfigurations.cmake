@@ -96,6 +96,21 @@ elseif ("${PLATFORM}" MATCHES "SDL")
     set(PLATFORM_CPP "PLATFORM_DESKTOP_SDL")
     set(LIBS_PRIVATE SDL2::SDL2)
 
+elseif ("${PLATFORM}" MATCHES "Headless")
+    set(PLATFORM_CPP "PLATFORM_HEADLESS")
+
+    add_definitions(-D_DEFAULT_SOURCE)
+    add_definitions(-DEGL_NO_X11)
+
+    find_library(EGL EGL)
+    if ("${GRAPHICS}" STREQUAL "GRAPHICS_API_OPENGL_ES2" OR "${OPENGL_VERSION}" MATCHES "ES 2.0")
+        find_library(GLESV2 GLESv2)
+        set(LIBS_PRIVATE ${GLESV2} ${EGL} atomic pthread m dl)
+    else ()
+        find_library(OPENGL_GL GL)
+        set(LIBS_PRIVATE ${OPENGL_GL} ${EGL} atomic pthread m dl)
+    endif ()
+
 endif ()
 
 if (NOT ${OPENGL_VERSION} MATCHES "OFF")
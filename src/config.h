@@ -103,7 +103,8 @@
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
-#define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture())
+#define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture(), multi-texture draws)
+#define RL_DEFAULT_BATCH_VERTEX_LAYOUT         0      // Default batch vertex layout: 0-Separate arrays (4 VBOs), 1-Interleaved (1 VBO, 1 upload per flush), 2-Interleaved streaming (fenced ring buffer, requires 2+ batch buffers)
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal RaylibMatrix stack
 
@@ -119,6 +120,7 @@
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR     3
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT   4
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2 5
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT   6
 
 // Default shader vertex attribute names to set location points
 // NOTE: When a new shader is loaded, the following locations are tried to be set for convenience
@@ -128,6 +130,7 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -10,6 +10,9 @@
 *     Note that some file formats (DDS, PVR, KTX) also support uncompressed data storage.
 *     In those cases data is loaded uncompressed and format is returned.
 *
+*     Image data can also be saved as DDS (DXT1/DXT3/DXT5/BC4/BC5 or uncompressed RGB/RGBA)
+*     and KTX files, including all available mipmap levels.
+*
 *   TODO:
 *     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx_to_memory()
 *     - Review rl_load_ktx_from_memory() to support KTX v2.2 specs
@@ -67,6 +70,7 @@ RAYLIB_RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsig
 RAYLIB_RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
 RAYLIB_RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+RAYLIB_RLAPI int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps);     // Save image data as DDS file
 
 #if defined(__cplusplus)
 }
@@ -118,10 +122,16 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
     // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
     // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
     // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+    // GL_COMPRESSED_RED_RGTC1              0x8DBB (BC4, OpenGL 3.0)
+    // GL_COMPRESSED_RG_RGTC2               0x8DBD (BC5, OpenGL 3.0)
 
     #define RAYLIB_FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
     #define RAYLIB_FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
     #define RAYLIB_FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
+    #define RAYLIB_FOURCC_ATI1 0x31495441  // Equivalent to "ATI1" in ASCII
+    #define RAYLIB_FOURCC_ATI2 0x32495441  // Equivalent to "ATI2" in ASCII
+    #define RAYLIB_FOURCC_BC4U 0x55344342  // Equivalent to "BC4U" in ASCII
+    #define RAYLIB_FOURCC_BC5U 0x55354342  // Equivalent to "BC5U" in ASCII
 
     // DDS Pixel Format
     typedef struct {
@@ -278,6 +288,10 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                     } break;
                     case RAYLIB_FOURCC_DXT3: *format = RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
                     case RAYLIB_FOURCC_DXT5: *format = RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+                    case RAYLIB_FOURCC_ATI1:
+                    case RAYLIB_FOURCC_BC4U: *format = RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R; break;
+                    case RAYLIB_FOURCC_ATI2:
+                    case RAYLIB_FOURCC_BC5U: *format = RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG; break;
                     default: break;
                 }
             }
@@ -286,6 +300,157 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
 
     return image_data;
 }
+
+// Save image data as DDS file
+// NOTE: Supported formats: DXT1, DXT3, DXT5, BC4 (ATI1), BC5 (ATI2) and uncompressed R8G8B8/R8G8B8A8,
+// all provided mipmap levels are saved
+int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps)
+{
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourcc;
+        unsigned int rgb_bit_count;
+        unsigned int r_bit_mask;
+        unsigned int g_bit_mask;
+        unsigned int b_bit_mask;
+        unsigned int a_bit_mask;
+    } dds_pixel_format;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitch_or_linear_size;
+        unsigned int depth;
+        unsigned int mipmap_count;
+        unsigned int reserved1[11];
+        dds_pixel_format ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } dds_header;
+
+    dds_header header = { 0 };
+    header.size = sizeof(dds_header);
+    header.flags = 0x1 | 0x2 | 0x4 | 0x1000;    // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+    header.height = height;
+    header.width = width;
+    header.mipmap_count = (mipmaps > 1)? mipmaps : 0;
+    header.ddspf.size = sizeof(dds_pixel_format);
+    header.caps = 0x1000;                       // DDSCAPS_TEXTURE
+
+    if (mipmaps > 1)
+    {
+        header.flags |= 0x20000;                // DDSD_MIPMAPCOUNT
+        header.caps |= (0x8 | 0x400000);        // DDSCAPS_COMPLEX | DDSCAPS_MIPMAP
+    }
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB: header.ddspf.flags = 0x04; header.ddspf.fourcc = RAYLIB_FOURCC_DXT1; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.ddspf.flags = 0x05; header.ddspf.fourcc = RAYLIB_FOURCC_DXT1; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.ddspf.flags = 0x05; header.ddspf.fourcc = RAYLIB_FOURCC_DXT3; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.ddspf.flags = 0x05; header.ddspf.fourcc = RAYLIB_FOURCC_DXT5; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R: header.ddspf.flags = 0x04; header.ddspf.fourcc = RAYLIB_FOURCC_ATI1; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG: header.ddspf.flags = 0x04; header.ddspf.fourcc = RAYLIB_FOURCC_ATI2; break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            // NOTE: Channel masks describe the R8G8B8 byte order, data is saved as is
+            header.ddspf.flags = 0x40;          // DDPF_RGB
+            header.ddspf.rgb_bit_count = 24;
+            header.ddspf.r_bit_mask = 0x000000ff;
+            header.ddspf.g_bit_mask = 0x0000ff00;
+            header.ddspf.b_bit_mask = 0x00ff0000;
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            // NOTE: Data is reordered to B8G8R8A8 on saving, the common DirectX layout
+            header.ddspf.flags = 0x41;          // DDPF_RGB | DDPF_ALPHAPIXELS
+            header.ddspf.rgb_bit_count = 32;
+            header.ddspf.r_bit_mask = 0x00ff0000;
+            header.ddspf.g_bit_mask = 0x0000ff00;
+            header.ddspf.b_bit_mask = 0x000000ff;
+            header.ddspf.a_bit_mask = 0xff000000;
+        } break;
+        default:
+        {
+            RAYLIB_LOG("WARNING: IMAGE: Pixel format not supported for DDS export (%i)", format);
+            return false;
+        }
+    }
+
+    if (header.ddspf.fourcc != 0)
+    {
+        header.flags |= 0x80000;                // DDSD_LINEARSIZE
+        header.pitch_or_linear_size = get_pixel_data_size(width, height, format);
+    }
+    else
+    {
+        header.flags |= 0x8;                    // DDSD_PITCH
+        header.pitch_or_linear_size = width*header.ddspf.rgb_bit_count/8;
+    }
+
+    // Calculate file data_size required
+    int data_size = 4 + sizeof(dds_header);
+    int image_data_size = 0;
+
+    for (int i = 0, w = width, h = height; i < ((mipmaps > 1)? mipmaps : 1); i++)
+    {
+        image_data_size += get_pixel_data_size(w, h, format);
+        if (w > 1) w /= 2;
+        if (h > 1) h /= 2;
+    }
+
+    data_size += image_data_size;
+
+    unsigned char *file_data = RL_CALLOC(data_size, 1);
+    unsigned char *file_data_ptr = file_data;
+
+    memcpy(file_data_ptr, "DDS ", 4);
+    memcpy(file_data_ptr + 4, &header, sizeof(dds_header));
+    file_data_ptr += (4 + sizeof(dds_header));
+
+    memcpy(file_data_ptr, data, image_data_size);
+
+    if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // Reorder R8G8B8A8 to B8G8R8A8
+        for (int i = 0; i < image_data_size; i += 4)
+        {
+            unsigned char red = file_data_ptr[i];
+            file_data_ptr[i] = file_data_ptr[i + 2];
+            file_data_ptr[i + 2] = red;
+        }
+    }
+
+    // Save file data to file
+    int success = false;
+    FILE *file = fopen(file_name, "wb");
+
+    if (file != NULL)
+    {
+        unsigned int count = (unsigned int)fwrite(file_data, sizeof(unsigned char), data_size, file);
+
+        if (count == 0) RAYLIB_LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
+        else if (count != data_size) RAYLIB_LOG("WARNING: FILEIO: [%s] File partially written", file_name);
+        else RAYLIB_LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
+
+        int result = fclose(file);
+        if ((result == 0) && (count == data_size)) success = true;
+    }
+    else RAYLIB_LOG("WARNING: FILEIO: [%s] Failed to open file", file_name);
+
+    RL_FREE(file_data);    // Free file data buffer
+
+    // If all data has been written correctly to file, success = 1
+    return success;
+}
 #endif
 
 #if defined(RL_GPUTEX_SUPPORT_PKM)
@@ -791,11 +956,13 @@ static int get_pixel_data_size(int width, int height, int format)
         case RAYLIB_PIXELFORMAT_COMPRESSED_ETC1_RGB:
         case RAYLIB_PIXELFORMAT_COMPRESSED_ETC2_RGB:
         case RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA:
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R: bpp = 4; break;
         case RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
         case RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
         case RAYLIB_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG: bpp = 8; break;
         case RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
         default: break;
     }
@@ -803,11 +970,17 @@ static int get_pixel_data_size(int width, int height, int format)
     data_size = width*height*bpp/8;  // Total data size in bytes
 
     // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // data size is rounded up to full blocks (8 or 16 bytes per block)
+    if (((format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RAYLIB_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) ||
+        (format == RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R) || (format == RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG))
+    {
+        data_size = ((width + 3)/4)*((height + 3)/4)*(16*bpp/8);
+    }
+    else if ((width < 4) && (height < 4))
     {
-        if ((format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) data_size = 8;
-        else if ((format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) data_size = 16;
+        // PVRT textures smaller than a block, minimum data_size is 16
+        if ((format == RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA)) data_size = 16;
     }
 
     return data_size;
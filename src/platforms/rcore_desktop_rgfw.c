@@ -330,6 +330,7 @@ void RaylibSetWindowIcon(RaylibImage image)
         case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16:           // 16 bpp (1 channel - half float)
         case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32:           // 32 bpp (1 channel - float)
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R:           // 4 bpp (1 channel)
             channels = 1;
             break;
         
@@ -339,6 +340,7 @@ void RaylibSetWindowIcon(RaylibImage image)
         case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:      // 16 bpp (1 bit alpha)
         case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:      // 16 bpp (4 bit alpha)
         case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:      // 32 bpp
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG:          // 8 bpp (2 channels)
             channels = 2;
             break;
         
@@ -0,0 +1,774 @@
+/**********************************************************************************************
+*
+*   rcore_headless - Functions to manage offscreen graphics device, no window and no inputs
+*
+*   PLATFORM: HEADLESS
+*       - Linux servers and CI machines without a display server (EGL + Mesa/llvmpipe or GPU driver)
+*
+*   LIMITATIONS:
+*       - No window is created, rendering goes to an offscreen EGL pbuffer surface sized as requested by RaylibInitWindow()
+*       - No input devices are available, input state can only be set by the application
+*       - Window and monitor management functions are not available (offscreen surface is reported as the monitor)
+*
+*   POSSIBLE IMPROVEMENTS:
+*       - Support OSMesa as an alternative context provider when EGL is not available
+*       - Select a specific EGL device by index for multi-GPU machines
+*
+*   ADDITIONAL NOTES:
+*       - RAYLIB_TRACELOG() function is located in raylib [utils] module
+*       - Rendered frames can be read back with RaylibLoadImageFromScreen() or RaylibTakeScreenshot(),
+*         pbuffer surface is single-buffered so last frame contents remain available after RaylibEndDrawing()
+*       - Software rendering can be forced with LIBGL_ALWAYS_SOFTWARE=1 environment variable (Mesa llvmpipe)
+*       - When rlgl is compiled with RLGL_NULL_BACKEND no EGL context is created and no GPU is required,
+*         OpenGL calls are only recorded (see rlGetNullTrace()), rendered frames can not be read back
+*
+*   CONFIGURATION:
+*       #define RCORE_HEADLESS_DEFAULT_WIDTH
+*       #define RCORE_HEADLESS_DEFAULT_HEIGHT
+*           Offscreen surface size used when RaylibInitWindow() is called with a 0 width/height
+*
+*   DEPENDENCIES:
+*       - EGL: Context creation through EGL_MESA_platform_surfaceless, EGL_EXT_platform_device or default display
+*         (headers only when RLGL_NULL_BACKEND is defined, no EGL library is linked)
+*       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2013-2024 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+// NOTE: khrplatform.h embedded by glad does not define KHRONOS_APIENTRY, required by EGL headers
+#if !defined(KHRONOS_APIENTRY)
+    #define KHRONOS_APIENTRY
+#endif
+
+#include "EGL/egl.h"        // Native platform windowing system interface
+#include "EGL/eglext.h"     // EGL extensions
+
+#ifndef EGL_OPENGL_ES3_BIT
+    #define EGL_OPENGL_ES3_BIT  0x40
+#endif
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+    #define EGL_PLATFORM_SURFACELESS_MESA   0x31DD
+#endif
+#ifndef EGL_PLATFORM_DEVICE_EXT
+    #define EGL_PLATFORM_DEVICE_EXT         0x313F
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RCORE_HEADLESS_DEFAULT_WIDTH
+    #define RCORE_HEADLESS_DEFAULT_WIDTH      800       // Default offscreen surface width
+#endif
+#ifndef RCORE_HEADLESS_DEFAULT_HEIGHT
+    #define RCORE_HEADLESS_DEFAULT_HEIGHT     450       // Default offscreen surface height
+#endif
+
+#define HEADLESS_MAX_EGL_DEVICES    16                  // Maximum EGL devices queried with EGL_EXT_device_enumeration
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    // Display data
+    EGLDisplay device;                  // EGL display connection (surfaceless, device or default)
+    EGLSurface surface;                 // Offscreen pbuffer surface, default framebuffer
+    EGLContext context;                 // Graphic context, mode in which drawing can be done
+    EGLConfig config;                   // Graphic config
+} PlatformData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern CoreData CORE;                   // Global CORE state context
+
+static PlatformData platform = { 0 };   // Platform specific data
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
+void ClosePlatform(void);        // Close platform
+
+#if !defined(RLGL_NULL_BACKEND)
+static EGLDisplay GetOffscreenDisplay(void);                // Get an EGL display that does not require a display server
+#endif
+static bool CreateOffscreenSurface(int width, int height);  // Create (or recreate) offscreen pbuffer surface and make it current
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// NOTE: Functions declaration is provided by raylib.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Check if application should close
+bool RaylibWindowShouldClose(void)
+{
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+}
+
+// Toggle fullscreen mode
+void RaylibToggleFullscreen(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibToggleFullscreen() not available on target platform");
+}
+
+// Toggle borderless windowed mode
+void RaylibToggleBorderlessWindowed(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibToggleBorderlessWindowed() not available on target platform");
+}
+
+// Set window state: maximized, if resizable
+void RaylibMaximizeWindow(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibMaximizeWindow() not available on target platform");
+}
+
+// Set window state: minimized
+void RaylibMinimizeWindow(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibMinimizeWindow() not available on target platform");
+}
+
+// Set window state: not minimized/maximized
+void RaylibRestoreWindow(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibRestoreWindow() not available on target platform");
+}
+
+// Set window configuration state using flags
+void RaylibSetWindowState(unsigned int flags)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowState() not available on target platform");
+}
+
+// Clear window configuration state flags
+void RaylibClearWindowState(unsigned int flags)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibClearWindowState() not available on target platform");
+}
+
+// Set icon for window
+void RaylibSetWindowIcon(RaylibImage image)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowIcon() not available on target platform");
+}
+
+// Set icon for window
+void RaylibSetWindowIcons(RaylibImage *images, int count)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowIcons() not available on target platform");
+}
+
+// Set title for window
+void RaylibSetWindowTitle(const char *title)
+{
+    CORE.Window.title = title;
+}
+
+// Set window position on screen (windowed mode)
+void RaylibSetWindowPosition(int x, int y)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowPosition() not available on target platform");
+}
+
+// Set monitor for the current window
+void RaylibSetWindowMonitor(int monitor)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowMonitor() not available on target platform");
+}
+
+// Set window minimum dimensions (RAYLIB_FLAG_WINDOW_RESIZABLE)
+void RaylibSetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+// Set window maximum dimensions (RAYLIB_FLAG_WINDOW_RESIZABLE)
+void RaylibSetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Set window dimensions
+// NOTE: Offscreen surface is recreated with the new size, previous contents are lost
+void RaylibSetWindowSize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return;
+
+    if (!CreateOffscreenSurface(width, height))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to resize offscreen surface to %i x %i", width, height);
+        return;
+    }
+
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.display.width = width;
+    CORE.Window.display.height = height;
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    // Reset viewport and projection matrix for new size
+    SetupViewport(width, height);
+
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    CORE.Window.resizedLastFrame = true;
+}
+
+// Set window opacity, value opacity is between 0.0 and 1.0
+void RaylibSetWindowOpacity(float opacity)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowOpacity() not available on target platform");
+}
+
+// Set window focused
+void RaylibSetWindowFocused(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetWindowFocused() not available on target platform");
+}
+
+// Get native window handle
+// NOTE: There is no window on headless platform, EGL surface is returned instead
+void *RaylibGetWindowHandle(void)
+{
+    return (void *)platform.surface;
+}
+
+// Get number of monitors
+// NOTE: Offscreen surface is reported as the only monitor
+int RaylibGetMonitorCount(void)
+{
+    return 1;
+}
+
+// Get number of monitors
+int RaylibGetCurrentMonitor(void)
+{
+    return 0;
+}
+
+// Get selected monitor position
+RaylibVector2 RaylibGetMonitorPosition(int monitor)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibGetMonitorPosition() not implemented on target platform");
+    return (RaylibVector2){ 0, 0 };
+}
+
+// Get selected monitor width (currently used by monitor)
+int RaylibGetMonitorWidth(int monitor)
+{
+    return CORE.Window.display.width;
+}
+
+// Get selected monitor height (currently used by monitor)
+int RaylibGetMonitorHeight(int monitor)
+{
+    return CORE.Window.display.height;
+}
+
+// Get selected monitor physical width in millimetres
+int RaylibGetMonitorPhysicalWidth(int monitor)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibGetMonitorPhysicalWidth() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor physical height in millimetres
+int RaylibGetMonitorPhysicalHeight(int monitor)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibGetMonitorPhysicalHeight() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor refresh rate
+// NOTE: Offscreen surface has no refresh rate, frames are limited only by RaylibSetTargetFPS()
+int RaylibGetMonitorRefreshRate(int monitor)
+{
+    return 0;
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *RaylibGetMonitorName(int monitor)
+{
+    return "Headless";
+}
+
+// Get window position XY on monitor
+RaylibVector2 RaylibGetWindowPosition(void)
+{
+    return (RaylibVector2){ 0, 0 };
+}
+
+// Get window scale DPI factor for current monitor
+RaylibVector2 RaylibGetWindowScaleDPI(void)
+{
+    return (RaylibVector2){ 1.0f, 1.0f };
+}
+
+// Set clipboard text content
+void RaylibSetClipboardText(const char *text)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetClipboardText() not implemented on target platform");
+}
+
+// Get clipboard text content
+const char *RaylibGetClipboardText(void)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibGetClipboardText() not implemented on target platform");
+    return NULL;
+}
+
+// Show mouse cursor
+void RaylibShowCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Hides mouse cursor
+void RaylibHideCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Enables cursor (unlock cursor)
+void RaylibEnableCursor(void)
+{
+    // Set cursor position in the middle
+    RaylibSetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Disables cursor (lock cursor)
+void RaylibDisableCursor(void)
+{
+    // Set cursor position in the middle
+    RaylibSetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Swap back buffer with front buffer (screen drawing)
+// NOTE: Swapping a pbuffer surface has no effect (eglSwapBuffers() is a no-op),
+// frame commands are flushed explicitly so submitted work is not deferred to next frame
+void RaylibSwapScreenBuffer(void)
+{
+#if !defined(RLGL_NULL_BACKEND)
+    glFlush();
+    eglSwapBuffers(platform.device, platform.surface);
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get elapsed time measure in seconds since InitTimer()
+double RaylibGetTime(void)
+{
+    double time = 0.0;
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
+
+    return time;
+}
+
+// Open URL with default system browser (if available)
+// NOTE: This function is only safe to use if you control the URL given.
+// A user could craft a malicious string performing another action.
+// Only call this function yourself not with user input or make sure to check the string yourself.
+// Ref: https://github.com/raysan5/raylib/issues/686
+void RaylibOpenURL(const char *url)
+{
+    // Security check to (partially) avoid malicious code on target platform
+    if (strchr(url, '\'') != NULL) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Provided URL could be potentially malicious, avoid [\'] character");
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibOpenURL() not available on target platform");
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+
+// Set internal gamepad mappings
+int RaylibSetGamepadMappings(const char *mappings)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetGamepadMappings() not available on target platform");
+    return 0;
+}
+
+// Set gamepad vibration
+void RaylibSetGamepadVibration(int gamepad, float leftMotor, float rightMotor)
+{
+    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibSetGamepadVibration() not available on target platform");
+}
+
+// Set mouse position XY
+void RaylibSetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (RaylibVector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+// Set mouse cursor
+void RaylibSetMouseCursor(int cursor)
+{
+    CORE.Input.Mouse.cursor = cursor;
+}
+
+// Register all input events
+// NOTE: There are no input devices on headless platform, previous states are still
+// registered so input state set by the application (i.e. RaylibSetMousePosition()) behaves as expected
+void RaylibPollInputEvents(void)
+{
+#if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0;       // RAYLIB_GAMEPAD_BUTTON_UNKNOWN
+
+    // Register previous keys states
+    for (int i = 0; i < RAYLIB_MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    // Register previous mouse states
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (RaylibVector2){ 0.0f, 0.0f };
+    for (int i = 0; i < RAYLIB_MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    // Register previous touch states
+    for (int i = 0; i < RAYLIB_MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Initialize platform: graphics, inputs and more
+int InitPlatform(void)
+{
+    platform.device = EGL_NO_DISPLAY;
+    platform.surface = EGL_NO_SURFACE;
+    platform.context = EGL_NO_CONTEXT;
+
+    // Initialize graphic device: offscreen surface and graphic context
+    //----------------------------------------------------------------------------
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        CORE.Window.screen.width = RCORE_HEADLESS_DEFAULT_WIDTH;
+        CORE.Window.screen.height = RCORE_HEADLESS_DEFAULT_HEIGHT;
+    }
+
+    // Offscreen surface acts as the display, it always matches requested screen size
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+#if defined(RLGL_NULL_BACKEND)
+    // Null backend: no graphic context is required, OpenGL calls are recorded by rlgl
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Using rlgl null backend, no EGL context created");
+#else
+    EGLint samples = 0;
+    EGLint sampleBuffer = 0;
+    if (CORE.Window.flags & RAYLIB_FLAG_MSAA_4X_HINT)
+    {
+        samples = 4;
+        sampleBuffer = 1;
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
+    }
+
+    EGLint renderableType = EGL_OPENGL_BIT;
+    EGLenum api = EGL_OPENGL_API;
+    if (rlGetVersion() == RL_OPENGL_ES_20) { renderableType = EGL_OPENGL_ES2_BIT; api = EGL_OPENGL_ES_API; }
+    else if (rlGetVersion() == RL_OPENGL_ES_30) { renderableType = EGL_OPENGL_ES3_BIT; api = EGL_OPENGL_ES_API; }
+
+    const EGLint framebufferAttribs[] =
+    {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,      // Offscreen surface, no native window
+        EGL_RENDERABLE_TYPE, renderableType,    // Type of context support
+        EGL_RED_SIZE, 8,            // RAYLIB_RED color bit depth
+        EGL_GREEN_SIZE, 8,          // RAYLIB_GREEN color bit depth
+        EGL_BLUE_SIZE, 8,           // RAYLIB_BLUE color bit depth
+        EGL_ALPHA_SIZE, 8,          // Alpha bit depth, required to read back RGBA frames
+        EGL_DEPTH_SIZE, 24,         // Depth buffer size (Required to use Depth testing!)
+        //EGL_STENCIL_SIZE, 8,      // Stencil buffer size
+        EGL_SAMPLE_BUFFERS, sampleBuffer,    // Activate MSAA
+        EGL_SAMPLES, samples,       // 4x Antialiasing if activated
+        EGL_NONE
+    };
+
+    // Context attributes depend on requested OpenGL version
+    EGLint contextAttribs[8] = { EGL_NONE };
+    switch (rlGetVersion())
+    {
+        case RL_OPENGL_ES_20:
+        case RL_OPENGL_ES_30:
+        {
+            contextAttribs[0] = EGL_CONTEXT_CLIENT_VERSION;
+            contextAttribs[1] = (rlGetVersion() == RL_OPENGL_ES_30)? 3 : 2;
+            contextAttribs[2] = EGL_NONE;
+        } break;
+        case RL_OPENGL_33:
+        case RL_OPENGL_43:
+        {
+            contextAttribs[0] = EGL_CONTEXT_MAJOR_VERSION;
+            contextAttribs[1] = (rlGetVersion() == RL_OPENGL_43)? 4 : 3;
+            contextAttribs[2] = EGL_CONTEXT_MINOR_VERSION;
+            contextAttribs[3] = 3;
+            contextAttribs[4] = EGL_CONTEXT_OPENGL_PROFILE_MASK;
+            contextAttribs[5] = EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT;
+            contextAttribs[6] = EGL_NONE;
+        } break;
+        default: break;     // OpenGL 1.1 and 2.1: Compatibility context, any version
+    }
+
+    // Get an EGL display connection that does not require a display server
+    platform.device = GetOffscreenDisplay();
+    if (platform.device == EGL_NO_DISPLAY)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to get EGL offscreen display");
+        return -1;
+    }
+
+    // Initialize the EGL device connection
+    EGLint eglMajor = 0;
+    EGLint eglMinor = 0;
+    if (eglInitialize(platform.device, &eglMajor, &eglMinor) == EGL_FALSE)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return -1;
+    }
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: EGL %i.%i initialized (%s)", eglMajor, eglMinor, eglQueryString(platform.device, EGL_VENDOR));
+
+    // Set rendering API, it must be bound before choosing config and creating context
+    if (eglBindAPI(api) == EGL_FALSE)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to bind EGL rendering API");
+        return -1;
+    }
+
+    // Get an appropriate EGL framebuffer configuration
+    EGLint numConfigs = 0;
+    if ((eglChooseConfig(platform.device, framebufferAttribs, &platform.config, 1, &numConfigs) == EGL_FALSE) || (numConfigs == 0))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to find a suitable EGL config");
+        return -1;
+    }
+
+    // Create an EGL rendering context
+    platform.context = eglCreateContext(platform.device, platform.config, EGL_NO_CONTEXT, contextAttribs);
+    if (platform.context == EGL_NO_CONTEXT)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to create EGL context: 0x%04x", eglGetError());
+        return -1;
+    }
+#endif  // RLGL_NULL_BACKEND
+
+    // Create offscreen surface and make context current
+    if (CreateOffscreenSurface(CORE.Window.screen.width, CORE.Window.screen.height))
+    {
+        CORE.Window.ready = true;
+
+        // Render size and offsets, screen always matches display (no scaling required)
+        SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+        CORE.Window.currentFbo.width = CORE.Window.render.width;
+        CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Device initialized successfully");
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+    }
+    else
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_FATAL, "PLATFORM: Failed to initialize graphics device");
+        return -1;
+    }
+
+#if !defined(RLGL_NULL_BACKEND)
+    // No vertical sync on offscreen surface, frame rate is only limited by RaylibSetTargetFPS()
+    eglSwapInterval(platform.device, 0);
+#endif
+
+    // Set some default window flags
+    CORE.Window.flags |= RAYLIB_FLAG_WINDOW_HIDDEN;        // true, there is no visible window
+    CORE.Window.flags &= ~RAYLIB_FLAG_WINDOW_MINIMIZED;    // false
+    CORE.Window.flags &= ~RAYLIB_FLAG_WINDOW_MAXIMIZED;    // false
+    CORE.Window.flags &= ~RAYLIB_FLAG_WINDOW_UNFOCUSED;    // false
+
+    // Load OpenGL extensions
+    // NOTE: GL procedures address loader is required to load extensions,
+    // null backend replaces it with its own recording functions loader
+#if defined(RLGL_NULL_BACKEND)
+    rlLoadExtensions(NULL);
+#else
+    rlLoadExtensions(eglGetProcAddress);
+#endif
+    //----------------------------------------------------------------------------
+
+    // Initialize timing system
+    //----------------------------------------------------------------------------
+    InitTimer();
+    //----------------------------------------------------------------------------
+
+    // Initialize storage system
+    //----------------------------------------------------------------------------
+    CORE.Storage.basePath = RaylibGetWorkingDirectory();
+    //----------------------------------------------------------------------------
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "PLATFORM: HEADLESS: Initialized successfully");
+
+    return 0;
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+#if !defined(RLGL_NULL_BACKEND)
+    // Close surface, context and display
+    if (platform.device != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(platform.device, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (platform.surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(platform.device, platform.surface);
+            platform.surface = EGL_NO_SURFACE;
+        }
+
+        if (platform.context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(platform.device, platform.context);
+            platform.context = EGL_NO_CONTEXT;
+        }
+
+        eglTerminate(platform.device);
+        platform.device = EGL_NO_DISPLAY;
+    }
+
+    eglReleaseThread();
+#endif
+}
+
+#if !defined(RLGL_NULL_BACKEND)
+// Get an EGL display that does not require a display server
+// NOTE: Preference order: Mesa surfaceless platform, first EGL device, default display
+static EGLDisplay GetOffscreenDisplay(void)
+{
+    EGLDisplay display = EGL_NO_DISPLAY;
+
+    // Client extensions are queried with no display (EGL_EXT_client_extensions)
+    const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if ((clientExtensions != NULL) && (eglGetPlatformDisplayEXT != NULL))
+    {
+        if (strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL)
+        {
+            display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            if (display != EGL_NO_DISPLAY) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Using EGL surfaceless platform");
+        }
+
+        if ((display == EGL_NO_DISPLAY) && (strstr(clientExtensions, "EGL_EXT_platform_device") != NULL))
+        {
+            PFNEGLQUERYDEVICESEXTPROC eglQueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+            EGLDeviceEXT devices[HEADLESS_MAX_EGL_DEVICES] = { 0 };
+            EGLint deviceCount = 0;
+
+            if ((eglQueryDevicesEXT != NULL) && eglQueryDevicesEXT(HEADLESS_MAX_EGL_DEVICES, devices, &deviceCount) && (deviceCount > 0))
+            {
+                display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[0], NULL);
+                if (display != EGL_NO_DISPLAY) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Using EGL device platform (%i devices available)", deviceCount);
+            }
+        }
+    }
+
+    if (display == EGL_NO_DISPLAY)
+    {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (display != EGL_NO_DISPLAY) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Using EGL default display");
+    }
+
+    return display;
+}
+#endif  // !RLGL_NULL_BACKEND
+
+// Create (or recreate) offscreen pbuffer surface and make it current
+// NOTE: Pbuffer surface is the default framebuffer (id 0), so screen readback works as usual
+static bool CreateOffscreenSurface(int width, int height)
+{
+#if defined(RLGL_NULL_BACKEND)
+    return true;    // No surface required, framebuffer size is only tracked by CORE.Window
+#else
+    const EGLint surfaceAttribs[] =
+    {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+
+    EGLSurface surface = eglCreatePbufferSurface(platform.device, platform.config, surfaceAttribs);
+    if (surface == EGL_NO_SURFACE)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to create EGL pbuffer surface: 0x%04x", eglGetError());
+        return false;
+    }
+
+    if (eglMakeCurrent(platform.device, surface, surface, platform.context) == EGL_FALSE)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Failed to make EGL context current: 0x%04x", eglGetError());
+        eglDestroySurface(platform.device, surface);
+
+        // Keep previous surface current, if any
+        if (platform.surface != EGL_NO_SURFACE) eglMakeCurrent(platform.device, platform.surface, platform.surface, platform.context);
+        return false;
+    }
+
+    if (platform.surface != EGL_NO_SURFACE) eglDestroySurface(platform.device, platform.surface);
+    platform.surface = surface;
+
+    return true;
+#endif
+}
+
+// EOF
@@ -39,7 +39,7 @@
 *       [rtextures] stb_image_write (Sean Barret) for image writing (BMP, TGA, PNG, JPG)
 *       [rtextures] stb_image_resize (Sean Barret) for image resizing algorithms
 *       [rtext] stb_truetype (Sean Barret) for ttf fonts loading
-*       [rtext] stb_rect_pack (Sean Barret) for rectangles packing
+*       [rtext, rtextures] stb_rect_pack (Sean Barret) for rectangles packing
 *       [rmodels] par_shapes (Philip Rideout) for parametric 3d shapes generation
 *       [rmodels] tinyobj_loader_c (Syoyo Fujita) for models loading (OBJ, MTL)
 *       [rmodels] cgltf (Johannes Kuhlmann) for models loading (glTF)
@@ -287,6 +287,48 @@ typedef struct RaylibRenderTexture {
 // RenderTexture2D, same as RaylibRenderTexture
 typedef RaylibRenderTexture RenderTexture2D;
 
+// RaylibTextureStream, texture updated through a ring of pixel unpack buffers
+// NOTE: Actual stream data (rlTextureStream) is defined internally in rlgl module
+typedef struct RaylibTextureStream {
+    RaylibTexture texture;        // Streamed texture
+    struct rlTextureStream *stream; // Pointer to internal pixel unpack buffers data
+} RaylibTextureStream;
+
+// RaylibTextureRegion, part of a texture (sub-texture), usable with RaylibDrawTextureRec()/RaylibDrawTexturePro()
+typedef struct RaylibTextureRegion {
+    Texture2D texture;      // RaylibTexture containing the region (atlas page)
+    RaylibRectangle source;       // Region rectangle in texture
+} RaylibTextureRegion;
+
+// RaylibTextureAtlas, images packed at runtime into one or more texture pages
+// NOTE: Pages packing data (RaylibAtlasPage) is defined internally in rtextures module
+typedef struct RaylibTextureAtlas {
+    int pageWidth;          // Pages width
+    int pageHeight;         // Pages height
+    int padding;            // Empty pixels around every packed image
+    int pageCount;          // Number of pages loaded
+    Texture2D *pages;       // Pages textures (RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    struct RaylibAtlasPage **pagesData; // Pointers to internal pages packing data
+} RaylibTextureAtlas;
+
+// RaylibTextureAtlasPageInfo, atlas page utilization stats
+typedef struct RaylibTextureAtlasPageInfo {
+    int regionCount;        // Number of images packed in page
+    int usedArea;           // Pixels covered by packed images (padding not included)
+    float utilization;      // Used area over page area [0.0f..1.0f]
+} RaylibTextureAtlasPageInfo;
+
+// RaylibImagePipeline, image operations recorded to be executed fused, tile by tile
+// NOTE: Recorded operations data (RaylibImagePipelineOp) is defined internally in rtextures module
+typedef struct RaylibImagePipeline {
+    RaylibImage source;     // Source image (not copied, must be kept valid until pipeline is executed)
+    int width;              // Result width after recorded operations
+    int height;             // Result height after recorded operations
+    int format;             // Result format after recorded operations (RaylibPixelFormat type)
+    int opCount;            // Number of recorded operations
+    struct RaylibImagePipelineOp *ops; // Recorded operations
+} RaylibImagePipeline;
+
 // RaylibNPatchInfo, n-patch layout info
 typedef struct RaylibNPatchInfo {
     RaylibRectangle source;       // RaylibTexture source rectangle
@@ -360,6 +402,19 @@ typedef struct RaylibMesh {
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } RaylibMesh;
 
+// RaylibMeshBatch, meshes sharing vertex format packed in shared buffers, drawn with one indirect multi-draw
+typedef struct RaylibMeshBatch {
+    int meshCount;          // Number of meshes packed (one draw command per mesh)
+    int vertexCount;        // Number of vertices packed
+    int indexCount;         // Number of indices packed
+
+    // OpenGL identifiers
+    unsigned int vaoId;     // OpenGL Vertex Array Object id
+    unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (same layout as RaylibMesh)
+    unsigned int commandsId;    // Draw commands buffer id (SSBO, rlDrawIndirectCommand per mesh)
+    unsigned int transformsId;  // Per-draw transforms buffer id (SSBO, column-major matrix per mesh)
+} RaylibMeshBatch;
+
 // RaylibShader
 typedef struct RaylibShader {
     unsigned int id;        // RaylibShader program id
@@ -843,9 +898,19 @@ typedef enum {
     RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGB,        // 4 bpp
     RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA,       // 4 bpp
     RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,   // 8 bpp
-    RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA    // 2 bpp
+    RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA,   // 2 bpp
+    RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R,           // 4 bpp (1 channel, RGTC1)
+    RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG           // 8 bpp (2 channels, RGTC2)
 } RaylibPixelFormat;
 
+// RaylibImage block compression quality
+// NOTE: Used by RaylibImageCompress(), RaylibImageFormat() uses RAYLIB_COMPRESSION_QUALITY_NORMAL
+typedef enum {
+    RAYLIB_COMPRESSION_QUALITY_FAST = 0,           // Bounding box endpoints, no refinement (real-time encoding)
+    RAYLIB_COMPRESSION_QUALITY_NORMAL,             // Principal axis endpoints, one refinement pass
+    RAYLIB_COMPRESSION_QUALITY_HIGH                // Principal axis endpoints, iterative refinement and mode search
+} RaylibCompressionQuality;
+
 // RaylibTexture parameters: filter mode
 // NOTE 1: Filtering considers mipmaps if available in the texture
 // NOTE 2: Filter is accordingly set for minification and magnification
@@ -1047,6 +1112,8 @@ RAYLIB_RLAPI void RaylibSetShaderValueV(RaylibShader shader, int locIndex, const
 RAYLIB_RLAPI void RaylibSetShaderValueMatrix(RaylibShader shader, int locIndex, RaylibMatrix mat);         // Set shader uniform value (matrix 4x4)
 RAYLIB_RLAPI void RaylibSetShaderValueTexture(RaylibShader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
 RAYLIB_RLAPI void RaylibUnloadShader(RaylibShader shader);                                    // Unload shader from GPU memory (VRAM)
+RAYLIB_RLAPI void RaylibSetShaderCacheDirectory(const char *dirPath);                         // Set shader program binary cache directory, shaders are loaded from cached binaries (NULL to disable, default)
+RAYLIB_RLAPI void RaylibGetShaderCacheCounters(unsigned int *hits, unsigned int *misses);     // Get shader program binary cache hits and misses counters
 
 // Screen-space-related functions
 #define RAYLIB_GetMouseRay RaylibGetScreenToWorldRay     // Compatibility hack for previous raylib versions
@@ -1330,11 +1397,13 @@ RAYLIB_RLAPI RaylibImage RaylibGenImageCellular(int width, int height, int tileS
 RAYLIB_RLAPI RaylibImage RaylibGenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
 // RaylibImage manipulation functions
+RAYLIB_RLAPI void RaylibSetImageThreadCount(int count);                                                                     // Set worker threads used by CPU image processing (0: serial, -1: processors available)
 RAYLIB_RLAPI RaylibImage RaylibImageCopy(RaylibImage image);                                                                      // Create an image duplicate (useful for transformations)
 RAYLIB_RLAPI RaylibImage RaylibImageFromImage(RaylibImage image, RaylibRectangle rec);                                                  // Create an image from another image piece
 RAYLIB_RLAPI RaylibImage RaylibImageText(const char *text, int fontSize, RaylibColor color);                                      // Create an image from text (default font)
 RAYLIB_RLAPI RaylibImage RaylibImageTextEx(RaylibFont font, const char *text, float fontSize, float spacing, RaylibColor tint);         // Create an image from text (custom sprite font)
 RAYLIB_RLAPI void RaylibImageFormat(RaylibImage *image, int newFormat);                                                     // Convert image data to desired format
+RAYLIB_RLAPI void RaylibImageCompress(RaylibImage *image, int format, int quality);                                         // Compress image data to block compressed format (DXT1, DXT5, BC4, BC5)
 RAYLIB_RLAPI void RaylibImageToPOT(RaylibImage *image, RaylibColor fill);                                                         // Convert image to POT (power-of-two)
 RAYLIB_RLAPI void RaylibImageCrop(RaylibImage *image, RaylibRectangle crop);                                                      // Crop an image to a defined rectangle
 RAYLIB_RLAPI void RaylibImageAlphaCrop(RaylibImage *image, float threshold);                                                // Crop image depending on alpha value
@@ -1342,6 +1411,7 @@ RAYLIB_RLAPI void RaylibImageAlphaClear(RaylibImage *image, RaylibColor color, f
 RAYLIB_RLAPI void RaylibImageAlphaMask(RaylibImage *image, RaylibImage alphaMask);                                                // Apply alpha mask to image
 RAYLIB_RLAPI void RaylibImageAlphaPremultiply(RaylibImage *image);                                                          // Premultiply alpha channel
 RAYLIB_RLAPI void RaylibImageBlurGaussian(RaylibImage *image, int blurSize);                                                // Apply Gaussian blur using a box blur approximation
+RAYLIB_RLAPI void RaylibImageBlurGaussianEx(RaylibImage *image, int blurSize, bool trueGaussian);                        // Apply Gaussian blur, box blur approximation or true gaussian kernel
 RAYLIB_RLAPI void RaylibImageKernelConvolution(RaylibImage *image, float* kernel, int kernelSize);                         // Apply Custom Square image convolution kernel
 RAYLIB_RLAPI void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RAYLIB_RLAPI void RaylibImageResizeNN(RaylibImage *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
@@ -1359,6 +1429,18 @@ RAYLIB_RLAPI void RaylibImageColorGrayscale(RaylibImage *image);
 RAYLIB_RLAPI void RaylibImageColorContrast(RaylibImage *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 RAYLIB_RLAPI void RaylibImageColorBrightness(RaylibImage *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 RAYLIB_RLAPI void RaylibImageColorReplace(RaylibImage *image, RaylibColor color, RaylibColor replace);                                  // Modify image color: replace color
+RAYLIB_RLAPI RaylibImagePipeline RaylibLoadImagePipeline(RaylibImage source);                                             // Load image pipeline, operations are recorded and executed fused on RaylibLoadImageFromPipeline()
+RAYLIB_RLAPI void RaylibUnloadImagePipeline(RaylibImagePipeline pipeline);                                                  // Unload image pipeline recorded operations (source image is not unloaded)
+RAYLIB_RLAPI void RaylibImagePipelineCrop(RaylibImagePipeline *pipeline, RaylibRectangle crop);                             // Record image pipeline operation: crop
+RAYLIB_RLAPI void RaylibImagePipelineResize(RaylibImagePipeline *pipeline, int newWidth, int newHeight);                    // Record image pipeline operation: resize (Bicubic scaling algorithm)
+RAYLIB_RLAPI void RaylibImagePipelineFormat(RaylibImagePipeline *pipeline, int newFormat);                                  // Record image pipeline operation: convert format
+RAYLIB_RLAPI void RaylibImagePipelineColorTint(RaylibImagePipeline *pipeline, RaylibColor color);                           // Record image pipeline operation: color tint
+RAYLIB_RLAPI void RaylibImagePipelineColorInvert(RaylibImagePipeline *pipeline);                                            // Record image pipeline operation: color invert
+RAYLIB_RLAPI void RaylibImagePipelineColorGrayscale(RaylibImagePipeline *pipeline);                                         // Record image pipeline operation: color grayscale
+RAYLIB_RLAPI void RaylibImagePipelineColorContrast(RaylibImagePipeline *pipeline, float contrast);                           // Record image pipeline operation: color contrast (-100 to 100)
+RAYLIB_RLAPI void RaylibImagePipelineColorBrightness(RaylibImagePipeline *pipeline, int brightness);                        // Record image pipeline operation: color brightness (-255 to 255)
+RAYLIB_RLAPI void RaylibImagePipelineColorReplace(RaylibImagePipeline *pipeline, RaylibColor color, RaylibColor replace);   // Record image pipeline operation: color replace
+RAYLIB_RLAPI RaylibImage RaylibLoadImageFromPipeline(RaylibImagePipeline pipeline);                                         // Load image executing pipeline operations, same result as applying them one after another
 RAYLIB_RLAPI RaylibColor *RaylibLoadImageColors(RaylibImage image);                                                               // Load color data from image as a RaylibColor array (RGBA - 32bit)
 RAYLIB_RLAPI RaylibColor *RaylibLoadImagePalette(RaylibImage image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a RaylibColor array (RGBA - 32bit)
 RAYLIB_RLAPI void RaylibUnloadImageColors(RaylibColor *colors);                                                             // Unload color data loaded with RaylibLoadImageColors()
@@ -1397,6 +1479,18 @@ RAYLIB_RLAPI bool RaylibIsRenderTextureReady(RenderTexture2D target);
 RAYLIB_RLAPI void RaylibUnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RAYLIB_RLAPI void RaylibUpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RAYLIB_RLAPI void RaylibUpdateTextureRec(Texture2D texture, RaylibRectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RAYLIB_RLAPI RaylibTextureStream RaylibLoadTextureStream(int width, int height, int format, int slots);               // Load texture for streaming updates (slots: pixel unpack buffers in flight)
+RAYLIB_RLAPI bool RaylibIsTextureStreamReady(RaylibTextureStream stream);                                             // Check if a texture stream is ready
+RAYLIB_RLAPI void RaylibUnloadTextureStream(RaylibTextureStream stream);                                              // Unload texture stream and its texture from GPU memory (VRAM)
+RAYLIB_RLAPI void *RaylibBeginTextureStreamUpdate(RaylibTextureStream stream);                                        // Begin texture stream update, returns pointer to write full texture pixel data (no copy)
+RAYLIB_RLAPI void RaylibEndTextureStreamUpdate(RaylibTextureStream stream);                                           // End texture stream update, upload written pixel data to texture (asynchronous)
+RAYLIB_RLAPI void RaylibUpdateTextureStream(RaylibTextureStream stream, const void *pixels);                          // Update texture stream with new data (copied to next pixel unpack buffer)
+RAYLIB_RLAPI RaylibTextureAtlas RaylibLoadTextureAtlas(int pageWidth, int pageHeight, int padding);                   // Load texture atlas, pages are loaded on demand when images are added
+RAYLIB_RLAPI bool RaylibIsTextureAtlasReady(RaylibTextureAtlas atlas);                                                // Check if a texture atlas is ready
+RAYLIB_RLAPI void RaylibUnloadTextureAtlas(RaylibTextureAtlas atlas);                                                 // Unload texture atlas pages from GPU memory (VRAM)
+RAYLIB_RLAPI RaylibTextureRegion RaylibAddTextureAtlasImage(RaylibTextureAtlas *atlas, RaylibImage image);            // Pack image into texture atlas, returns its region (empty on failure)
+RAYLIB_RLAPI int RaylibAddTextureAtlasImages(RaylibTextureAtlas *atlas, const RaylibImage *images, int count, RaylibTextureRegion *regions); // Pack multiple images into texture atlas, returns number of images packed
+RAYLIB_RLAPI RaylibTextureAtlasPageInfo RaylibGetTextureAtlasPageInfo(RaylibTextureAtlas atlas, int page);            // Get texture atlas page utilization stats
 
 // RaylibTexture configuration functions
 RAYLIB_RLAPI void RaylibGenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
@@ -1448,6 +1542,7 @@ RAYLIB_RLAPI bool RaylibExportFontAsCode(RaylibFont font, const char *fileName);
 
 // Text drawing functions
 RAYLIB_RLAPI void RaylibDrawFPS(int posX, int posY);                                                     // Draw current FPS
+RAYLIB_RLAPI void RaylibDrawRenderStats(int posX, int posY);                                             // Draw render statistics for current frame (draw calls, batch flushes, uploads...)
 RAYLIB_RLAPI void RaylibDrawText(const char *text, int posX, int posY, int fontSize, RaylibColor color);       // Draw text (using default font)
 RAYLIB_RLAPI void RaylibDrawTextEx(RaylibFont font, const char *text, RaylibVector2 position, float fontSize, float spacing, RaylibColor tint); // Draw text using font and additional parameters
 RAYLIB_RLAPI void RaylibDrawTextPro(RaylibFont font, const char *text, RaylibVector2 position, RaylibVector2 origin, float rotation, float fontSize, float spacing, RaylibColor tint); // Draw text using RaylibFont and pro parameters (rotation)
@@ -1549,6 +1644,11 @@ RAYLIB_RLAPI void RaylibUpdateMeshBuffer(RaylibMesh mesh, int index, const void
 RAYLIB_RLAPI void RaylibUnloadMesh(RaylibMesh mesh);                                                           // Unload mesh data from CPU and GPU
 RAYLIB_RLAPI void RaylibDrawMesh(RaylibMesh mesh, RaylibMaterial material, RaylibMatrix transform);                        // Draw a 3d mesh with material and transform
 RAYLIB_RLAPI void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const RaylibMatrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RAYLIB_RLAPI RaylibMeshBatch RaylibLoadMeshBatch(const RaylibMesh *meshes, int meshCount);                  // Load mesh batch, meshes sharing vertex format packed in shared buffers (OpenGL 4.3)
+RAYLIB_RLAPI bool RaylibIsMeshBatchReady(RaylibMeshBatch batch);                                            // Check if a mesh batch is ready
+RAYLIB_RLAPI void RaylibUnloadMeshBatch(RaylibMeshBatch batch);                                             // Unload mesh batch from GPU memory (VRAM)
+RAYLIB_RLAPI void RaylibUpdateMeshBatchTransforms(RaylibMeshBatch batch, const RaylibMatrix *transforms, int offset, int count); // Update mesh batch per-draw transforms
+RAYLIB_RLAPI void RaylibDrawMeshBatch(RaylibMeshBatch batch, RaylibMaterial material);                      // Draw all mesh batch meshes with material in a single indirect multi-draw
 RAYLIB_RLAPI RaylibBoundingBox RaylibGetMeshBoundingBox(RaylibMesh mesh);                                            // Compute mesh bounding box limits
 RAYLIB_RLAPI void RaylibGenMeshTangents(RaylibMesh *mesh);                                                     // Compute mesh tangents
 RAYLIB_RLAPI bool RaylibExportMesh(RaylibMesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
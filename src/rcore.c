@@ -19,6 +19,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > RAYLIB_PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_HEADLESS (EGL offscreen backend):
+*           - Linux servers and CI (no display server, no inputs)
 *
 *   CONFIGURATION:
 *       #define RAYLIB_SUPPORT_DEFAULT_FONT (default)
@@ -366,10 +368,33 @@ CoreData CORE = { 0 };               // Global CORE state context
 static int screenshotCounter = 0;    // Screenshots counter
 #endif
 
+static char shaderCachePath[RAYLIB_MAX_FILEPATH_LENGTH] = { 0 }; // Shader program binary cache directory (empty if disabled)
+static unsigned int shaderCacheHits = 0;    // Shader program binary cache hits counter
+static unsigned int shaderCacheMisses = 0;  // Shader program binary cache misses counter (including rejected binaries)
+
 #if defined(RAYLIB_SUPPORT_GIF_RECORDING)
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE    10
+#endif
+#ifndef GIF_RECORD_BITRATE
+    #define GIF_RECORD_BITRATE      16
+#endif
+#ifndef GIF_RECORD_READBACKS
+    #define GIF_RECORD_READBACKS     3      // Maximum number of gif frames being read back from GPU (asynchronous readback)
+#endif
+
+// GIF frame being read back from GPU
+typedef struct GifReadback {
+    int request;                     // Screen readback request id
+    int width;                       // Frame width
+    int delay;                       // Frame delay in centiseconds
+} GifReadback;
+
 unsigned int gifFrameCounter = 0;    // GIF frames counter
 bool gifRecording = false;           // GIF recording state
 MsfGifState gifState = { 0 };        // MSGIF context state
+static GifReadback gifReadbacks[GIF_RECORD_READBACKS] = { 0 }; // GIF frames being read back (in recording order)
+static int gifReadbackCount = 0;     // GIF frames being read back counter
 #endif
 
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
@@ -470,6 +495,10 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+extern void UnloadImageThreadPool(void); // [Module: textures] Stops image worker threads on RaylibCloseWindow()
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -480,10 +509,16 @@ static void SetupViewport(int width, int height);           // Set viewport for
 static void ScanDirectoryFiles(const char *basePath, RaylibFilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, RaylibFilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
 
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode); // Load shader program from binary cache, compiled from code if not cached
+
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING)
+static void RecordGifReadbacks(bool wait); // Add gif frames read back from GPU to the recording (in order)
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: RaylibWaitTime()
@@ -506,6 +541,8 @@ const char *RaylibTextFormat(const char *text, ...);              // Formatting
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -574,6 +611,8 @@ void RaylibInitWindow(int width, int height, const char *title)
     RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(RAYLIB_PLATFORM_ANDROID)
     RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_HEADLESS)
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "Platform backend: HEADLESS (EGL offscreen)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -685,6 +724,7 @@ void RaylibCloseWindow(void)
 #if defined(RAYLIB_SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
+        gifReadbackCount = 0;   // NOTE: Readback buffers are unloaded by rlglClose()
         MsfGifResult result = msf_gif_end(&gifState);
         msf_gif_free(result);
         gifRecording = false;
@@ -695,6 +735,10 @@ void RaylibCloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+    UnloadImageThreadPool();    // WARNING: Module required: rtextures
+#endif
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -840,6 +884,8 @@ void RaylibBeginDrawing(void)
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(RAYLIB_MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
+    rlResetRenderStats();               // Reset render statistics (draw calls, flushes, uploads...) for current frame
+
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
 }
@@ -853,28 +899,42 @@ void RaylibEndDrawing(void)
     // Draw record indicator
     if (gifRecording)
     {
-        #ifndef GIF_RECORD_FRAMERATE
-        #define GIF_RECORD_FRAMERATE    10
-        #endif
         gifFrameCounter += RaylibGetFrameTime()*1000;
 
+        // Add frames read back on previous frames to the gif recording
+        RecordGifReadbacks(false);
+
         // NOTE: We record one gif frame depending on the desired gif framerate
         if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
         {
             // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
+            // NOTE: Data is read back asynchronously and added to the recording some frames later
             RaylibVector2 scale = RaylibGetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+            int width = (int)((float)CORE.Window.render.width*scale.x);
+            int height = (int)((float)CORE.Window.render.height*scale.y);
+            int request = -1;
 
-            #ifndef GIF_RECORD_BITRATE
-            #define GIF_RECORD_BITRATE 16
-            #endif
+            if (gifReadbackCount < GIF_RECORD_READBACKS) request = rlReadScreenPixelsAsync(width, height);
 
-            // Add the frame to the gif recording, given how many frames have passed in centiseconds
-            msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
-            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
+            if (request >= 0)
+            {
+                gifReadbacks[gifReadbackCount] = (GifReadback){ request, width, gifFrameCounter/10 };
+                gifReadbackCount++;
+            }
+            else
+            {
+                // Asynchronous readback not available, frames in flight are added first to keep order
+                RecordGifReadbacks(true);
 
-            RL_FREE(screenData);    // Free image data
+                unsigned char *screenData = rlReadScreenPixels(width, height);
+
+                // Add the frame to the gif recording, given how many frames have passed in centiseconds
+                msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, width*4);
+
+                RL_FREE(screenData);    // Free image data
+            }
+
+            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
         }
 
     #if defined(RAYLIB_SUPPORT_MODULE_RSHAPES) && defined(RAYLIB_SUPPORT_MODULE_RTEXT)
@@ -890,6 +950,8 @@ void RaylibEndDrawing(void)
     }
 #endif
 
+    rlUpdateGpuTimers();            // Finish frame GPU timer queries and read back available results
+
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
@@ -929,6 +991,7 @@ void RaylibEndDrawing(void)
             {
                 gifRecording = false;
 
+                RecordGifReadbacks(true);   // Add frames still being read back
                 MsfGifResult result = msf_gif_end(&gifState);
 
                 RaylibSaveFileData(RaylibTextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
@@ -963,7 +1026,7 @@ void RaylibEndDrawing(void)
 // Initialize 2D mode with custom camera (2D)
 void RaylibBeginMode2D(RaylibCamera2D camera)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
@@ -974,7 +1037,7 @@ void RaylibBeginMode2D(RaylibCamera2D camera)
 // Ends 2D mode with custom camera
 void RaylibEndMode2D(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
@@ -984,7 +1047,7 @@ void RaylibEndMode2D(void)
 // Initializes 3D mode with custom camera (3D)
 void RaylibBeginMode3D(Camera camera)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPushMatrix();                 // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -1017,13 +1080,16 @@ void RaylibBeginMode3D(Camera camera)
     RaylibMatrix matView = RaylibMatrixLookAt(camera.position, camera.target, camera.up);
     rlMultMatrixf(RAYLIB_MatrixToFloat(matView));      // Multiply modelview matrix by view matrix (camera)
 
+    // Upload camera matrices once for all shaders declaring the camera uniform block
+    rlSetUniformBlockCamera(rlGetMatrixModelview(), rlGetMatrixProjection());
+
     rlEnableDepthTest();            // Enable DEPTH_TEST for 3D
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
 void RaylibEndMode3D(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
@@ -1039,7 +1105,7 @@ void RaylibEndMode3D(void)
 // Initializes render texture for drawing
 void RaylibBeginTextureMode(RenderTexture2D target)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlEnableFramebuffer(target.id); // Enable render target
 
@@ -1070,7 +1136,7 @@ void RaylibBeginTextureMode(RenderTexture2D target)
 // Ends drawing to render texture
 void RaylibEndTextureMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlDisableFramebuffer();         // Disable render target (fbo)
 
@@ -1117,7 +1183,7 @@ void RaylibEndBlendMode(void)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void RaylibBeginScissorMode(int x, int y, int width, int height)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
 
     rlEnableScissorTest();
 
@@ -1143,7 +1209,7 @@ void RaylibBeginScissorMode(int x, int y, int width, int height)
 // End scissor mode
 void RaylibEndScissorMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_BATCH_FLUSH_MATRIX_CHANGE);  // Update and draw internal render batch (mode change)
     rlDisableScissorTest();
 }
 
@@ -1276,7 +1342,7 @@ RaylibShader RaylibLoadShaderFromMemory(const char *vsCode, const char *fsCode)
 {
     RaylibShader shader = { 0 };
 
-    shader.id = rlLoadShaderCode(vsCode, fsCode);
+    shader.id = LoadShaderCodeCached(vsCode, fsCode);
 
     // After shader loading, we TRY to set default location names
     if (shader.id > 0)
@@ -1365,6 +1431,26 @@ void RaylibUnloadShader(RaylibShader shader)
     }
 }
 
+// Set shader program binary cache directory
+// NOTE: Directory must exist, programs compiled from code are stored there and loaded from
+// binary on following launches (if supported by the driver, OpenGL 4.1 or GL_ARB_get_program_binary)
+void RaylibSetShaderCacheDirectory(const char *dirPath)
+{
+    memset(shaderCachePath, 0, RAYLIB_MAX_FILEPATH_LENGTH);
+
+    if (dirPath == NULL) return;
+
+    if (RaylibDirectoryExists(dirPath)) strncpy(shaderCachePath, dirPath, RAYLIB_MAX_FILEPATH_LENGTH - 1);
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SHADER: [%s] Shader cache directory does not exist, cache disabled", dirPath);
+}
+
+// Get shader program binary cache hits and misses counters
+void RaylibGetShaderCacheCounters(unsigned int *hits, unsigned int *misses)
+{
+    if (hits != NULL) *hits = shaderCacheHits;
+    if (misses != NULL) *misses = shaderCacheMisses;
+}
+
 // Get shader uniform location
 int RaylibGetShaderLocation(RaylibShader shader, const char *uniformName)
 {
@@ -3372,6 +3458,91 @@ static void ScanDirectoryFilesRecursively(const char *basePath, RaylibFilePathLi
     else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
 }
 
+// Load shader program from binary cache, compiled from code if not cached
+// NOTE: Cache file: "RLSB" identifier, binary format (4 bytes) and program binary data,
+// named by shader code hash (includes GL vendor, renderer and version)
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode)
+{
+    // Default shader is not cached
+    if ((shaderCachePath[0] == '\0') || ((vsCode == NULL) && (fsCode == NULL))) return rlLoadShaderCode(vsCode, fsCode);
+
+    unsigned int id = 0;
+    char fileName[RAYLIB_MAX_FILEPATH_LENGTH + 32] = { 0 };
+    snprintf(fileName, sizeof(fileName), "%s/%016llx.shbin", shaderCachePath, rlGetShaderCodeHash(vsCode, fsCode));
+
+    if (RaylibFileExists(fileName))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = RaylibLoadFileData(fileName, &dataSize);
+
+        if ((fileData != NULL) && (dataSize > 8) && (memcmp(fileData, "RLSB", 4) == 0))
+        {
+            unsigned int format = 0;
+            memcpy(&format, fileData + 4, sizeof(unsigned int));
+            id = rlLoadShaderProgramBinary(fileData + 8, dataSize - 8, format);
+        }
+
+        RaylibUnloadFileData(fileData);
+
+        if (id > 0)
+        {
+            shaderCacheHits++;
+            return id;
+        }
+
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SHADER: [%s] Cached program binary not valid, compiling from code", fileName);
+    }
+
+    shaderCacheMisses++;
+    id = rlLoadShaderCode(vsCode, fsCode);
+
+    // NOTE: On compilation failure default shader is returned, it is not cached
+    if ((id > 0) && (id != rlGetShaderIdDefault()))
+    {
+        int binarySize = 0;
+        unsigned int format = 0;
+        unsigned char *binary = rlGetShaderProgramBinary(id, &binarySize, &format);
+
+        if (binary != NULL)
+        {
+            unsigned char *fileData = (unsigned char *)RL_MALLOC(binarySize + 8);
+            memcpy(fileData, "RLSB", 4);
+            memcpy(fileData + 4, &format, sizeof(unsigned int));
+            memcpy(fileData + 8, binary, binarySize);
+
+            RaylibSaveFileData(fileName, fileData, binarySize + 8);
+
+            RL_FREE(fileData);
+            RL_FREE(binary);
+        }
+    }
+
+    return id;
+}
+
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING)
+// Add gif frames read back from GPU to the recording, in recording order
+// NOTE: Without waiting, it stops on first frame not read back yet
+static void RecordGifReadbacks(bool wait)
+{
+    while (gifReadbackCount > 0)
+    {
+        unsigned char *screenData = rlGetScreenPixelsAsync(gifReadbacks[0].request, wait);
+
+        if ((screenData == NULL) && !wait) break;
+
+        if (screenData != NULL)
+        {
+            msf_gif_frame(&gifState, screenData, gifReadbacks[0].delay, GIF_RECORD_BITRATE, gifReadbacks[0].width*4);
+            RL_FREE(screenData);    // Free image data
+        }
+
+        for (int i = 1; i < gifReadbackCount; i++) gifReadbacks[i - 1] = gifReadbacks[i];
+        gifReadbackCount--;
+    }
+}
+#endif
+
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
 // Automation event recording
 // NOTE: Recording is by default done at RaylibEndDrawing(), before RaylibPollInputEvents()
@@ -46,16 +46,33 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_NULL_BACKEND
+*           Replace OpenGL entry points by a null backend (no GPU required), commands are not executed but
+*           recorded into an in-memory trace: buffer/texture uploads, draws and state binds, use rlGetNullTrace()
+*           NOTE: Only available with glad loaded OpenGL (RAYLIB_GRAPHICS_API_OPENGL_21/33/43), loader is ignored
+*
+*       #define RLGL_NO_SIMD
+*           Disable SSE/NEON code paths (batch vertex transform), scalar code is used instead
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
-*       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture(), multi-texture draws)
+*       #define RL_DEFAULT_BATCH_VERTEX_LAYOUT        0    // Default batch vertex layout: 0-Separate arrays (4 VBOs), 1-Interleaved (1 VBO), 2-Interleaved streaming (fenced ring buffer)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal RaylibMatrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_CACHED_TEXTURE_SLOTS          16    // Maximum number of texture slots tracked by GL state cache
+*       #define RL_MAX_GPU_TIMERS                    32    // Maximum number of GPU timer scopes per frame
+*       #define RL_GPU_TIMER_FRAMES                   3    // Number of frames GPU timer queries are kept in flight (results latency)
+*       #define RL_MAX_SCREEN_READBACKS               3    // Maximum number of asynchronous screen readbacks in flight (pixel pack buffers)
+*       #define RL_MAX_TEXTURE_STREAM_SLOTS           4    // Maximum number of pixel unpack buffers per texture stream
+*       #define RL_UNIFORM_LOCATION_CACHE_SIZE      256    // Number of shader uniform locations cached (by shader id and name)
+*       #define RL_CAMERA_UNIFORM_BLOCK_BINDING       0    // Uniform buffer binding point used for camera matrices block
+*       #define RL_NULL_TRACE_MAX_COMMANDS        65536    // Maximum number of commands stored by null backend trace (RLGL_NULL_BACKEND)
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -68,6 +85,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -77,6 +95,7 @@
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
+*       #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA "rlCamera"         // camera matrices uniform block (std140: mat4 matView, matProjection, matViewProjection)
 *
 *   DEPENDENCIES:
 *      - OpenGL libraries (depending on platform and OpenGL version selected)
@@ -216,7 +235,10 @@
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
-    #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture())
+    #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture(), multi-texture draws)
+#endif
+#ifndef RL_DEFAULT_BATCH_VERTEX_LAYOUT
+    #define RL_DEFAULT_BATCH_VERTEX_LAYOUT           0      // Default batch vertex layout: 0-Separate arrays (4 VBOs), 1-Interleaved (1 VBO), 2-Interleaved streaming (fenced ring buffer)
 #endif
 
 // Internal RaylibMatrix stack
@@ -229,6 +251,50 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// GL state cache limits
+#ifndef RL_MAX_CACHED_TEXTURE_SLOTS
+    #define RL_MAX_CACHED_TEXTURE_SLOTS             16      // Maximum number of texture slots tracked by GL state cache
+#endif
+
+// GPU timer queries limits
+#ifndef RL_MAX_GPU_TIMERS
+    #define RL_MAX_GPU_TIMERS                       32      // Maximum number of GPU timer scopes per frame
+#endif
+#ifndef RL_GPU_TIMER_FRAMES
+    #define RL_GPU_TIMER_FRAMES                      3      // Number of frames GPU timer queries are kept in flight (results latency)
+#endif
+#ifndef RL_MAX_GPU_TIMER_NAME_SIZE
+    #define RL_MAX_GPU_TIMER_NAME_SIZE              32      // Maximum GPU timer scope name size (including '\0')
+#endif
+
+// Asynchronous screen readback limits
+#ifndef RL_MAX_SCREEN_READBACKS
+    #define RL_MAX_SCREEN_READBACKS                  3      // Maximum number of asynchronous screen readbacks in flight (pixel pack buffers)
+#endif
+
+// Texture streams limits
+#ifndef RL_MAX_TEXTURE_STREAM_SLOTS
+    #define RL_MAX_TEXTURE_STREAM_SLOTS              4      // Maximum number of pixel unpack buffers per texture stream
+#endif
+
+// Shader uniform locations cache limits
+#ifndef RL_UNIFORM_LOCATION_CACHE_SIZE
+    #define RL_UNIFORM_LOCATION_CACHE_SIZE         256      // Number of shader uniform locations cached (by shader id and name), must be a multiple of 4
+#endif
+#ifndef RL_MAX_UNIFORM_NAME_SIZE
+    #define RL_MAX_UNIFORM_NAME_SIZE                64      // Maximum uniform name size cached (including '\0'), longer names are not cached
+#endif
+
+// Camera matrices uniform block
+#ifndef RL_CAMERA_UNIFORM_BLOCK_BINDING
+    #define RL_CAMERA_UNIFORM_BLOCK_BINDING          0      // Uniform buffer binding point used for camera matrices block
+#endif
+
+// Null backend trace limits
+#ifndef RL_NULL_TRACE_MAX_COMMANDS
+    #define RL_NULL_TRACE_MAX_COMMANDS           65536      // Maximum number of commands stored by null backend trace, counters keep counting
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -341,6 +407,9 @@
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT   6
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -363,14 +432,27 @@ typedef struct RaylibMatrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Interleaved batch vertex (position + texcoord + normal + color + texture slot), 40 bytes
+// NOTE: Used by render batches loaded with RL_BATCH_LAYOUT_INTERLEAVED or RL_BATCH_LAYOUT_INTERLEAVED_STREAM
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV) (shader-location = 1)
+    float normal[3];            // Vertex normal (XYZ) (shader-location = 2)
+    unsigned char color[4];     // Vertex color (RGBA) (shader-location = 3)
+    unsigned char texslot;      // Vertex texture slot, index of draw call texture to sample (shader-location = 6)
+} rlBatchVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
+    int layout;                 // Vertex data layout (rlBatchVertexLayout)
 
+    rlBatchVertex *data;        // Interleaved vertex data, only used with interleaved layouts (shader-locations = 0..3)
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    unsigned char *texslots;    // Vertex texture slots (1 component per vertex) (shader-location = 6)
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_11) || defined(RAYLIB_GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -378,23 +460,30 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned int vboId[6];      // OpenGL Vertex Buffer Objects id (6 types of vertex data, [4] for indices, interleaved layout only uses [0] and [4])
+    void *syncFence;            // OpenGL sync object (GLsync) guarding this buffer region, only used with RL_BATCH_LAYOUT_INTERLEAVED_STREAM
+    bool dataMapped;            // Vertex data points to persistently mapped GPU memory (no upload required)
 } rlVertexBuffer;
 
 // Draw call type
-// NOTE: Only texture changes register a new draw, other state-change-related elements are not
-// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
-// of those state-change happens (this is done in core module)
+// NOTE: By default only texture changes register a new draw, shader, blending and matrix
+// state-changes force a batch draw call (this is done in core module), in deferred draw mode
+// those state-changes register a new draw and draws are sorted by layer and state on batch drawing
 typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // RaylibShader id to be used on the draw -> Using RLGL.currentShaderId
+    unsigned int shaderId;      // RaylibShader id to be used on the draw -> Using RLGL.currentShaderId if not deferred
+    int *shaderLocs;            // RaylibShader locations to be used on the draw -> Using RLGL.currentShaderLocs if not deferred
+    int blendMode;              // Blending mode to be used on the draw -> Using RLGL.currentBlendMode if not deferred
+    int layer;                  // Draw layer, sorting key in deferred draw mode
     unsigned int textureId;     // RaylibTexture id to be used on the draw -> Use to create new draw call if changes
+    unsigned int textureIds[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS]; // Textures bound to units 0..textureCount-1, selected by vertex texture slot (textureIds[0] = textureId)
+    int textureCount;           // Number of textures used by the draw (more than 1 requires default shader, multi-texture variant)
 
-    //RaylibMatrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
-    //RaylibMatrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
+    RaylibMatrix projection;    // Projection matrix for this draw -> Using RLGL.projection if not deferred
+    RaylibMatrix modelview;     // Modelview matrix for this draw -> Using RLGL.modelview if not deferred
 } rlDrawCall;
 
 // rlRenderBatch type
@@ -406,8 +495,122 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+
+    unsigned int fenceWaitCount;  // Number of fence checks done before reusing a buffer region (streaming layout)
+    unsigned int fenceStallCount; // Number of fence checks that actually blocked waiting for the GPU (streaming layout)
 } rlRenderBatch;
 
+// Display list type, retained render batch vertex data and draw calls (GPU resident)
+// NOTE: Recorded with rlBeginDisplayList()/rlEndDisplayList(), vertex data is uploaded once and replayed
+// with current shader, blending and matrices, recorded draw calls only keep mode and textures,
+// transform matrix set while recording (rlPushMatrix()/rlTranslatef()...) is baked into vertex data,
+// multi-texture draws are replayed split by texture slot when current shader is not the default one
+typedef struct rlDisplayList {
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[2];      // OpenGL Vertex Buffer Objects id: [0] interleaved vertex data (rlBatchVertex), [1] indices
+    int vertexCount;            // Number of vertex stored (including alignment vertex)
+    rlDrawCall *draws;          // Draw calls array
+    int drawCount;              // Draw calls counter
+    rlDrawCall *splitDraws;     // Draw calls array with multi-texture draws split by texture slot (used with custom shaders)
+    int splitDrawCount;         // Split draw calls counter (0 if no multi-texture draws recorded)
+} rlDisplayList;
+
+// Quad type for bulk submission (rlPushQuads())
+// NOTE: Vertex order: top-left, bottom-left, bottom-right, top-right
+typedef struct rlQuad {
+    rlBatchVertex vertices[4];  // Quad vertices (position, texcoord, normal, color)
+} rlQuad;
+
+// Triangle type for bulk submission (rlPushTriangles())
+typedef struct rlTriangle {
+    rlBatchVertex vertices[3];  // Triangle vertices (position, texcoord, normal, color)
+} rlTriangle;
+
+// Render batch recording context (opaque), used to build render batches on worker threads
+// NOTE: Created with rlLoadRecordContext(), filled between rlBeginRecording()/rlEndRecording()
+// on any thread and submitted for drawing on main thread with rlSubmitRecordContext()
+typedef struct rlRecordContext rlRecordContext;
+
+// Texture stream (opaque), texture updated through a ring of pixel unpack buffers
+// NOTE: Created with rlLoadTextureStream(), pixel data is written directly into the next buffer
+// between rlBeginTextureStreamUpdate()/rlEndTextureStreamUpdate(), texture upload overlaps GPU work
+typedef struct rlTextureStream rlTextureStream;
+
+// Indirect draw command, same layout as OpenGL DrawElementsIndirectCommand
+// NOTE: Commands buffer can be filled on CPU or written by a compute shader (SSBO)
+typedef struct rlDrawIndirectCommand {
+    unsigned int count;         // Number of indices to draw
+    unsigned int instanceCount; // Number of instances to draw (0 skips the command)
+    unsigned int firstIndex;    // First index in element buffer
+    int baseVertex;             // Value added to every index (vertex offset in shared buffers)
+    unsigned int baseInstance;  // First instance, used to fetch per-draw instanced attributes
+} rlDrawIndirectCommand;
+
+// Render statistics, accumulated since last reset (every frame by default)
+typedef struct rlRenderStats {
+    unsigned int drawCalls;             // Draw calls issued (batch draws, vertex arrays, instancing)
+    unsigned int vertexCount;           // Vertex submitted with draw calls
+    unsigned int batchFlushes;          // Render batch draws with vertex data (all reasons)
+    unsigned int flushBufferFull;       // Render batch draws forced by vertex buffer full
+    unsigned int flushShaderChange;     // Render batch draws forced by shader change
+    unsigned int flushBlendChange;      // Render batch draws forced by blend mode change
+    unsigned int flushMatrixChange;     // Render batch draws forced by mode or matrix change (used by raylib on 2D/3D, texture and scissor modes)
+    unsigned int flushDrawCallsLimit;   // Render batch draws forced by draw calls limit (RL_DEFAULT_BATCH_DRAWCALLS) on texture/mode change
+    unsigned int flushExplicit;         // Render batch draws requested (rlDrawRenderBatchActive(), used by raylib on frame end)
+    unsigned int textureChanges;        // New draw calls registered by texture change (no batch draw required)
+    unsigned int modeChanges;           // New draw calls registered by primitive mode change (no batch draw required)
+    unsigned int uploadedBytes;         // Bytes uploaded to GPU (batch vertex data, vertex buffers and textures updates)
+    unsigned int textureBinds;          // Texture binds issued
+    unsigned int stateChangesIssued;    // GL state changes issued (GL state cache)
+    unsigned int stateChangesSkipped;   // GL state changes skipped, already set (GL state cache)
+} rlRenderStats;
+
+// GPU timer scope result, measured with GL timer queries
+typedef struct rlGpuTimer {
+    char name[RL_MAX_GPU_TIMER_NAME_SIZE]; // Timer scope name
+    int depth;                  // Timer scope nesting depth (0 for top level scopes)
+    float time;                 // GPU elapsed time in milliseconds
+} rlGpuTimer;
+
+#if defined(RLGL_NULL_BACKEND)
+// Null backend trace command type
+typedef enum {
+    RL_NULL_COMMAND_BUFFER_UPLOAD = 0,  // Buffer data upload (glBufferData(), glBufferSubData(), mapped buffer write)
+    RL_NULL_COMMAND_TEXTURE_UPLOAD,     // Texture data upload (glTexImage2D(), glTexSubImage2D(), glCompressedTexImage2D())
+    RL_NULL_COMMAND_DRAW,               // Draw call (arrays, elements, instanced or indirect)
+    RL_NULL_COMMAND_CLEAR,              // Framebuffer clear
+    RL_NULL_COMMAND_BIND_SHADER,        // Shader program bind
+    RL_NULL_COMMAND_BIND_TEXTURE,       // Texture bind
+    RL_NULL_COMMAND_BIND_VERTEX_ARRAY,  // Vertex array bind
+    RL_NULL_COMMAND_BIND_BUFFER,        // Buffer bind
+    RL_NULL_COMMAND_BIND_FRAMEBUFFER    // Framebuffer bind
+} rlNullCommandType;
+
+// Null backend trace command
+typedef struct rlNullCommand {
+    int type;                   // Command type (rlNullCommandType)
+    unsigned int target;        // OpenGL target (binds, uploads) or primitive mode (draws)
+    unsigned int id;            // Object id (binds, uploads)
+    unsigned int count;         // Vertex or index count (draws), 0 for indirect draws
+    unsigned int instances;     // Instance count (draws), draw commands count for indirect draws
+    unsigned int bytes;         // Bytes uploaded (uploads), 0 for allocations without data
+} rlNullCommand;
+
+// Null backend trace, recorded since last reset
+typedef struct rlNullTrace {
+    unsigned int drawCalls;             // Draw calls issued
+    unsigned int vertexCount;           // Vertex (or index) count drawn, instances included
+    unsigned int bufferUploads;         // Buffer data uploads
+    unsigned int bufferBytes;           // Buffer data bytes uploaded
+    unsigned int textureUploads;        // Texture data uploads
+    unsigned int textureBytes;          // Texture data bytes uploaded (from system memory)
+    unsigned int stateBinds;            // State binds issued (shader, texture, vertex array, buffer, framebuffer)
+    unsigned int clears;                // Framebuffer clears
+    unsigned int commandCount;          // Commands recorded, only first RL_NULL_TRACE_MAX_COMMANDS are stored
+    const rlNullCommand *commands;      // Recorded commands, in submission order
+} rlNullTrace;
+#endif
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -418,6 +621,19 @@ typedef enum {
     RL_OPENGL_ES_30             // OpenGL ES 3.0 (GLSL 300 es)
 } rlGlVersion;
 
+// Render batch vertex data layout
+typedef enum {
+    RL_BATCH_LAYOUT_SEPARATE = 0,   // One array and VBO per vertex attribute (position, texcoord, normal, color)
+    RL_BATCH_LAYOUT_INTERLEAVED,    // One packed rlBatchVertex per vertex, single VBO and single upload per flush
+    RL_BATCH_LAYOUT_INTERLEAVED_STREAM  // Interleaved, one VBO split in a region per batch buffer, guarded by fences (persistent-mapped if supported, orphaned on GLES)
+} rlBatchVertexLayout;
+
+// Render batch draw reason, registered on render statistics
+typedef enum {
+    RL_BATCH_FLUSH_EXPLICIT = 0,    // Render batch draw requested (frame end, user request)
+    RL_BATCH_FLUSH_MATRIX_CHANGE    // Render batch draw required by mode or matrix change
+} rlBatchFlushReason;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -457,7 +673,9 @@ typedef enum {
     RL_PIXELFORMAT_COMPRESSED_PVRT_RGB,            // 4 bpp
     RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA,           // 4 bpp
     RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,       // 8 bpp
-    RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA        // 2 bpp
+    RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA,       // 2 bpp
+    RL_PIXELFORMAT_COMPRESSED_BC4_R,               // 4 bpp (1 channel, RGTC1)
+    RL_PIXELFORMAT_COMPRESSED_BC5_RG               // 8 bpp (2 channels, RGTC2)
 } rlPixelFormat;
 
 // RaylibTexture parameters: filter mode
@@ -607,6 +825,9 @@ RAYLIB_RLAPI void rlNormal3f(float x, float y, float z);       // Define one ver
 RAYLIB_RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
 RAYLIB_RLAPI void rlColor3f(float x, float y, float z);        // Define one vertex (color) - 3 float
 RAYLIB_RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RAYLIB_RLAPI bool rlPushQuads(const rlQuad *quads, int count, unsigned int textureId);   // Push multiple quads at once (bulk rlBegin(RL_QUADS)...rlEnd()), returns false if batch can not fit a quad
+RAYLIB_RLAPI bool rlPushTriangles(const rlTriangle *triangles, int count, unsigned int textureId); // Push multiple triangles at once (bulk rlBegin(RL_TRIANGLES)...rlEnd()), returns false if batch can not fit a triangle
+RAYLIB_RLAPI float rlGetCurrentDepth(void);                    // Get current depth value, used as z by rlVertex2f()
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -673,6 +894,10 @@ RAYLIB_RLAPI void rlDisableSmoothLines(void);                  // Disable line a
 RAYLIB_RLAPI void rlEnableStereoRender(void);                  // Enable stereo rendering
 RAYLIB_RLAPI void rlDisableStereoRender(void);                 // Disable stereo rendering
 RAYLIB_RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo render is enabled
+RAYLIB_RLAPI void rlEnableDeferredDraw(void);                  // Enable deferred draw mode, draw calls sorted by (layer, shader, blend, texture) and merged by state on batch draw
+RAYLIB_RLAPI void rlDisableDeferredDraw(void);                 // Disable deferred draw mode
+RAYLIB_RLAPI bool rlIsDeferredDrawEnabled(void);               // Check if deferred draw mode is enabled
+RAYLIB_RLAPI void rlSetDrawLayer(int layer);                   // Set current draw layer, layers are drawn in ascending order (deferred draw mode)
 
 RAYLIB_RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RAYLIB_RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
@@ -702,11 +927,60 @@ RAYLIB_RLAPI int *rlGetShaderLocsDefault(void);                // Get default sh
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
 RAYLIB_RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements); // Load a render batch system
+RAYLIB_RLAPI rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int layout); // Load a render batch system with a vertex data layout (rlBatchVertexLayout)
 RAYLIB_RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);    // Unload render batch system
 RAYLIB_RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
 RAYLIB_RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RAYLIB_RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
+RAYLIB_RLAPI void rlDrawRenderBatchActiveEx(int reason);       // Update and draw internal render batch, registering the reason on render statistics (rlBatchFlushReason)
 RAYLIB_RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RAYLIB_RLAPI unsigned int rlGetRenderBatchStallCount(void);    // Get number of times active render batch blocked waiting for a GPU fence (streaming layout)
+
+// Display lists management
+RAYLIB_RLAPI void rlBeginDisplayList(void);                    // Begin display list recording, following batch vertex data is captured instead of drawn
+RAYLIB_RLAPI rlDisplayList rlEndDisplayList(void);             // End display list recording and upload captured vertex data to GPU
+RAYLIB_RLAPI void rlDrawDisplayList(rlDisplayList list, RaylibMatrix transform); // Draw display list (no vertex upload), transform applied over current modelview (record-time transform already baked)
+RAYLIB_RLAPI void rlUnloadDisplayList(rlDisplayList list);     // Unload display list from GPU memory (VRAM) and RAM
+
+// Render batch recording contexts (multithreaded scene building)
+// NOTE: Only geometry (rlBegin()/rlVertex*()/rlEnd(), rlPushQuads()...), matrix and rlSetTexture() functions
+// can be used while recording on a worker thread, recorded data is drawn on main thread with current
+// shader, blending mode and matrices (same as display lists), in submission order
+RAYLIB_RLAPI rlRecordContext *rlLoadRecordContext(int bufferElements); // Load a recording context (CPU only, no GPU calls), it can be loaded on any thread
+RAYLIB_RLAPI void rlUnloadRecordContext(rlRecordContext *context); // Unload recording context (main thread)
+RAYLIB_RLAPI void rlBeginRecording(rlRecordContext *context);  // Begin recording on current thread, following batch vertex data is recorded into context
+RAYLIB_RLAPI void rlEndRecording(void);                        // End recording on current thread
+RAYLIB_RLAPI void rlSubmitRecordContext(rlRecordContext *context); // Upload and draw context recorded data (main thread)
+
+// GL state cache
+// NOTE: Redundant bindings (shader, vertex array, framebuffer, texture slot, texture, blend mode) are skipped,
+// cache must be invalidated if those states are changed by OpenGL calls outside rlgl
+RAYLIB_RLAPI void rlInvalidateStateCache(void);                // Invalidate GL state cache, next state changes are issued
+RAYLIB_RLAPI void rlGetStateChangeCounters(unsigned int *issued, unsigned int *skipped); // Get GL state changes issued and skipped (redundant) since last reset
+RAYLIB_RLAPI void rlResetStateChangeCounters(void);            // Reset GL state changes counters
+
+// Render statistics
+RAYLIB_RLAPI rlRenderStats rlGetRenderStats(void);             // Get render statistics since last reset (current frame)
+RAYLIB_RLAPI void rlResetRenderStats(void);                    // Reset render statistics (raylib resets them every frame on BeginDrawing())
+
+// GPU timer queries
+// NOTE: Results are read back RL_GPU_TIMER_FRAMES frames later without waiting for the GPU,
+// not supported on OpenGL 1.1 and OpenGL ES 2.0 (OpenGL 2.1 requires GL_ARB_timer_query)
+RAYLIB_RLAPI bool rlIsGpuTimerSupported(void);                 // Check if GPU timer queries are supported
+RAYLIB_RLAPI void rlBeginGpuTimer(const char *name);           // Begin GPU timer scope (scopes can be nested), pending batch data is drawn
+RAYLIB_RLAPI void rlEndGpuTimer(void);                         // End latest GPU timer scope, pending batch data is drawn
+RAYLIB_RLAPI void rlUpdateGpuTimers(void);                     // Finish frame GPU timers and read back available results (raylib calls it every frame on EndDrawing())
+RAYLIB_RLAPI int rlGetGpuTimerCount(void);                     // Get number of GPU timer scopes in latest resolved frame
+RAYLIB_RLAPI rlGpuTimer rlGetGpuTimer(int index);              // Get GPU timer scope result from latest resolved frame
+RAYLIB_RLAPI float rlGetGpuTimerTime(const char *name);        // Get GPU timer scope time (milliseconds) by name from latest resolved frame, -1.0f if not found
+RAYLIB_RLAPI void rlTraceGpuTimers(void);                      // Log GPU timer scopes results from latest resolved frame
+
+#if defined(RLGL_NULL_BACKEND)
+// Null backend trace
+// NOTE: Trace commands pointer is valid until rlglClose(), reset does not free it
+RAYLIB_RLAPI rlNullTrace rlGetNullTrace(void);                 // Get null backend trace recorded since last reset
+RAYLIB_RLAPI void rlResetNullTrace(void);                      // Reset null backend trace counters and recorded commands
+#endif
 
 RAYLIB_RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -727,6 +1001,8 @@ RAYLIB_RLAPI void rlDrawVertexArray(int offset, int count);    // Draw vertex ar
 RAYLIB_RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer); // Draw vertex array elements
 RAYLIB_RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances); // Draw vertex array (currently active vao) with instancing
 RAYLIB_RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances); // Draw vertex array elements with instancing
+RAYLIB_RLAPI bool rlIsDrawIndirectSupported(void);                                       // Check if indirect multi-draw is supported (OpenGL 4.3)
+RAYLIB_RLAPI void rlDrawVertexArrayElementsIndirect(unsigned int commandsId, int offset, int drawCount); // Draw vertex array elements with multiple draw commands from buffer (rlDrawIndirectCommand)
 
 // Textures management
 RAYLIB_RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
@@ -739,6 +1015,13 @@ RAYLIB_RLAPI void rlUnloadTexture(unsigned int id);
 RAYLIB_RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RAYLIB_RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RAYLIB_RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RAYLIB_RLAPI int rlReadScreenPixelsAsync(int width, int height);                  // Start asynchronous screen pixel data read (pixel pack buffer), returns request id or -1 if not available
+RAYLIB_RLAPI bool rlIsScreenPixelsAsyncReady(int request);                        // Check if asynchronous screen pixel data read is completed (no wait)
+RAYLIB_RLAPI unsigned char *rlGetScreenPixelsAsync(int request, bool wait);       // Get asynchronous screen pixel data read result, NULL if not ready (request is released on success)
+RAYLIB_RLAPI rlTextureStream *rlLoadTextureStream(unsigned int id, int width, int height, int format, int slots); // Load texture stream for an uncompressed texture (pixel unpack buffers ring)
+RAYLIB_RLAPI void rlUnloadTextureStream(rlTextureStream *stream);                 // Unload texture stream buffers (texture is not unloaded)
+RAYLIB_RLAPI void *rlBeginTextureStreamUpdate(rlTextureStream *stream);           // Begin texture stream update, returns pointer to write next full texture pixel data
+RAYLIB_RLAPI void rlEndTextureStreamUpdate(rlTextureStream *stream);              // End texture stream update, written pixel data is uploaded to texture (asynchronous)
 
 // Framebuffer management (fbo)
 RAYLIB_RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
@@ -751,12 +1034,17 @@ RAYLIB_RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCod
 RAYLIB_RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RAYLIB_RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 RAYLIB_RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+RAYLIB_RLAPI unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize, unsigned int *format); // Get shader program binary (NULL if not supported), data should be freed
+RAYLIB_RLAPI unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize, unsigned int format); // Load shader program from binary, returns 0 if binary is rejected by driver
+RAYLIB_RLAPI unsigned long long rlGetShaderCodeHash(const char *vsCode, const char *fsCode); // Get shader code hash for program binary caching (includes GL vendor, renderer, version and default shader code for NULL)
 RAYLIB_RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RAYLIB_RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RAYLIB_RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count); // Set shader value uniform
 RAYLIB_RLAPI void rlSetUniformMatrix(int locIndex, RaylibMatrix mat);                        // Set shader value matrix
 RAYLIB_RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RAYLIB_RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
+RAYLIB_RLAPI void rlSetUniformBlockCamera(RaylibMatrix view, RaylibMatrix projection);  // Set camera matrices uniform block (shared by all shaders declaring it)
+RAYLIB_RLAPI void rlSetUniformBlockCameraEye(int eye);       // Set camera matrices uniform block for stereo render eye (eye view offset and projection applied)
 
 // Compute shader management
 RAYLIB_RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
@@ -839,6 +1127,11 @@ RAYLIB_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #include "external/glad.h"          // GLAD extensions loading library, includes OpenGL headers
 #endif
 
+// Null backend resolves glad entry points to recording stubs, OpenGL functions called directly can not be replaced
+#if defined(RLGL_NULL_BACKEND) && !defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    #error "RLGL_NULL_BACKEND requires RAYLIB_GRAPHICS_API_OPENGL_21, RAYLIB_GRAPHICS_API_OPENGL_33 or RAYLIB_GRAPHICS_API_OPENGL_43"
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES3)
     #include <GLES3/gl3.h>              // OpenGL ES 3.0 library
     #define GL_GLEXT_PROTOTYPES
@@ -866,9 +1159,21 @@ RAYLIB_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
+#include <stddef.h>                     // Required for: offsetof() [Used in rlLoadRenderBatchEx(), interleaved layout]
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <stdio.h>                      // Required for: snprintf() [Used in rlLoadShaderDefault(), multi-texture shader code]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
+#if !defined(RLGL_NO_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in rlTransformVertices()]
+        #define RLGL_SIMD_SSE
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in rlTransformVertices()]
+        #define RLGL_SIMD_NEON
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -919,6 +1224,12 @@ RAYLIB_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef GL_COMPRESSED_RGBA_ASTC_8x8_KHR
     #define GL_COMPRESSED_RGBA_ASTC_8x8_KHR     0x93b7
 #endif
+#ifndef GL_COMPRESSED_RED_RGTC1
+    #define GL_COMPRESSED_RED_RGTC1             0x8DBB
+#endif
+#ifndef GL_COMPRESSED_RG_RGTC2
+    #define GL_COMPRESSED_RG_RGTC2              0x8DBD
+#endif
 
 #ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
     #define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT   0x84FF
@@ -935,6 +1246,19 @@ RAYLIB_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_LINE_WIDTH                       0x0B21
 #endif
 
+#define RL_STATE_CACHE_INVALID          0xFFFFFFFF      // GL state cache value for unknown state, next change is always issued
+
+// Thread local storage specifier, used for current thread recording context
+#if defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus) && (__cplusplus >= 201103L)
+    #define RL_THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+    #define RL_THREAD_LOCAL _Thread_local
+#else
+    #define RL_THREAD_LOCAL __thread
+#endif
+
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
     #define GL_UNSIGNED_SHORT_5_6_5             0x8363
     #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
@@ -973,6 +1297,9 @@ RAYLIB_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -1001,30 +1328,94 @@ RAYLIB_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA
+    #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA "rlCamera"         // camera matrices uniform block (std140: mat4 matView, matProjection, matViewProjection)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-typedef struct rlglData {
+// Render batch recording context
+// NOTE: It holds the per-batch CPU state used by the immediate-mode functions (rlVertex*, rlColor*,
+// matrix stack...); the main thread uses RLGL.Record while worker threads record into their own one
+struct rlRecordContext {
     rlRenderBatch *currentBatch;            // Current render batch
+    int vertexCounter;                      // Current active render batch vertex counter (generic, used for all batches)
+    float texcoordx, texcoordy;             // Current active texture coordinate (added on glVertex*())
+    float normalx, normaly, normalz;        // Current active normal (added on glVertex*())
+    unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
+    unsigned char texslot;                  // Current active texture slot in current draw call (added on glVertex*())
+
+    int currentMatrixMode;                  // Current matrix mode
+    RaylibMatrix *currentMatrix;                  // Current matrix pointer
+    RaylibMatrix modelview;                       // Default modelview matrix
+    RaylibMatrix projection;                      // Default projection matrix
+    RaylibMatrix transform;                       // RaylibTransform matrix to be used with rlTranslate, rlRotate, rlScale
+    bool transformRequired;                 // Require transform matrix application to current draw-call vertex (if required)
+    int transformRunStart;                  // First vertex of current transform run, run is transformed on matrix change or batch draw
+    RaylibMatrix stack[RL_MAX_MATRIX_STACK_SIZE];// RaylibMatrix stack for push/pop
+    int stackCounter;                       // RaylibMatrix stack counter
+
+    bool capturing;                         // Capturing flag, batch vertex data is captured instead of drawn
+    rlBatchVertex *captureVertices;         // Captured vertex data
+    int captureVertexCount;                 // Captured vertex counter
+    int captureVertexCapacity;              // Captured vertex data capacity
+    rlDrawCall *captureDraws;               // Captured draw calls
+    int captureDrawCount;                   // Captured draw calls counter
+    int captureDrawCapacity;                // Captured draw calls capacity
+
+    rlRenderBatch batch;                    // Worker context render batch (CPU data only, no GPU buffers)
+    rlRecordContext *previous;              // Recording context active before rlBeginRecording()
+    rlDisplayList submitList;               // Worker context GPU buffers used on submission
+    int submitQuadCapacity;                 // Worker context GPU buffers capacity (in quads)
+    rlDrawCall *submitSplitDraws;           // Worker context draw calls split by texture slot, used on submission with custom shaders
+    int submitSplitDrawCapacity;            // Worker context split draw calls capacity
+};
+
+// GPU timer queries frame data, kept in flight until results are available
+typedef struct rlGpuTimerFrame {
+    unsigned int queryIds[RL_MAX_GPU_TIMERS*2]; // Timestamp queries: [2*i] scope begin, [2*i + 1] scope end
+    rlGpuTimer timers[RL_MAX_GPU_TIMERS];   // Timer scopes begun on frame
+    int timerCount;                         // Timer scopes counter
+    bool pending;                           // Queries issued, results not read back yet
+} rlGpuTimerFrame;
+
+#if defined(RLGL_NULL_BACKEND)
+// Null backend buffer object
+typedef struct rlNullBuffer {
+    unsigned int size;                      // Buffer data size (last glBufferData()/glBufferStorage())
+    void *mapped;                           // Mapped system memory (NULL if not mapped)
+    unsigned int mappedSize;                // Mapped range size
+    bool mappedWrite;                       // Mapped for writing (not persistent), unmap is registered as an upload
+} rlNullBuffer;
+
+#define RL_NULL_BUFFER_TARGETS      10      // Buffer binding targets tracked by null backend
+#endif
+
+// Asynchronous screen readback, pixel pack buffer kept in flight until read is completed
+typedef struct rlScreenReadback {
+    unsigned int pboId;                     // Pixel pack buffer id
+    int size;                               // Pixel pack buffer size in bytes
+    int width;                              // Requested read width
+    int height;                             // Requested read height
+    void *syncFence;                        // Read completion fence (GLsync), NULL if not supported
+    bool busy;                              // Read requested, result not retrieved yet
+} rlScreenReadback;
+
+// Shader uniform location cache entry
+typedef struct rlUniformLocation {
+    unsigned int shaderId;                  // Shader program id (0 if entry is empty)
+    unsigned int hash;                      // Uniform name hash (FNV-1a)
+    int location;                           // Uniform location (-1 if not found in program)
+    char name[RL_MAX_UNIFORM_NAME_SIZE];    // Uniform name
+} rlUniformLocation;
+
+typedef struct rlglData {
+    rlRecordContext Record;                 // Main thread recording context
     rlRenderBatch defaultBatch;             // Default internal render batch
 
     struct {
-        int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
-        float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
-        float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
-        unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
-
-        int currentMatrixMode;              // Current matrix mode
-        RaylibMatrix *currentMatrix;              // Current matrix pointer
-        RaylibMatrix modelview;                   // Default modelview matrix
-        RaylibMatrix projection;                  // Default projection matrix
-        RaylibMatrix transform;                   // RaylibTransform matrix to be used with rlTranslate, rlRotate, rlScale
-        bool transformRequired;             // Require transform matrix application to current draw-call vertex (if required)
-        RaylibMatrix stack[RL_MAX_MATRIX_STACK_SIZE];// RaylibMatrix stack for push/pop
-        int stackCounter;                   // RaylibMatrix stack counter
-
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
@@ -1033,6 +1424,10 @@ typedef struct rlglData {
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        unsigned int multiTextureVShaderId; // Default multi-texture vertex shader id
+        unsigned int multiTextureFShaderId; // Default multi-texture fragment shader id
+        unsigned int multiTextureShaderId;  // Default shader variant program id, samples one of RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS textures by vertex texture slot
+        int *multiTextureShaderLocs;        // Default multi-texture shader locations pointer
 
         bool stereoRender;                  // Stereo rendering flag
         RaylibMatrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
@@ -1051,6 +1446,24 @@ typedef struct rlglData {
         int glBlendEquationAlpha;           // Blending equation for alpha
         bool glCustomBlendModeModified;     // Custom blending factor and equation modification status
 
+        bool deferredDraw;                  // Deferred draw mode flag, draw calls are sorted by layer and state on batch draw
+        int currentLayer;                   // Current draw layer (used as sorting key in deferred draw mode)
+        unsigned char *sortBuffer;          // Temporary vertex data buffer used to reorder draw calls vertex
+        int sortBufferSize;                 // Temporary vertex data buffer size in bytes
+
+        rlRenderBatch displayListBatch;     // Render batch used to record display lists (interleaved layout)
+        rlRenderBatch *displayListPrevBatch; // Render batch active before display list recording
+
+        unsigned int cachedShaderId;        // GL state cache: Bound shader program id
+        unsigned int cachedVertexArrayId;   // GL state cache: Bound vertex array id
+        unsigned int cachedDrawFramebufferId; // GL state cache: Bound draw framebuffer id
+        unsigned int cachedReadFramebufferId; // GL state cache: Bound read framebuffer id
+        int cachedTextureSlot;              // GL state cache: Active texture slot (-1 if unknown)
+        unsigned int cachedTextureIds[RL_MAX_CACHED_TEXTURE_SLOTS]; // GL state cache: Bound 2D texture id per slot
+        unsigned int cachedCubemapIds[RL_MAX_CACHED_TEXTURE_SLOTS]; // GL state cache: Bound cubemap texture id per slot
+
+        bool computeBarrierRequired;        // Compute shader dispatched, its buffer writes must be visible to next indirect draw
+
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
@@ -1068,21 +1481,87 @@ typedef struct rlglData {
         bool texCompETC2;                   // ETC2/EAC texture compression support (GL_ARB_ES3_compatibility)
         bool texCompPVRT;                   // PVR texture compression support (GL_IMG_texture_compression_pvrtc)
         bool texCompASTC;                   // ASTC texture compression support (GL_KHR_texture_compression_astc_hdr, GL_KHR_texture_compression_astc_ldr)
+        bool texCompRGTC;                   // BC4/BC5 texture compression support (GL_ARB_texture_compression_rgtc, GL_EXT_texture_compression_rgtc)
         bool texMirrorClamp;                // RaylibClamp mirror wrap mode supported (GL_EXT_texture_mirror_clamp)
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // RaylibShader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool drawIndirect;                  // Indirect multi-draw support (GL_ARB_multi_draw_indirect)
+        bool sync;                          // Sync objects (fences) and unsynchronized buffer mapping support (GL_ARB_sync, GL_ARB_map_buffer_range)
+        bool bufferStorage;                 // Immutable buffer storage, persistent mapping support (GL_ARB_buffer_storage)
+        bool timerQuery;                    // Timestamp queries support (GL_ARB_timer_query)
+        bool programBinary;                 // Shader program binary retrieval support (GL_ARB_get_program_binary)
+        bool ubo;                           // Uniform buffer objects support (GL_ARB_uniform_buffer_object)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+
+    rlRenderStats Stats;                    // Render statistics (since last reset)
+
+    struct {
+        rlGpuTimerFrame frames[RL_GPU_TIMER_FRAMES]; // Frames in flight, ring buffer
+        int currentFrame;                   // Frame recording timer scopes
+        int stack[RL_MAX_GPU_TIMERS];       // Open timer scopes (index in current frame timers, -1 if dropped)
+        int stackCounter;                   // Open timer scopes counter
+        rlGpuTimer results[RL_MAX_GPU_TIMERS]; // Latest resolved frame results
+        int resultCount;                    // Latest resolved frame results counter
+    } GpuTimers;        // GPU timer queries
+
+    rlScreenReadback Readbacks[RL_MAX_SCREEN_READBACKS]; // Asynchronous screen readbacks
+
+    struct {
+        rlUniformLocation entries[RL_UNIFORM_LOCATION_CACHE_SIZE]; // Cached locations, 4-way set associative
+        unsigned int evictCounter;          // Next way evicted on a full set
+    } UniformLocations; // Shader uniform locations cache
+
+    struct {
+        unsigned int uboId;                 // Camera matrices uniform buffer id
+        bool used;                          // Some loaded shader declares the camera block (upload required)
+        RaylibMatrix view;                  // Camera view matrix set, stereo render eyes view is computed from it
+    } CameraBlock;      // Camera matrices uniform block
+
+    struct {
+        unsigned int *shaderIds;            // Loaded shader programs declaring vertex texture slot attribute
+        int count;                          // Shader programs counter
+        int capacity;                       // Shader programs array capacity
+    } TexSlotShaders;   // Custom shaders declaring texture slot attribute (checked once on program load)
+
+#if defined(RLGL_NULL_BACKEND)
+    struct {
+        rlNullTrace trace;                  // Trace counters (commands pointer set on rlGetNullTrace())
+        rlNullCommand *commands;            // Recorded commands (RL_NULL_TRACE_MAX_COMMANDS)
+        unsigned int idCounter;             // Last object id generated, shared by all object types
+        rlNullBuffer *buffers;              // Buffer objects, indexed by id
+        unsigned int bufferCapacity;        // Buffer objects array capacity
+        unsigned int boundBuffers[RL_NULL_BUFFER_TARGETS]; // Buffers bound by target (see rlNullBufferTargetIndex())
+        unsigned int boundFramebuffer;      // Draw framebuffer bound
+    } NullBackend;      // Null backend state (no GPU calls)
+#endif
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
 
+// Texture stream
+// NOTE: Pixel unpack buffers are only available on OpenGL 2.1 and 3.3+,
+// a system memory buffer is used otherwise and uploaded with rlUpdateTexture()
+struct rlTextureStream {
+    unsigned int textureId;                 // Streamed texture id
+    int width;                              // Streamed texture width
+    int height;                             // Streamed texture height
+    int format;                             // Streamed texture pixel format (uncompressed)
+    int size;                               // Texture pixel data size in bytes
+    int slotCount;                          // Pixel unpack buffers used (0 if not supported)
+    int currentSlot;                        // Pixel unpack buffer being written
+    unsigned int pboIds[RL_MAX_TEXTURE_STREAM_SLOTS];   // Pixel unpack buffers ids
+    void *syncFences[RL_MAX_TEXTURE_STREAM_SLOTS];      // Upload completion fences (GLsync), NULL if not in use
+    void *data;                             // System memory pixel data (pixel unpack buffers not supported)
+    bool updating;                          // Update in progress, buffer mapped for writing
+};
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -1091,6 +1570,7 @@ static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
+static RL_THREAD_LOCAL rlRecordContext *RLCTX = NULL;  // Current thread recording context (main thread: &RLGL.Record)
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
 
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
@@ -1111,12 +1591,48 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadShaderMultiTexture(void); // Load default shader multi-texture variant
+static void rlApplyBlendMode(int mode);     // Apply blending mode to OpenGL state
+static void rlSetDrawCallState(rlDrawCall *draw);   // Record current state (shader, blend, layer, matrices) in draw call
+static void rlSetDrawCallTexture(rlDrawCall *draw, unsigned int id);    // Set draw call single texture (slot 0)
+static void rlNextDrawCall(void);           // Finish current draw call (if not empty) and register a new one with current state
+static void rlFlushRenderBatch(unsigned int *reasonCounter);    // Draw active render batch, registering the reason on render statistics
+static void rlSortRenderBatch(rlRenderBatch *batch);    // Sort batch draw calls by (layer, shader, blend, texture) and merge them by state (deferred draw mode)
+static int rlCompareDrawState(const rlDrawCall *a, const rlDrawCall *b);   // Compare draw calls state sorting key (shader, blend, texture)
+static bool rlGetDrawScreenBounds(const rlVertexBuffer *buffer, const rlDrawCall *draw, int offset, float *bounds);  // Get draw call vertex data screen bounds (normalized device coordinates)
+static void rlCaptureRenderBatch(rlRenderBatch *batch); // Capture batch vertex data and draw calls into current recording context
+static void rlFlushTransformRun(rlRenderBatch *batch);  // Transform vertex run added with current transform matrix, next vertex start a new run
+static void rlTransformVertices(float *positions, float *normals, int stride, int count, RaylibMatrix mat); // Transform vertex positions and normals (SSE/NEON if available)
+static void rlSetDisplayListAttribs(void);  // Set display list vertex attributes for currently bound vertex buffer
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+static bool rlResolveGpuTimerFrame(rlGpuTimerFrame *frame); // Read back GPU timer frame queries results if available (no wait)
+static void rlBindCameraUniformBlock(unsigned int shaderId); // Bind shader camera uniform block (if declared) to camera block binding point
+static void rlUploadCameraBlock(RaylibMatrix view, RaylibMatrix projection); // Upload camera matrices uniform block data
+#endif
+#if defined(RLGL_NULL_BACKEND)
+static void *rlNullGetProcAddress(const char *name);        // Get null backend OpenGL function (recording stub), used as glad loader
+static void rlNullRecord(int type, unsigned int target, unsigned int id, unsigned int count, unsigned int instances, unsigned int bytes); // Record null backend trace command
+#endif
+static void rlClearUniformLocations(unsigned int shaderId); // Clear shader cached uniform locations
+static void rlCheckTexSlotShader(unsigned int shaderId, bool loaded); // Register (on load) or remove (on unload) shader declaring vertex texture slot attribute
+static bool rlUploadDisplayList(rlDisplayList *list, const rlBatchVertex *vertices, int vertexCount, int indexQuadCount, int usage); // Upload display list vertex data to GPU, buffers are created if required
+static int rlSplitDrawsByTexSlot(const rlDrawCall *draws, int drawCount, const rlBatchVertex *vertices, rlDrawCall **split, int *splitCapacity); // Split multi-texture draw calls into single texture draw calls by vertex texture slot
+static void rlSetDrawUniforms(const int *locs, RaylibMatrix projection, RaylibMatrix modelview);  // Upload draw matrices to shader
+static void rlSetTexSlotAttrib(unsigned int shaderId);         // Enable vertex texture slot attribute only if shader declares it
+static void rlCacheUseProgram(unsigned int id);                 // Bind shader program (GL state cache)
+static void rlCacheBindVertexArray(unsigned int id);            // Bind vertex array (GL state cache)
+static void rlCacheBindFramebuffer(unsigned int target, unsigned int id);  // Bind framebuffer (GL state cache)
+static void rlCacheActiveTexture(int slot);                     // Select active texture slot (GL state cache)
+static void rlCacheBindTextureCubemap(unsigned int id);         // Bind cubemap texture to active slot (GL state cache)
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void rlCopyScreenPixels(unsigned char *dst, const unsigned char *src, int width, int height); // Copy screen pixel data (RGBA) flipped vertically, alpha set to 255
+static bool rlPushPrimitives(const rlBatchVertex *vertices, int count, int mode, unsigned int textureId); // Push multiple primitives vertex data (quads or triangles)
+static void rlCacheBindTexture(unsigned int id);                // Bind 2D texture to active slot (GL state cache)
 
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
@@ -1169,49 +1685,54 @@ void rlMultMatrixf(const float *matf) { glMultMatrixf(matf); }
 // Choose the current matrix to be transformed
 void rlMatrixMode(int mode)
 {
-    if (mode == RL_PROJECTION) RLGL.State.currentMatrix = &RLGL.State.projection;
-    else if (mode == RL_MODELVIEW) RLGL.State.currentMatrix = &RLGL.State.modelview;
+    if (mode == RL_PROJECTION) RLCTX->currentMatrix = &RLCTX->projection;
+    else if (mode == RL_MODELVIEW) RLCTX->currentMatrix = &RLCTX->modelview;
     //else if (mode == RL_TEXTURE) // Not supported
 
-    RLGL.State.currentMatrixMode = mode;
+    RLCTX->currentMatrixMode = mode;
 }
 
-// Push the current matrix into RLGL.State.stack
+// Push the current matrix into RLCTX->stack
 void rlPushMatrix(void)
 {
-    if (RLGL.State.stackCounter >= RL_MAX_MATRIX_STACK_SIZE) RAYLIB_TRACELOG(RL_LOG_ERROR, "RLGL: RaylibMatrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
+    if (RLCTX->stackCounter >= RL_MAX_MATRIX_STACK_SIZE) RAYLIB_TRACELOG(RL_LOG_ERROR, "RLGL: RaylibMatrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
 
-    if (RLGL.State.currentMatrixMode == RL_MODELVIEW)
+    if (RLCTX->currentMatrixMode == RL_MODELVIEW)
     {
-        RLGL.State.transformRequired = true;
-        RLGL.State.currentMatrix = &RLGL.State.transform;
+        rlFlushTransformRun(RLCTX->currentBatch);
+        RLCTX->transformRequired = true;
+        RLCTX->currentMatrix = &RLCTX->transform;
     }
 
-    RLGL.State.stack[RLGL.State.stackCounter] = *RLGL.State.currentMatrix;
-    RLGL.State.stackCounter++;
+    RLCTX->stack[RLCTX->stackCounter] = *RLCTX->currentMatrix;
+    RLCTX->stackCounter++;
 }
 
-// Pop lattest inserted matrix from RLGL.State.stack
+// Pop lattest inserted matrix from RLCTX->stack
 void rlPopMatrix(void)
 {
-    if (RLGL.State.stackCounter > 0)
+    if (RLCTX->transformRequired) rlFlushTransformRun(RLCTX->currentBatch);
+
+    if (RLCTX->stackCounter > 0)
     {
-        RaylibMatrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
-        *RLGL.State.currentMatrix = mat;
-        RLGL.State.stackCounter--;
+        RaylibMatrix mat = RLCTX->stack[RLCTX->stackCounter - 1];
+        *RLCTX->currentMatrix = mat;
+        RLCTX->stackCounter--;
     }
 
-    if ((RLGL.State.stackCounter == 0) && (RLGL.State.currentMatrixMode == RL_MODELVIEW))
+    if ((RLCTX->stackCounter == 0) && (RLCTX->currentMatrixMode == RL_MODELVIEW))
     {
-        RLGL.State.currentMatrix = &RLGL.State.modelview;
-        RLGL.State.transformRequired = false;
+        RLCTX->currentMatrix = &RLCTX->modelview;
+        RLCTX->transformRequired = false;
     }
 }
 
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
-    *RLGL.State.currentMatrix = rlMatrixIdentity();
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
+    *RLCTX->currentMatrix = rlMatrixIdentity();
 }
 
 // Multiply the current matrix by a translation matrix
@@ -1224,8 +1745,10 @@ void rlTranslatef(float x, float y, float z)
         0.0f, 0.0f, 0.0f, 1.0f
     };
 
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
+    *RLCTX->currentMatrix = rlMatrixMultiply(matTranslation, *RLCTX->currentMatrix);
 }
 
 // Multiply the current matrix by a rotation matrix
@@ -1269,8 +1792,10 @@ void rlRotatef(float angle, float x, float y, float z)
     matRotation.m14 = 0.0f;
     matRotation.m15 = 1.0f;
 
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
+    *RLCTX->currentMatrix = rlMatrixMultiply(matRotation, *RLCTX->currentMatrix);
 }
 
 // Multiply the current matrix by a scaling matrix
@@ -1283,8 +1808,10 @@ void rlScalef(float x, float y, float z)
         0.0f, 0.0f, 0.0f, 1.0f
     };
 
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matScale, *RLGL.State.currentMatrix);
+    *RLCTX->currentMatrix = rlMatrixMultiply(matScale, *RLCTX->currentMatrix);
 }
 
 // Multiply the current matrix by another matrix
@@ -1296,7 +1823,9 @@ void rlMultMatrixf(const float *matf)
                    matf[2], matf[6], matf[10], matf[14],
                    matf[3], matf[7], matf[11], matf[15] };
 
-    *RLGL.State.currentMatrix = rlMatrixMultiply(mat, *RLGL.State.currentMatrix);
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
+    *RLCTX->currentMatrix = rlMatrixMultiply(mat, *RLCTX->currentMatrix);
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
@@ -1328,7 +1857,9 @@ void rlFrustum(double left, double right, double bottom, double top, double znea
     matFrustum.m14 = -((float)zfar*(float)znear*2.0f)/fn;
     matFrustum.m15 = 0.0f;
 
-    *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, matFrustum);
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
+    *RLCTX->currentMatrix = rlMatrixMultiply(*RLCTX->currentMatrix, matFrustum);
 }
 
 // Multiply the current matrix by an orthographic matrix generated by parameters
@@ -1359,7 +1890,9 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
     matOrtho.m14 = -((float)zfar + (float)znear)/fn;
     matOrtho.m15 = 1.0f;
 
-    *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, matOrtho);
+    if (RLCTX->currentMatrix == &RLCTX->transform) rlFlushTransformRun(RLCTX->currentBatch);
+
+    *RLCTX->currentMatrix = rlMatrixMultiply(*RLCTX->currentMatrix, matOrtho);
 }
 #endif
 
@@ -1422,31 +1955,41 @@ void rlBegin(int mode)
 {
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
-    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
+
+    // In deferred draw mode, matrices are registered with the draw call, a change requires a new draw
+    // NOTE: Worker recording contexts do not read renderer state (deferred draw mode is main thread only)
+    if ((RLCTX == &RLGL.Record) && RLGL.State.deferredDraw &&
+        ((memcmp(&RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].modelview, &RLCTX->modelview, sizeof(RaylibMatrix)) != 0) ||
+         (memcmp(&RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].projection, &RLCTX->projection, sizeof(RaylibMatrix)) != 0))) rlNextDrawCall();
+
+    if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode != mode)
     {
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
+        if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount > 0)
         {
-            // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
+            // Make sure current RLCTX->currentBatch->draws[i].vertexCount is aligned a multiple of 4,
             // that way, following QUADS drawing will keep aligned with index processing
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
-            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
-            else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
+            if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_LINES) RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount < 4)? RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount : RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4);
+            else if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4)));
+            else RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = 0;
 
-            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
+            if (!rlCheckRenderBatchLimit(RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment))
             {
-                RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
-                RLGL.currentBatch->drawCounter++;
+                RLCTX->vertexCounter += RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment;
+                RLCTX->currentBatch->drawCounter++;
+                if (RLCTX == &RLGL.Record) RLGL.Stats.modeChanges++;
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLCTX->currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlFlushRenderBatch(&RLGL.Stats.flushDrawCallsLimit);
 
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode = mode;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount = 0;
+        rlSetDrawCallTexture(&RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1], RLGL.State.defaultTextureId);
+        rlSetDrawCallState(&RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1]);
+        RLCTX->texslot = 0;
     }
 }
 
@@ -1456,7 +1999,7 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+    RLCTX->currentBatch->currentDepth += (1.0f/20000.0f);
 }
 
 // Define one vertex (position)
@@ -1468,80 +2011,107 @@ void rlVertex3f(float x, float y, float z)
     float tz = z;
 
     // RaylibTransform provided vector if required
-    if (RLGL.State.transformRequired)
+    // NOTE: Vertex data is transformed by runs on transform matrix change or batch draw (rlFlushTransformRun()),
+    // only persistently mapped vertex data (write-only GPU memory) is transformed per vertex
+    if (RLCTX->transformRequired && RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].dataMapped)
     {
-        tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
-        ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
-        tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
+        tx = RLCTX->transform.m0*x + RLCTX->transform.m4*y + RLCTX->transform.m8*z + RLCTX->transform.m12;
+        ty = RLCTX->transform.m1*x + RLCTX->transform.m5*y + RLCTX->transform.m9*z + RLCTX->transform.m13;
+        tz = RLCTX->transform.m2*x + RLCTX->transform.m6*y + RLCTX->transform.m10*z + RLCTX->transform.m14;
     }
 
     // WARNING: We can't break primitives when launching a new batch.
     // RL_LINES comes in pairs, RL_TRIANGLES come in groups of 3 vertices and RL_QUADS come in groups of 4 vertices.
     // We must check current draw.mode when a new vertex is required and finish the batch only if the draw.mode draw.vertexCount is %2, %3 or %4
-    if (RLGL.State.vertexCounter > (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4))
+    if (RLCTX->vertexCounter > (RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].elementCount*4 - 4))
     {
-        if ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) &&
-            (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%2 == 0))
+        if ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_LINES) &&
+            (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%2 == 0))
         {
             // Reached the maximum number of vertices for RL_LINES drawing
             // Launch a draw call but keep current state for next vertices comming
             // NOTE: We add +1 vertex to the check for security
             rlCheckRenderBatchLimit(2 + 1);
         }
-        else if ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) &&
-            (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%3 == 0))
+        else if ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_TRIANGLES) &&
+            (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%3 == 0))
         {
             rlCheckRenderBatchLimit(3 + 1);
         }
-        else if ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_QUADS) &&
-            (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4 == 0))
+        else if ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_QUADS) &&
+            (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4 == 0))
         {
             rlCheckRenderBatchLimit(4 + 1);
         }
     }
 
-    // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
-
-    // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
-
-    // Add current normal
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter] = RLGL.State.normalx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 1] = RLGL.State.normaly;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 2] = RLGL.State.normalz;
-
-    // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    if (RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].layout != RL_BATCH_LAYOUT_SEPARATE)
+    {
+        // Add vertex with current texcoord, normal and color (interleaved layout)
+        rlBatchVertex *vertex = &RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].data[RLCTX->vertexCounter];
+
+        vertex->position[0] = tx;
+        vertex->position[1] = ty;
+        vertex->position[2] = tz;
+        vertex->texcoord[0] = RLCTX->texcoordx;
+        vertex->texcoord[1] = RLCTX->texcoordy;
+        vertex->normal[0] = RLCTX->normalx;
+        vertex->normal[1] = RLCTX->normaly;
+        vertex->normal[2] = RLCTX->normalz;
+        vertex->color[0] = RLCTX->colorr;
+        vertex->color[1] = RLCTX->colorg;
+        vertex->color[2] = RLCTX->colorb;
+        vertex->color[3] = RLCTX->colora;
+        vertex->texslot = RLCTX->texslot;
+    }
+    else
+    {
+        // Add vertices
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].vertices[3*RLCTX->vertexCounter] = tx;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].vertices[3*RLCTX->vertexCounter + 1] = ty;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].vertices[3*RLCTX->vertexCounter + 2] = tz;
+
+        // Add current texcoord
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].texcoords[2*RLCTX->vertexCounter] = RLCTX->texcoordx;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].texcoords[2*RLCTX->vertexCounter + 1] = RLCTX->texcoordy;
+
+        // Add current normal
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].normals[3*RLCTX->vertexCounter] = RLCTX->normalx;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].normals[3*RLCTX->vertexCounter + 1] = RLCTX->normaly;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].normals[3*RLCTX->vertexCounter + 2] = RLCTX->normalz;
+
+        // Add current color
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].colors[4*RLCTX->vertexCounter] = RLCTX->colorr;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].colors[4*RLCTX->vertexCounter + 1] = RLCTX->colorg;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].colors[4*RLCTX->vertexCounter + 2] = RLCTX->colorb;
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].colors[4*RLCTX->vertexCounter + 3] = RLCTX->colora;
+
+        // Add current texture slot
+        RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].texslots[RLCTX->vertexCounter] = RLCTX->texslot;
+    }
 
-    RLGL.State.vertexCounter++;
-    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+    RLCTX->vertexCounter++;
+    RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount++;
 }
 
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
+    rlVertex3f(x, y, RLCTX->currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
+    rlVertex3f((float)x, (float)y, RLCTX->currentBatch->currentDepth);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: RaylibTexture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-    RLGL.State.texcoordx = x;
-    RLGL.State.texcoordy = y;
+    RLCTX->texcoordx = x;
+    RLCTX->texcoordy = y;
 }
 
 // Define one vertex (normal)
@@ -1551,11 +2121,14 @@ void rlNormal3f(float x, float y, float z)
     float normalx = x;
     float normaly = y;
     float normalz = z;
-    if (RLGL.State.transformRequired)
+
+    // NOTE: Normals are transformed with vertex positions by runs (see rlFlushTransformRun()),
+    // persistently mapped vertex data is not read back so normal is transformed here instead
+    if (RLCTX->transformRequired && RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].dataMapped)
     {
-        normalx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z;
-        normaly = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z;
-        normalz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z;
+        normalx = RLCTX->transform.m0*x + RLCTX->transform.m4*y + RLCTX->transform.m8*z;
+        normaly = RLCTX->transform.m1*x + RLCTX->transform.m5*y + RLCTX->transform.m9*z;
+        normalz = RLCTX->transform.m2*x + RLCTX->transform.m6*y + RLCTX->transform.m10*z;
     }
     float length = sqrtf(normalx*normalx + normaly*normaly + normalz*normalz);
     if (length != 0.0f)
@@ -1565,18 +2138,18 @@ void rlNormal3f(float x, float y, float z)
         normaly *= ilength;
         normalz *= ilength;
     }
-    RLGL.State.normalx = normalx;
-    RLGL.State.normaly = normaly;
-    RLGL.State.normalz = normalz;
+    RLCTX->normalx = normalx;
+    RLCTX->normaly = normaly;
+    RLCTX->normalz = normalz;
 }
 
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
-    RLGL.State.colorr = x;
-    RLGL.State.colorg = y;
-    RLGL.State.colorb = z;
-    RLGL.State.colora = w;
+    RLCTX->colorr = x;
+    RLCTX->colorg = y;
+    RLCTX->colorb = z;
+    RLCTX->colora = w;
 }
 
 // Define one vertex (color)
@@ -1593,6 +2166,38 @@ void rlColor3f(float x, float y, float z)
 
 #endif
 
+// Push multiple quads at once
+// NOTE: Equivalent to rlSetTexture() + rlBegin(RL_QUADS) + 4*count rlVertex3f() + rlEnd(),
+// batch limit is checked once per chunk and vertex data is copied directly into the batch
+bool rlPushQuads(const rlQuad *quads, int count, unsigned int textureId)
+{
+    bool result = false;
+
+    if ((quads != NULL) && (count > 0)) result = rlPushPrimitives(quads[0].vertices, count, RL_QUADS, textureId);
+
+    return result;
+}
+
+// Push multiple triangles at once
+bool rlPushTriangles(const rlTriangle *triangles, int count, unsigned int textureId)
+{
+    bool result = false;
+
+    if ((triangles != NULL) && (count > 0)) result = rlPushPrimitives(triangles[0].vertices, count, RL_TRIANGLES, textureId);
+
+    return result;
+}
+
+// Get current depth value, used as z by rlVertex2f()
+float rlGetCurrentDepth(void)
+{
+    float depth = 0.0f;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    depth = RLCTX->currentBatch->currentDepth;
+#endif
+    return depth;
+}
+
 //--------------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL style functions (common to 1.1, 3.3+, ES2)
 //--------------------------------------------------------------------------------------
@@ -1606,10 +2211,10 @@ void rlSetTexture(unsigned int id)
         rlDisableTexture();
 #else
         // NOTE: If quads batch limit is reached, we force a draw call and next batch starts
-        if (RLGL.State.vertexCounter >=
-            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
+        if (RLCTX->vertexCounter >=
+            RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].elementCount*4)
         {
-            rlDrawRenderBatch(RLGL.currentBatch);
+            rlFlushRenderBatch(&RLGL.Stats.flushBufferFull);
         }
 #endif
     }
@@ -1618,31 +2223,59 @@ void rlSetTexture(unsigned int id)
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+        rlDrawCall *draw = &RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1];
+        int slot = -1;
+
+        // Check if texture is already bound to current draw call
+        for (int i = 0; i < draw->textureCount; i++)
+        {
+            if (draw->textureIds[i] == id)
+            {
+                slot = i;
+                break;
+            }
+        }
+
+        if (slot >= 0) RLCTX->texslot = (unsigned char)slot;
+        else if ((draw->vertexCount > 0) && (draw->mode == RL_QUADS) &&
+                 (draw->textureCount < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS) &&
+                 (RLGL.State.multiTextureShaderId > 0) && ((RLCTX != &RLGL.Record) || (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)))
         {
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
+            // Add texture to current draw call on next texture unit, no new draw call required,
+            // following vertex select it by texture slot on default shader multi-texture variant
+            // NOTE: Only QUADS draws are extended, rlBegin() resets draw call texture on mode change
+            draw->textureIds[draw->textureCount] = id;
+            RLCTX->texslot = (unsigned char)draw->textureCount;
+            draw->textureCount++;
+        }
+        else
+        {
+            if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount > 0)
             {
-                // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
+                // Make sure current RLCTX->currentBatch->draws[i].vertexCount is aligned a multiple of 4,
                 // that way, following QUADS drawing will keep aligned with index processing
                 // It implies adding some extra alignment vertex at the end of the draw,
                 // those vertex are not processed but they are considered as an additional offset
                 // for the next set of vertex to be drawn
-                if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
-                else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
-                else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
+                if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_LINES) RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount < 4)? RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount : RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4);
+                else if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4)));
+                else RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = 0;
 
-                if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
+                if (!rlCheckRenderBatchLimit(RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment))
                 {
-                    RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
+                    RLCTX->vertexCounter += RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment;
 
-                    RLGL.currentBatch->drawCounter++;
+                    RLCTX->currentBatch->drawCounter++;
+                    if (RLCTX == &RLGL.Record) RLGL.Stats.textureChanges++;
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLCTX->currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlFlushRenderBatch(&RLGL.Stats.flushDrawCallsLimit);
 
-            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
-            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            rlSetDrawCallTexture(&RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1], id);
+            RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount = 0;
+            rlSetDrawCallState(&RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1]);
+            RLCTX->texslot = 0;
         }
 #endif
     }
@@ -1652,7 +2285,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(slot);
 #endif
 }
 
@@ -1662,7 +2295,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
 }
 
 // Disable texture
@@ -1671,14 +2304,14 @@ void rlDisableTexture(void)
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTextureCubemap(id);
 #endif
 }
 
@@ -1686,14 +2319,14 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTextureCubemap(0);
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
 
 #if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1735,14 +2368,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
 void rlCubemapParameters(unsigned int id, int param, int value)
 {
 #if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTextureCubemap(id);
 
     // Reset anisotropy filter, in case it was set
     glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
@@ -1778,7 +2411,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTextureCubemap(0);
 #endif
 }
 
@@ -1786,7 +2419,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlCacheUseProgram(id);
 #endif
 }
 
@@ -1794,7 +2427,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 #endif
 }
 
@@ -1802,7 +2435,7 @@ void rlDisableShader(void)
 void rlEnableFramebuffer(unsigned int id)
 {
 #if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, id);
 #endif
 }
 
@@ -1820,7 +2453,7 @@ unsigned int rlGetActiveFramebuffer(void)
 void rlDisableFramebuffer(void)
 {
 #if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
 
@@ -1836,7 +2469,7 @@ void rlBlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX
 void rlBindFramebuffer(unsigned int target, unsigned int framebuffer)
 {
 #if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(target, framebuffer);
+    rlCacheBindFramebuffer(target, framebuffer);
 #endif
 }
 
@@ -2018,6 +2651,57 @@ bool rlIsStereoRenderEnabled(void)
 #endif
 }
 
+// Enable deferred draw mode
+// NOTE: Shader, blending (not custom), layer and matrix changes register a new draw call instead of
+// forcing a batch draw, draw calls are sorted by (layer, shader, blend, texture) when batch is drawn and
+// consecutive draws sharing state are merged, painter's order is kept within a layer for draws overlapping
+// on screen, shader uniforms set through the batch are shared by all the draws using that shader
+void rlEnableDeferredDraw(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.deferredDraw)
+    {
+        rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
+        RLGL.State.deferredDraw = true;
+    }
+#endif
+}
+
+// Disable deferred draw mode
+void rlDisableDeferredDraw(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.deferredDraw)
+    {
+        rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
+        RLGL.State.deferredDraw = false;
+    }
+#endif
+}
+
+// Check if deferred draw mode is enabled
+bool rlIsDeferredDrawEnabled(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.deferredDraw;
+#else
+    return false;
+#endif
+}
+
+// Set current draw layer
+// NOTE: Layer is only considered in deferred draw mode
+void rlSetDrawLayer(int layer)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentLayer != layer)
+    {
+        RLGL.State.currentLayer = layer;
+        if (RLGL.State.deferredDraw) rlNextDrawCall();
+    }
+#endif
+}
+
 // Clear color buffer with color
 void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
 {
@@ -2065,37 +2749,25 @@ void rlCheckErrors(void)
 void rlSetBlendMode(int mode)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
+    if (RLGL.State.deferredDraw && (RLGL.State.currentBlendMode != mode) &&
+        (RLGL.State.currentBlendMode != RL_BLEND_CUSTOM) && (RLGL.State.currentBlendMode != RL_BLEND_CUSTOM_SEPARATE) &&
+        (mode != RL_BLEND_CUSTOM) && (mode != RL_BLEND_CUSTOM_SEPARATE))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
-
-        switch (mode)
-        {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
-
-            } break;
-            case RL_BLEND_CUSTOM_SEPARATE:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+        // Deferred draw mode: blending mode is registered with the draw call and applied on batch draw
+        // NOTE: Custom blending modes always force a batch draw, blending factors are not recorded
+        RLGL.State.currentBlendMode = mode;
+        rlNextDrawCall();
+    }
+    else if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
+    {
+        rlFlushRenderBatch(&RLGL.Stats.flushBlendChange);
 
-            } break;
-            default: break;
-        }
+        rlApplyBlendMode(mode);
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
     }
+    else RLGL.Stats.stateChangesSkipped++;
 #endif
 }
 
@@ -2206,6 +2878,10 @@ static void GLAPIENTRY rlDebugMessageCallback(GLenum source, GLenum type, GLuint
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+    // Init GL state cache, current OpenGL state is unknown
+    rlInvalidateStateCache();
+    rlResetRenderStats();
+
     // Enable OpenGL debug context if required
 #if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT) && defined(RAYLIB_GRAPHICS_API_OPENGL_43)
     if ((glDebugMessageCallback != NULL) && (glDebugMessageControl != NULL))
@@ -2222,6 +2898,9 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // Init main thread recording context, it holds the immediate-mode state used by rlVertex*()/matrix functions
+    RLCTX = &RLGL.Record;
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2240,16 +2919,16 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
     RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = -1;
-    RLGL.currentBatch = &RLGL.defaultBatch;
+    RLCTX->currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
-    for (int i = 0; i < RL_MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = rlMatrixIdentity();
+    for (int i = 0; i < RL_MAX_MATRIX_STACK_SIZE; i++) RLCTX->stack[i] = rlMatrixIdentity();
 
     // Init internal matrices
-    RLGL.State.transform = rlMatrixIdentity();
-    RLGL.State.projection = rlMatrixIdentity();
-    RLGL.State.modelview = rlMatrixIdentity();
-    RLGL.State.currentMatrix = &RLGL.State.modelview;
+    RLCTX->transform = rlMatrixIdentity();
+    RLCTX->projection = rlMatrixIdentity();
+    RLCTX->modelview = rlMatrixIdentity();
+    RLCTX->currentMatrix = &RLCTX->modelview;
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
 
     // Initialize OpenGL default states
@@ -2300,10 +2979,58 @@ void rlglClose(void)
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    RL_FREE(RLGL.State.sortBuffer);   // Unload draw calls sorting buffer (deferred draw mode)
+    RLGL.State.sortBuffer = NULL;
+    RLGL.State.sortBufferSize = 0;
+
+    // Unload display lists recording data
+    if (RLGL.State.displayListBatch.vertexBuffer != NULL) rlUnloadRenderBatch(RLGL.State.displayListBatch);
+    memset(&RLGL.State.displayListBatch, 0, sizeof(rlRenderBatch));
+    RL_FREE(RLGL.Record.captureVertices);
+    RL_FREE(RLGL.Record.captureDraws);
+    RLGL.Record.captureVertices = NULL;
+    RLGL.Record.captureDraws = NULL;
+    RLGL.Record.captureVertexCapacity = 0;
+    RLGL.Record.captureDrawCapacity = 0;
+
     rlUnloadShaderDefault();          // Unload default shader
 
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    // Unload screen readbacks pixel pack buffers
+    for (int i = 0; i < RL_MAX_SCREEN_READBACKS; i++)
+    {
+        if (RLGL.Readbacks[i].syncFence != NULL) glDeleteSync((GLsync)RLGL.Readbacks[i].syncFence);
+        if (RLGL.Readbacks[i].pboId != 0) glDeleteBuffers(1, &RLGL.Readbacks[i].pboId);
+    }
+    memset(RLGL.Readbacks, 0, sizeof(RLGL.Readbacks));
+
+    // Unload GPU timer queries
+    for (int i = 0; i < RL_GPU_TIMER_FRAMES; i++)
+    {
+        if (RLGL.GpuTimers.frames[i].queryIds[0] != 0) glDeleteQueries(RL_MAX_GPU_TIMERS*2, RLGL.GpuTimers.frames[i].queryIds);
+    }
+    memset(&RLGL.GpuTimers, 0, sizeof(RLGL.GpuTimers));
+
+    // Unload camera matrices uniform buffer
+    if (RLGL.CameraBlock.uboId != 0) glDeleteBuffers(1, &RLGL.CameraBlock.uboId);
+    memset(&RLGL.CameraBlock, 0, sizeof(RLGL.CameraBlock));
+#endif
+
+    memset(&RLGL.UniformLocations, 0, sizeof(RLGL.UniformLocations));
+
+    RL_FREE(RLGL.TexSlotShaders.shaderIds);
+    memset(&RLGL.TexSlotShaders, 0, sizeof(RLGL.TexSlotShaders));
+
+    rlUnloadTexture(RLGL.State.defaultTextureId); // Unload default texture
     RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
+
+#if defined(RLGL_NULL_BACKEND)
+    // Unload null backend trace and buffers memory (mapped buffers not unmapped)
+    for (unsigned int i = 0; i < RLGL.NullBackend.bufferCapacity; i++) RL_FREE(RLGL.NullBackend.buffers[i].mapped);
+    RL_FREE(RLGL.NullBackend.buffers);
+    RL_FREE(RLGL.NullBackend.commands);
+    memset(&RLGL.NullBackend, 0, sizeof(RLGL.NullBackend));
+#endif
 #endif
 }
 
@@ -2311,6 +3038,13 @@ void rlglClose(void)
 // NOTE: External loader function must be provided
 void rlLoadExtensions(void *loader)
 {
+#if defined(RLGL_NULL_BACKEND)
+    // Provided loader is ignored, OpenGL functions are resolved to null backend recording stubs
+    loader = (void *)rlNullGetProcAddress;
+    if (RLGL.NullBackend.commands == NULL) RLGL.NullBackend.commands = (rlNullCommand *)RL_CALLOC(RL_NULL_TRACE_MAX_COMMANDS, sizeof(rlNullCommand));
+    RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Null backend enabled, OpenGL commands are recorded but not executed");
+#endif
+
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33)     // Also defined for RAYLIB_GRAPHICS_API_OPENGL_21
     // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
     if (gladLoadGL((GLADloadfunc)loader) == 0) RAYLIB_TRACELOG(RL_LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
@@ -2340,6 +3074,12 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = GLAD_GL_EXT_texture_filter_anisotropic;
     RLGL.ExtSupported.texMirrorClamp = GLAD_GL_EXT_texture_mirror_clamp;
+    RLGL.ExtSupported.texCompRGTC = GLAD_GL_VERSION_3_0;   // Core since OpenGL 3.0
+    RLGL.ExtSupported.sync = (GLAD_GL_VERSION_3_2 && GLAD_GL_ARB_map_buffer_range);
+    RLGL.ExtSupported.bufferStorage = (RLGL.ExtSupported.sync && GLAD_GL_ARB_buffer_storage);
+    RLGL.ExtSupported.timerQuery = GLAD_GL_ARB_timer_query;
+    RLGL.ExtSupported.programBinary = GLAD_GL_ARB_get_program_binary;
+    RLGL.ExtSupported.ubo = GLAD_GL_ARB_uniform_buffer_object;
 #else
     // Register supported extensions flags
     // OpenGL 3.3 extensions supported by default (core)
@@ -2352,8 +3092,22 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.texCompRGTC = true;
+    RLGL.ExtSupported.sync = true;
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;   // Core since OpenGL 4.4
+    RLGL.ExtSupported.timerQuery = true;
+    RLGL.ExtSupported.programBinary = (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary);   // Core since OpenGL 4.1
+    RLGL.ExtSupported.ubo = true;
 #endif
 
+    // Program binaries require at least one binary format supported by driver
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats == 0) RLGL.ExtSupported.programBinary = false;
+    }
+
     // Optional OpenGL 3.3 extensions
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // RaylibTexture compression: DXT
@@ -2361,6 +3115,7 @@ void rlLoadExtensions(void *loader)
     #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
+    RLGL.ExtSupported.drawIndirect = (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect);   // Core since OpenGL 4.3
     #endif
 
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33
@@ -2497,6 +3252,10 @@ void rlLoadExtensions(void *loader)
         // Check texture compression support: ASTC
         if (strcmp(extList[i], (const char *)"GL_KHR_texture_compression_astc_hdr") == 0) RLGL.ExtSupported.texCompASTC = true;
 
+        // Check texture compression support: RGTC (BC4/BC5)
+        if ((strcmp(extList[i], (const char *)"GL_EXT_texture_compression_rgtc") == 0) ||
+            (strcmp(extList[i], (const char *)"GL_ARB_texture_compression_rgtc") == 0)) RLGL.ExtSupported.texCompRGTC = true;
+
         // Check anisotropic texture filter support
         if (strcmp(extList[i], (const char *)"GL_EXT_texture_filter_anisotropic") == 0) RLGL.ExtSupported.texAnisoFilter = true;
 
@@ -2569,8 +3328,10 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompETC2) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: ETC2/EAC compressed textures supported");
     if (RLGL.ExtSupported.texCompPVRT) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: PVRT compressed textures supported");
     if (RLGL.ExtSupported.texCompASTC) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
+    if (RLGL.ExtSupported.texCompRGTC) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: RGTC (BC4/BC5) compressed textures supported");
     if (RLGL.ExtSupported.computeShader) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: RaylibShader storage buffer objects supported");
+    if (RLGL.ExtSupported.drawIndirect) RAYLIB_TRACELOG(RL_LOG_INFO, "GL: Indirect multi-draw supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
@@ -2670,6 +3431,18 @@ int *rlGetShaderLocsDefault(void)
 //------------------------------------------------------------------------------------------------
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchEx(numBuffers, bufferElements, RL_DEFAULT_BATCH_VERTEX_LAYOUT);
+}
+
+// Load render batch with a vertex data layout
+// NOTE: RL_BATCH_LAYOUT_INTERLEAVED packs all attributes in a single VBO,
+// so only one buffer upload is required per batch draw
+// RL_BATCH_LAYOUT_INTERLEAVED_STREAM uses one VBO split in numBuffers regions, every region
+// is fenced after being drawn and only waited on when it has to be written again, vertex data is
+// written directly into a persistently mapped buffer if supported (GL_ARB_buffer_storage),
+// uploaded with unsynchronized mapping otherwise or orphaning the buffer on OpenGL ES 2.0
+rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int layout)
 {
     rlRenderBatch batch = { 0 };
 
@@ -2681,11 +3454,32 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
-
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        batch.vertexBuffer[i].layout = layout;
+        batch.vertexBuffer[i].data = NULL;
+        batch.vertexBuffer[i].vertices = NULL;
+        batch.vertexBuffer[i].texcoords = NULL;
+        batch.vertexBuffer[i].normals = NULL;
+        batch.vertexBuffer[i].colors = NULL;
+        batch.vertexBuffer[i].texslots = NULL;
+        batch.vertexBuffer[i].syncFence = NULL;
+        batch.vertexBuffer[i].dataMapped = false;
+
+        if (layout == RL_BATCH_LAYOUT_INTERLEAVED)
+        {
+            batch.vertexBuffer[i].data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+        }
+        else if (layout == RL_BATCH_LAYOUT_INTERLEAVED_STREAM)
+        {
+            // NOTE: Vertex data is assigned on GPU buffer creation, it could be mapped GPU memory
+        }
+        else
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].normals = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));         // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+            batch.vertexBuffer[i].texslots = (unsigned char *)RL_CALLOC(bufferElements*4, sizeof(unsigned char));   // 1 slot by vertex, 4 vertex by quad
+        }
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2693,10 +3487,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
 
         int k = 0;
 
@@ -2713,7 +3503,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             k++;
         }
 
-        RLGL.State.vertexCounter = 0;
+        RLCTX->vertexCounter = 0;
+        RLCTX->transformRunStart = 0;
     }
 
     RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in RAM (CPU)");
@@ -2721,43 +3512,127 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
     //--------------------------------------------------------------------------------------------
+    unsigned int streamVboId = 0;
+    int regionSize = bufferElements*4*sizeof(rlBatchVertex);    // Stream buffer region size in bytes (one per batch buffer)
+
+    if (layout == RL_BATCH_LAYOUT_INTERLEAVED_STREAM)
+    {
+        if (numBuffers < 2) RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Streaming render batch requires 2 or more buffers to avoid GPU stalls");
+
+        unsigned char *streamData = NULL;
+
+        glGenBuffers(1, &streamVboId);
+        glBindBuffer(GL_ARRAY_BUFFER, streamVboId);
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+        if (RLGL.ExtSupported.bufferStorage)
+        {
+            // Immutable storage, persistently mapped: vertex data is written directly in GPU visible memory
+            glBufferStorage(GL_ARRAY_BUFFER, numBuffers*regionSize, NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+            streamData = (unsigned char *)glMapBufferRange(GL_ARRAY_BUFFER, 0, numBuffers*regionSize, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+            if (streamData == NULL) RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch stream buffer, using buffer uploads");
+        }
+        else
+#endif
+        {
+            glBufferData(GL_ARRAY_BUFFER, numBuffers*regionSize, NULL, GL_STREAM_DRAW);
+        }
+
+        for (int i = 0; i < numBuffers; i++)
+        {
+            if (streamData != NULL)
+            {
+                batch.vertexBuffer[i].data = (rlBatchVertex *)(streamData + i*regionSize);
+                batch.vertexBuffer[i].dataMapped = true;
+            }
+            else batch.vertexBuffer[i].data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));
+        }
+
+        RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch stream buffer loaded successfully (%i regions, %s)", numBuffers, (streamData != NULL)? "persistent mapped" : "streamed uploads");
+    }
+
     for (int i = 0; i < numBuffers; i++)
     {
         if (RLGL.ExtSupported.vao)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (layout != RL_BATCH_LAYOUT_SEPARATE)
+        {
+            // Quads - Single interleaved vertex buffer, attributes defined by stride and offset
+            // NOTE: Streaming layout shares the VBO, every buffer points to its own region
+            size_t baseOffset = 0;
+
+            if (layout == RL_BATCH_LAYOUT_INTERLEAVED_STREAM)
+            {
+                batch.vertexBuffer[i].vboId[0] = streamVboId;
+                baseOffset = (size_t)i*regionSize;
+                glBindBuffer(GL_ARRAY_BUFFER, streamVboId);
+            }
+            else
+            {
+                glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+                glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+                glBufferData(GL_ARRAY_BUFFER, regionSize, batch.vertexBuffer[i].data, GL_DYNAMIC_DRAW);
+            }
+
+            batch.vertexBuffer[i].vboId[1] = 0;
+            batch.vertexBuffer[i].vboId[2] = 0;
+            batch.vertexBuffer[i].vboId[3] = 0;
+            batch.vertexBuffer[i].vboId[5] = 0;
+
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, position)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, texcoord)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, normal)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, color)));
+            // NOTE: Texture slot attribute is enabled on draw, only for shaders declaring it (see rlSetTexSlotAttrib())
+            glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, texslot)));
+        }
+        else
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex normal buffer (shader-location = 2)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+            // Vertex texture slot buffer (shader-location = 6)
+            // NOTE: Attribute is enabled on draw, only for shaders declaring it (see rlSetTexSlotAttrib())
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[5]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[5]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(unsigned char), batch.vertexBuffer[i].texslots, GL_DYNAMIC_DRAW);
+            glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
@@ -2773,7 +3648,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2786,15 +3661,15 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.draws[i].vertexCount = 0;
         batch.draws[i].vertexAlignment = 0;
         //batch.draws[i].vaoId = 0;
-        //batch.draws[i].shaderId = 0;
-        batch.draws[i].textureId = RLGL.State.defaultTextureId;
-        //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
-        //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
+        rlSetDrawCallTexture(&batch.draws[i], RLGL.State.defaultTextureId);
+        rlSetDrawCallState(&batch.draws[i]);
     }
 
     batch.bufferCount = numBuffers;    // Record buffer count
     batch.drawCounter = 1;             // Reset draws counter
     batch.currentDepth = -1.0f;         // Reset depth value
+    batch.fenceWaitCount = 0;          // Reset fence wait counters
+    batch.fenceStallCount = 0;
     //--------------------------------------------------------------------------------------------
 #endif
 
@@ -2815,29 +3690,51 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+            rlCacheBindVertexArray(0);
+        }
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+        // Delete stream region fence, GPU could still be reading from the mapped buffer
+        if (batch.vertexBuffer[i].syncFence != NULL)
+        {
+            glClientWaitSync((GLsync)batch.vertexBuffer[i].syncFence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            glDeleteSync((GLsync)batch.vertexBuffer[i].syncFence);
+            batch.vertexBuffer[i].syncFence = NULL;
+        }
+
+        if ((i == 0) && batch.vertexBuffer[i].dataMapped)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
         }
+#endif
 
         // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        // NOTE: Streaming layout buffers share a single VBO
+        if ((batch.vertexBuffer[i].layout != RL_BATCH_LAYOUT_INTERLEAVED_STREAM) || (i == 0)) glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[5]);
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
+        if (!batch.vertexBuffer[i].dataMapped) RL_FREE(batch.vertexBuffer[i].data);
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].normals);
         RL_FREE(batch.vertexBuffer[i].colors);
+        RL_FREE(batch.vertexBuffer[i].texslots);
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2852,34 +3749,93 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // Transform pending vertex run, vertex data must be final before sorting and upload
+    rlFlushTransformRun(batch);
+
+    // Sort batch draw calls by state and merge them (deferred draw mode)
+    if (RLGL.State.deferredDraw && (RLCTX->vertexCounter > 0)) rlSortRenderBatch(batch);
+
+    if (RLCTX->vertexCounter > 0) RLGL.Stats.batchFlushes++;
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    if (RLCTX->vertexCounter > 0)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+        if (batch->vertexBuffer[batch->currentBuffer].layout == RL_BATCH_LAYOUT_INTERLEAVED)
+        {
+            // Interleaved vertex buffer, all attributes updated with a single upload
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLCTX->vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].data);
+            RLGL.Stats.uploadedBytes += RLCTX->vertexCounter*sizeof(rlBatchVertex);
+        }
+        else if (batch->vertexBuffer[batch->currentBuffer].layout == RL_BATCH_LAYOUT_INTERLEAVED_STREAM)
+        {
+            // Stream buffer region, no upload required if vertex data is persistently mapped
+            // NOTE: Region is guaranteed to be free by the fence waited on buffer switch,
+            // persistently mapped data is also registered as uploaded (written to GPU visible memory)
+            RLGL.Stats.uploadedBytes += RLCTX->vertexCounter*sizeof(rlBatchVertex);
+#if defined(RLGL_NULL_BACKEND)
+            // Persistently mapped data is written with no OpenGL call, registered as uploaded on null backend trace
+            if (batch->vertexBuffer[batch->currentBuffer].dataMapped) rlNullRecord(RL_NULL_COMMAND_BUFFER_UPLOAD, GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0], 0, 0, RLCTX->vertexCounter*sizeof(rlBatchVertex));
+#endif
 
-        // RaylibTexture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+            if (!batch->vertexBuffer[batch->currentBuffer].dataMapped)
+            {
+                int regionSize = batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlBatchVertex);
+                int dataSize = RLCTX->vertexCounter*sizeof(rlBatchVertex);
 
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+                void *regionData = NULL;
+                if (RLGL.ExtSupported.sync) regionData = glMapBufferRange(GL_ARRAY_BUFFER, batch->currentBuffer*regionSize, dataSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+                if (regionData != NULL)
+                {
+                    memcpy(regionData, batch->vertexBuffer[batch->currentBuffer].data, dataSize);
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                }
+                else glBufferSubData(GL_ARRAY_BUFFER, batch->currentBuffer*regionSize, dataSize, batch->vertexBuffer[batch->currentBuffer].data);
+#endif
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+                // Orphan buffer storage, driver allocates a new one instead of waiting for the GPU to release it
+                glBufferData(GL_ARRAY_BUFFER, batch->bufferCount*regionSize, NULL, GL_STREAM_DRAW);
+                glBufferSubData(GL_ARRAY_BUFFER, batch->currentBuffer*regionSize, dataSize, batch->vertexBuffer[batch->currentBuffer].data);
+#endif
+            }
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLCTX->vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // RaylibTexture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLCTX->vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Normals buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLCTX->vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLCTX->vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+
+            // Texture slots buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[5]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLCTX->vertexCounter*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].texslots);
+
+            RLGL.Stats.uploadedBytes += RLCTX->vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 3*sizeof(float) + 4*sizeof(unsigned char) + sizeof(unsigned char));
+        }
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2897,14 +3853,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
         // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     }
     //------------------------------------------------------------------------------------------------------------
 
     // Draw batch vertex buffers (considering VR stereo if required)
     //------------------------------------------------------------------------------------------------------------
-    RaylibMatrix matProjection = RLGL.State.projection;
-    RaylibMatrix matModelView = RLGL.State.modelview;
+    RaylibMatrix matProjection = RLCTX->projection;
+    RaylibMatrix matModelView = RLCTX->modelview;
 
     int eyeCount = 1;
     if (RLGL.State.stereoRender) eyeCount = 2;
@@ -2920,42 +3876,40 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             rlSetMatrixModelview(rlMatrixMultiply(matModelView, RLGL.State.viewOffsetStereo[eye]));
             // Set current eye projection matrix
             rlSetMatrixProjection(RLGL.State.projectionStereo[eye]);
+            // Set current eye camera uniform block
+            rlSetUniformBlockCameraEye(eye);
         }
 
         // Draw buffers
-        if (RLGL.State.vertexCounter > 0)
+        if (RLCTX->vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlCacheUseProgram(RLGL.State.currentShaderId);
 
-            // Create modelview-projection matrix and upload to shader
-            RaylibMatrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            // Upload current matrices to shader: mvp, projection, view, model and normal
+            rlSetDrawUniforms(RLGL.State.currentShaderLocs, RLCTX->projection, RLCTX->modelview);
 
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+            if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            else if (batch->vertexBuffer[batch->currentBuffer].layout != RL_BATCH_LAYOUT_SEPARATE)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
-            }
+                // Bind interleaved vertex attribs: position, texcoord, normal, color (shader-location = 0..3)
+                // NOTE: Streaming layout requires offsetting attributes to current buffer region
+                size_t baseOffset = 0;
+                if (batch->vertexBuffer[batch->currentBuffer].layout == RL_BATCH_LAYOUT_INTERLEAVED_STREAM) baseOffset = (size_t)batch->currentBuffer*batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlBatchVertex);
 
-            // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
-            // transformations and rendering occur between rlPushMatrix and rlPopMatrix.
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, position)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, texcoord)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, normal)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, color)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+                glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)(baseOffset + offsetof(rlBatchVertex, texslot)));
 
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
             }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
-            }
-
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -2978,6 +3932,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
 
+                // Bind vertex attrib: texture slot (shader-location = 6)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[5]);
+                glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
             }
 
@@ -2991,19 +3949,91 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlCacheActiveTexture(1 + i);
+                    rlCacheBindTexture(RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlCacheActiveTexture(0);
+
+            // Draw call state currently applied (deferred draw mode, multi-texture draws)
+            unsigned int drawShaderId = RLGL.State.currentShaderId;
+            rlSetTexSlotAttrib(drawShaderId);
+            int drawBlendMode = RLGL.State.currentBlendMode;
+            RaylibMatrix drawProjection = matProjection;
+            RaylibMatrix drawModelview = matModelView;
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                unsigned int shaderId = RLGL.State.currentShaderId;
+                int *shaderLocs = RLGL.State.currentShaderLocs;
+
+                if (RLGL.State.deferredDraw)
+                {
+                    shaderId = batch->draws[i].shaderId;
+                    shaderLocs = batch->draws[i].shaderLocs;
+                }
+
+                // Draw calls with multiple textures use default shader multi-texture variant
+                if ((batch->draws[i].textureCount > 1) && (shaderId == RLGL.State.defaultShaderId))
+                {
+                    shaderId = RLGL.State.multiTextureShaderId;
+                    shaderLocs = RLGL.State.multiTextureShaderLocs;
+                }
+
+                bool shaderChanged = (shaderId != drawShaderId);
+
+                if (shaderChanged)
+                {
+                    rlCacheUseProgram(shaderId);
+                    rlSetTexSlotAttrib(shaderId);
+                    glUniform4f(shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                    glUniform1i(shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+                    drawShaderId = shaderId;
+                }
+
+                if (RLGL.State.deferredDraw)
+                {
+                    // Apply draw call matrices, only if shader or matrices changed from previous draw call
+                    if (shaderChanged ||
+                        (memcmp(&batch->draws[i].projection, &drawProjection, sizeof(RaylibMatrix)) != 0) ||
+                        (memcmp(&batch->draws[i].modelview, &drawModelview, sizeof(RaylibMatrix)) != 0))
+                    {
+                        drawProjection = batch->draws[i].projection;
+                        drawModelview = batch->draws[i].modelview;
+
+                        if (eyeCount == 2) rlSetDrawUniforms(shaderLocs, RLGL.State.projectionStereo[eye], rlMatrixMultiply(drawModelview, RLGL.State.viewOffsetStereo[eye]));
+                        else rlSetDrawUniforms(shaderLocs, drawProjection, drawModelview);
+                    }
+
+                    if (batch->draws[i].blendMode != drawBlendMode)
+                    {
+                        rlApplyBlendMode(batch->draws[i].blendMode);
+                        drawBlendMode = batch->draws[i].blendMode;
+                    }
+                }
+                else if (shaderChanged) rlSetDrawUniforms(shaderLocs, RLCTX->projection, RLCTX->modelview);
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlCacheBindTexture(batch->draws[i].textureId);
+
+                // Bind additional draw call textures (multi-texture draws), texture units 1..textureCount-1
+                // NOTE: Those units could be used by additional sampler textures (activeTextureId), they are restored after the draw
+                for (int k = 1; k < batch->draws[i].textureCount; k++)
+                {
+                    rlCacheActiveTexture(k);
+                    rlCacheBindTexture(batch->draws[i].textureIds[k]);
+                }
+
+                if (batch->draws[i].textureCount > 1) rlCacheActiveTexture(0);
+
+                if (batch->draws[i].vertexCount > 0)
+                {
+                    RLGL.Stats.drawCalls++;
+                    RLGL.Stats.vertexCount += batch->draws[i].vertexCount;
+                }
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3019,21 +4049,36 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 #endif
                 }
 
+                // Restore additional sampler textures overwritten by multi-texture draw
+                for (int k = 1; k < batch->draws[i].textureCount; k++)
+                {
+                    if (RLGL.State.activeTextureId[k - 1] > 0)
+                    {
+                        rlCacheActiveTexture(k);
+                        rlCacheBindTexture(RLGL.State.activeTextureId[k - 1]);
+                        rlCacheActiveTexture(0);
+                    }
+                }
+
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
+            // Restore current blending mode (deferred draw mode)
+            if (drawBlendMode != RLGL.State.currentBlendMode) rlApplyBlendMode(RLGL.State.currentBlendMode);
+
             if (!RLGL.ExtSupported.vao)
             {
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlCacheBindTexture(0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlCacheUseProgram(0);    // Unbind shader program
     }
 
     // Restore viewport to default measures
@@ -3043,23 +4088,29 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
-    RLGL.State.vertexCounter = 0;
+    RLCTX->vertexCounter = 0;
+    RLCTX->transformRunStart = 0;
 
     // Reset depth for next draw
     batch->currentDepth = -1.0f;
 
     // Restore projection/modelview matrices
-    RLGL.State.projection = matProjection;
-    RLGL.State.modelview = matModelView;
+    RLCTX->projection = matProjection;
+    RLCTX->modelview = matModelView;
 
-    // Reset RLGL.currentBatch->draws array
+    // Reset RLCTX->currentBatch->draws array
     for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
-        batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].vertexAlignment = 0;
+        rlSetDrawCallTexture(&batch->draws[i], RLGL.State.defaultTextureId);
     }
 
+    // Register current state for first draw of next batch
+    rlSetDrawCallState(&batch->draws[0]);
+    RLCTX->texslot = 0;
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
@@ -3067,9 +4118,41 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     batch->drawCounter = 1;
     //------------------------------------------------------------------------------------------------------------
 
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    // Fence current stream buffer region, it can not be written again until GPU is done reading it
+    if ((batch->vertexBuffer[batch->currentBuffer].layout == RL_BATCH_LAYOUT_INTERLEAVED_STREAM) && RLGL.ExtSupported.sync)
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].syncFence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].syncFence);
+        batch->vertexBuffer[batch->currentBuffer].syncFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    // Wait for next stream buffer region to be released by the GPU before writing on it
+    // NOTE: Fence is polled first, only a non-signaled fence blocks (and is counted as a stall)
+    if (batch->vertexBuffer[batch->currentBuffer].syncFence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].syncFence;
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        batch->fenceWaitCount++;
+
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            batch->fenceStallCount++;
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        }
+
+        if (result == GL_WAIT_FAILED) RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Render batch fence wait failed");
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].syncFence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -3077,10 +4160,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 void rlSetRenderBatchActive(rlRenderBatch *batch)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    rlDrawRenderBatch(RLGL.currentBatch);
+    rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
 
-    if (batch != NULL) RLGL.currentBatch = batch;
-    else RLGL.currentBatch = &RLGL.defaultBatch;
+    if (batch != NULL) RLCTX->currentBatch = batch;
+    else RLCTX->currentBatch = &RLGL.defaultBatch;
 #endif
 }
 
@@ -3088,8 +4171,28 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 void rlDrawRenderBatchActive(void)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+    rlFlushRenderBatch(&RLGL.Stats.flushExplicit);    // NOTE: Stereo rendering is checked inside
+#endif
+}
+
+// Update and draw internal render batch, registering the reason on render statistics
+void rlDrawRenderBatchActiveEx(int reason)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (reason == RL_BATCH_FLUSH_MATRIX_CHANGE) rlFlushRenderBatch(&RLGL.Stats.flushMatrixChange);
+    else rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
+#endif
+}
+
+// Get number of times active render batch blocked waiting for a GPU fence
+// NOTE: Only streaming layout batches (RL_BATCH_LAYOUT_INTERLEAVED_STREAM) use fences
+unsigned int rlGetRenderBatchStallCount(void)
+{
+    unsigned int count = 0;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    count = RLCTX->currentBatch->fenceStallCount;
 #endif
+    return count;
 }
 
 // Check internal buffer overflow for a given number of vertex
@@ -3099,1758 +4202,4485 @@ bool rlCheckRenderBatchLimit(int vCount)
     bool overflow = false;
 
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.vertexCounter + vCount) >=
-        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    if ((RLCTX->vertexCounter + vCount) >=
+        (RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].elementCount*4))
     {
         overflow = true;
 
-        // Store current primitive drawing mode and texture id
-        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
-        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+        // Store current primitive drawing mode and textures (multi-texture draws)
+        rlDrawCall currentDraw = RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1];
+        unsigned char currentTexslot = RLCTX->texslot;
 
-        rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+        rlFlushRenderBatch(&RLGL.Stats.flushBufferFull);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode = currentDraw.mode;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].textureId = currentDraw.textureId;
+        memcpy(RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].textureIds, currentDraw.textureIds, sizeof(currentDraw.textureIds));
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].textureCount = currentDraw.textureCount;
+        RLCTX->texslot = currentTexslot;
     }
 #endif
 
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Begin display list recording
+// NOTE: Pending batch data is drawn, following vertex data (rlBegin()/rlVertex*()/rlEnd(), rlPushQuads()...)
+// is recorded into an internal batch that is captured on every batch draw instead of being drawn
+void rlBeginDisplayList(void)
 {
-    unsigned int id = 0;
-
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLCTX != &RLGL.Record)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Display list can only be recorded on main thread");
+        return;
+    }
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    if (RLCTX->capturing)
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Display list already being recorded");
+        return;
     }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+
+    rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
+
+    if (RLGL.State.displayListBatch.vertexBuffer == NULL) RLGL.State.displayListBatch = rlLoadRenderBatchEx(1, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_BATCH_LAYOUT_INTERLEAVED);
+
+    RLGL.State.displayListPrevBatch = RLCTX->currentBatch;
+    RLCTX->currentBatch = &RLGL.State.displayListBatch;
+    RLCTX->currentBatch->currentDepth = RLGL.State.displayListPrevBatch->currentDepth;
+
+    RLCTX->captureVertexCount = 0;
+    RLCTX->captureDrawCount = 0;
+    RLCTX->capturing = true;
+#endif
+}
+
+// End display list recording and upload captured vertex data to GPU
+rlDisplayList rlEndDisplayList(void)
+{
+    rlDisplayList list = { 0 };
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if ((RLCTX != &RLGL.Record) || !RLCTX->capturing)
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Display list not being recorded");
+        return list;
     }
+
+    rlCaptureRenderBatch(RLCTX->currentBatch);
+
+    RLGL.State.displayListPrevBatch->currentDepth = RLCTX->currentBatch->currentDepth;
+    RLCTX->currentBatch = RLGL.State.displayListPrevBatch;
+    RLGL.State.displayListPrevBatch = NULL;
+    RLCTX->capturing = false;
+
+    if (RLCTX->captureVertexCount == 0) return list;
+
+    if (!rlUploadDisplayList(&list, RLCTX->captureVertices, RLCTX->captureVertexCount, (RLCTX->captureVertexCount + 3)/4, GL_STATIC_DRAW)) return list;
+
+    list.drawCount = RLCTX->captureDrawCount;
+    list.draws = (rlDrawCall *)RL_MALLOC(list.drawCount*sizeof(rlDrawCall));
+    memcpy(list.draws, RLCTX->captureDraws, list.drawCount*sizeof(rlDrawCall));
+
+    // Custom shaders only sample texture0, multi-texture draws are also kept split by texture slot
+    int splitCapacity = 0;
+    list.splitDrawCount = rlSplitDrawsByTexSlot(RLCTX->captureDraws, RLCTX->captureDrawCount, RLCTX->captureVertices, &list.splitDraws, &splitCapacity);
+
+    RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Display list loaded successfully in VRAM (GPU) (%i vertex, %i draw calls)", list.vertexCount, list.drawCount);
+#endif
+
+    return list;
+}
+
+// Draw display list, transform applied over current modelview
+// NOTE: Transform matrix set while recording is already baked into vertex data, do not apply it again,
+// pending batch data is drawn first, display list is drawn with current shader and blending mode,
+// multi-texture draws require the default shader, split draws (single texture) are used with custom shaders
+void rlDrawDisplayList(rlDisplayList list, RaylibMatrix transform)
+{
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    if (list.drawCount == 0) return;
+
+    if (RLCTX != &RLGL.Record)
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Display list can only be drawn on main thread");
+        return;
     }
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    if (RLCTX->capturing)
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Display list can not be drawn while recording a display list");
+        return;
     }
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
+
+    const rlDrawCall *draws = list.draws;
+    int drawCount = list.drawCount;
+
+    if ((RLGL.State.currentShaderId != RLGL.State.defaultShaderId) && (list.splitDrawCount > 0))
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
+        draws = list.splitDraws;
+        drawCount = list.splitDrawCount;
     }
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    // Display list vertex already include the transform matrix (rlPushMatrix()) set while recording (baked by rlFlushTransformRun()),
+    // current modelview, current transform matrix and provided transform are applied on top of it
+    RaylibMatrix matModelView = RLCTX->modelview;
+    if (RLCTX->transformRequired) matModelView = rlMatrixMultiply(RLCTX->transform, matModelView);
+    matModelView = rlMatrixMultiply(transform, matModelView);
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(list.vaoId);
+    else
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        rlSetDisplayListAttribs();
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list.vboId[1]);
     }
-#endif
-#endif  // RAYLIB_GRAPHICS_API_OPENGL_11
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    int eyeCount = 1;
+    if (RLGL.State.stereoRender) eyeCount = 2;
 
-    glGenTextures(1, &id);              // Generate texture id
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        RaylibMatrix matProjection = RLCTX->projection;
+        RaylibMatrix matEyeModelView = matModelView;
 
-    glBindTexture(GL_TEXTURE_2D, id);
+        if (eyeCount == 2)
+        {
+            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
+            matProjection = RLGL.State.projectionStereo[eye];
+            matEyeModelView = rlMatrixMultiply(matModelView, RLGL.State.viewOffsetStereo[eye]);
+            rlSetUniformBlockCameraEye(eye);
+        }
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset, only used for tracelog
+        unsigned int drawShaderId = 0;
 
-    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned char *dataPtr = NULL;
-    if (data != NULL) dataPtr = (unsigned char *)data;
+        for (int i = 0, vertexOffset = 0; i < drawCount; i++)
+        {
+            const rlDrawCall *draw = &draws[i];
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+            if (draw->vertexCount > 0)
+            {
+                // Draw calls with multiple textures use default shader multi-texture variant
+                unsigned int shaderId = RLGL.State.currentShaderId;
+                int *shaderLocs = RLGL.State.currentShaderLocs;
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+                if ((draw->textureCount > 1) && (shaderId == RLGL.State.defaultShaderId))
+                {
+                    shaderId = RLGL.State.multiTextureShaderId;
+                    shaderLocs = RLGL.State.multiTextureShaderLocs;
+                }
 
-        RAYLIB_TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+                if (shaderId != drawShaderId)
+                {
+                    rlCacheUseProgram(shaderId);
+                    rlSetTexSlotAttrib(shaderId);
+                    glUniform4f(shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                    glUniform1i(shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+                    rlSetDrawUniforms(shaderLocs, matProjection, matEyeModelView);
+                    drawShaderId = shaderId;
+                }
 
-        if (glInternalFormat != 0)
-        {
-            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
-#if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
-#endif
+                for (int k = draw->textureCount - 1; k >= 0; k--)
+                {
+                    rlCacheActiveTexture(k);
+                    rlCacheBindTexture(draw->textureIds[k]);
+                }
 
+                if ((draw->mode == RL_LINES) || (draw->mode == RL_TRIANGLES)) glDrawArrays(draw->mode, vertexOffset, draw->vertexCount);
+                else
+                {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+                    glDrawElements(GL_TRIANGLES, draw->vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
 #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+                    glDrawElements(GL_TRIANGLES, draw->vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
 #endif
-        }
+                }
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;       // Increment offset position to next mipmap
-        if (data != NULL) dataPtr += mipSize;         // Increment data pointer to next mipmap
+                RLGL.Stats.drawCalls++;
+                RLGL.Stats.vertexCount += draw->vertexCount;
+            }
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
+            vertexOffset += (draw->vertexCount + draw->vertexAlignment);
+        }
     }
 
-    // RaylibTexture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (RLGL.ExtSupported.texNPOT)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
+    if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     else
     {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+        glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
-#else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-#endif
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    rlCacheBindTexture(0);      // Unbind textures
+    rlCacheUseProgram(0);       // Unbind shader program
+#endif
+}
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
+// Unload display list from GPU memory (VRAM) and RAM
+void rlUnloadDisplayList(rlDisplayList list)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao && (list.vaoId > 0))
     {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        rlCacheBindVertexArray(0);
+        glDeleteVertexArrays(1, &list.vaoId);
     }
+
+    if (list.vboId[0] > 0) glDeleteBuffers(1, &list.vboId[0]);
+    if (list.vboId[1] > 0) glDeleteBuffers(1, &list.vboId[1]);
 #endif
+    RL_FREE(list.draws);
+    RL_FREE(list.splitDraws);
+}
 
-    // At this point we have the texture loaded in GPU and texture parameters configured
+// Load a recording context, worker threads use it to record render batch data without any GPU call
+// NOTE: Recording context batch is CPU only (interleaved layout), it is captured when full (same as display lists)
+rlRecordContext *rlLoadRecordContext(int bufferElements)
+{
+    rlRecordContext *context = NULL;
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (bufferElements <= 0) bufferElements = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    context = (rlRecordContext *)RL_CALLOC(1, sizeof(rlRecordContext));
 
-    if (id > 0) RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] RaylibTexture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
-    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+    context->batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(1, sizeof(rlVertexBuffer));
+    context->batch.vertexBuffer[0].elementCount = bufferElements;
+    context->batch.vertexBuffer[0].layout = RL_BATCH_LAYOUT_INTERLEAVED;
+    context->batch.vertexBuffer[0].data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+    context->batch.draws = (rlDrawCall *)RL_CALLOC(RL_DEFAULT_BATCH_DRAWCALLS, sizeof(rlDrawCall));
+    context->batch.bufferCount = 1;
+    context->batch.drawCounter = 1;
+    context->batch.currentDepth = -1.0f;
+#endif
 
-    return id;
+    return context;
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture and WebGL requires WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+// Unload recording context
+// NOTE: Submission GPU buffers are deleted, it must be called on main thread
+void rlUnloadRecordContext(rlRecordContext *context)
 {
-    unsigned int id = 0;
-
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // In case depth textures not supported, we force renderbuffer usage
-    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+    if (context == NULL) return;
 
-    // NOTE: We let the implementation to choose the best bit-depth
-    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+    rlDisplayList list = context->submitList;
+    list.draws = NULL;
+    list.splitDraws = NULL;
+    rlUnloadDisplayList(list);
 
-#if (defined(RAYLIB_GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_ES3))
-    // WARNING: WebGL platform requires unsized internal format definition (GL_DEPTH_COMPONENT)
-    // while other platforms using OpenGL ES 2.0 require/support sized internal formats depending on the GPU capabilities
-    if (!RLGL.ExtSupported.texDepthWebGL || useRenderBuffer)
-    {
-        if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-        else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-        else glInternalFormat = GL_DEPTH_COMPONENT16;
-    }
+    RL_FREE(context->batch.vertexBuffer[0].data);
+    RL_FREE(context->batch.vertexBuffer);
+    RL_FREE(context->batch.draws);
+    RL_FREE(context->captureVertices);
+    RL_FREE(context->captureDraws);
+    RL_FREE(context->submitSplitDraws);
+    RL_FREE(context);
 #endif
+}
 
-    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+// Begin recording on current thread, previous recorded data is discarded
+// NOTE: Recording starts with identity matrices and white color, matrix stack is local to the context
+void rlBeginRecording(rlRecordContext *context)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (context == NULL) return;
+
+    if (context->capturing)
     {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Recording context already being recorded");
+        return;
+    }
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    context->previous = RLCTX;
+    RLCTX = context;
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+    context->currentBatch = &context->batch;
+    context->currentBatch->currentDepth = -1.0f;
+    context->texcoordx = 0.0f;
+    context->texcoordy = 0.0f;
+    context->normalx = 0.0f;
+    context->normaly = 0.0f;
+    context->normalz = 0.0f;
+    context->colorr = 255;
+    context->colorg = 255;
+    context->colorb = 255;
+    context->colora = 255;
 
-        RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
-    }
-    else
-    {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+    context->currentMatrixMode = RL_MODELVIEW;
+    context->modelview = rlMatrixIdentity();
+    context->projection = rlMatrixIdentity();
+    context->transform = rlMatrixIdentity();
+    context->transformRequired = false;
+    context->currentMatrix = &context->modelview;
+    context->stackCounter = 0;
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    // Reset context batch, no vertex data is captured
+    context->vertexCounter = 0;
+    context->transformRunStart = 0;
+    rlCaptureRenderBatch(context->currentBatch);
 
-        RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
-    }
+    context->captureVertexCount = 0;
+    context->captureDrawCount = 0;
+    context->capturing = true;
 #endif
-
-    return id;
 }
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
+// End recording on current thread, pending batch data is captured
+void rlEndRecording(void)
 {
-    unsigned int id = 0;
-
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
-
-    glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlRecordContext *context = RLCTX;
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-
-    if (glInternalFormat != 0)
+    if ((context == NULL) || (context == &RLGL.Record) || !context->capturing)
     {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
-        {
-            if (data == NULL)
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-                {
-                    if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)
-                            || (format == RL_PIXELFORMAT_UNCOMPRESSED_R16) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))
-                        RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
-                }
-                else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
-            }
-            else
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
-            }
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Recording context not being recorded");
+        return;
+    }
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
+    rlCaptureRenderBatch(context->currentBatch);
+    context->capturing = false;
+
+    RLCTX = context->previous;
+    context->previous = NULL;
 #endif
-        }
+}
+
+// Upload and draw recording context data, pending batch data is drawn first
+// NOTE: Vertex data is uploaded on every submission, index buffer is only updated when it grows
+void rlSubmitRecordContext(rlRecordContext *context)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (context == NULL) return;
+
+    if (RLCTX != &RLGL.Record)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Recording context can only be submitted on main thread");
+        return;
     }
 
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
-#endif
+    if (context->capturing)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Recording context can not be submitted while being recorded");
+        return;
+    }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-#endif
+    if (context->captureVertexCount == 0) return;
 
-    if (id > 0) RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
-    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+    int quadCount = (context->captureVertexCount + 3)/4;
+    int indexQuadCount = 0;
 
-    return id;
-}
+    if (quadCount > context->submitQuadCapacity)
+    {
+        indexQuadCount = (context->submitQuadCapacity > 0)? context->submitQuadCapacity : context->batch.vertexBuffer[0].elementCount;
+        while (indexQuadCount < quadCount) indexQuadCount *= 2;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+        if (indexQuadCount > 65536/4) indexQuadCount = 65536/4;     // 16bit indices limit
+#endif
+    }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
-{
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (!rlUploadDisplayList(&context->submitList, context->captureVertices, context->captureVertexCount, indexQuadCount, GL_STREAM_DRAW)) return;
+    if (indexQuadCount > 0) context->submitQuadCapacity = indexQuadCount;
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    rlDisplayList list = context->submitList;
+    list.draws = context->captureDraws;
+    list.drawCount = context->captureDrawCount;
 
-    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    // Multi-texture draws are split by texture slot only if required by current shader
+    if (RLGL.State.currentShaderId != RLGL.State.defaultShaderId)
     {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+        list.splitDrawCount = rlSplitDrawsByTexSlot(context->captureDraws, context->captureDrawCount, context->captureVertices, &context->submitSplitDraws, &context->submitSplitDrawCapacity);
+        list.splitDraws = context->submitSplitDraws;
     }
-    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+
+    rlDrawDisplayList(list, rlMatrixIdentity());
+#endif
 }
 
-// Get OpenGL internal formats and data type from raylib RaylibPixelFormat
-void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+// GL state cache management
+//-----------------------------------------------------------------------------------------
+// Invalidate GL state cache
+// NOTE: Required if shader, vertex array, framebuffer or texture bindings are changed
+// calling OpenGL directly, next state changes through rlgl are always issued
+void rlInvalidateStateCache(void)
 {
-    *glInternalFormat = 0;
-    *glFormat = 0;
-    *glType = 0;
-
-    switch (format)
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.cachedShaderId = RL_STATE_CACHE_INVALID;
+    RLGL.State.cachedVertexArrayId = RL_STATE_CACHE_INVALID;
+    RLGL.State.cachedDrawFramebufferId = RL_STATE_CACHE_INVALID;
+    RLGL.State.cachedReadFramebufferId = RL_STATE_CACHE_INVALID;
+    RLGL.State.cachedTextureSlot = -1;
+    for (int i = 0; i < RL_MAX_CACHED_TEXTURE_SLOTS; i++)
     {
-    #if defined(RAYLIB_GRAPHICS_API_OPENGL_11) || defined(RAYLIB_GRAPHICS_API_OPENGL_21) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-        #if defined(GRAPHICS_API_OPENGL_ES3)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F_EXT; *glFormat = GL_RED_EXT; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F_EXT; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F_EXT; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F_EXT; *glFormat = GL_RED_EXT; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F_EXT; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F_EXT; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
-        #else
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;            // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;                  // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;             // NOTE: Requires extension OES_texture_float
-        #if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_ARB; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_ARB; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_ARB; break;
-        #else // defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_OES; break;   // NOTE: Requires extension OES_texture_half_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_OES; break;         // NOTE: Requires extension OES_texture_half_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_OES; break;    // NOTE: Requires extension OES_texture_half_float
-        #endif
-        #endif
-        #endif
-    #elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F; *glFormat = GL_RED; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
-    #endif
-    #if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-    #endif
-        default: RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+        RLGL.State.cachedTextureIds[i] = RL_STATE_CACHE_INVALID;
+        RLGL.State.cachedCubemapIds[i] = RL_STATE_CACHE_INVALID;
     }
+#endif
 }
 
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
+// Get GL state changes issued and skipped (redundant) since last reset
+void rlGetStateChangeCounters(unsigned int *issued, unsigned int *skipped)
 {
-    glDeleteTextures(1, &id);
+    unsigned int issuedCount = 0;
+    unsigned int skippedCount = 0;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    issuedCount = RLGL.Stats.stateChangesIssued;
+    skippedCount = RLGL.Stats.stateChangesSkipped;
+#endif
+    if (issued != NULL) *issued = issuedCount;
+    if (skipped != NULL) *skipped = skippedCount;
 }
 
-// Generate mipmap data for selected texture
-// NOTE: Only supports GPU mipmap generation
-void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+// Reset GL state changes counters
+void rlResetStateChangeCounters(void)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    RLGL.Stats.stateChangesIssued = 0;
+    RLGL.Stats.stateChangesSkipped = 0;
+#endif
+}
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+// Render statistics
+//-----------------------------------------------------------------------------------------
+// Get render statistics since last reset
+// NOTE: Not available on OpenGL 1.1, all counters are 0
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats;
+#endif
+    return stats;
+}
 
-    if (((width > 0) && ((width & (width - 1)) == 0)) &&
-        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+// Reset render statistics
+void rlResetRenderStats(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    memset(&RLGL.Stats, 0, sizeof(rlRenderStats));
+#endif
+}
 
-    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
-    {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+#if defined(RLGL_NULL_BACKEND)
+// Null backend trace
+//-----------------------------------------------------------------------------------------
+// Get null backend trace recorded since last reset
+rlNullTrace rlGetNullTrace(void)
+{
+    rlNullTrace trace = RLGL.NullBackend.trace;
+    trace.commands = RLGL.NullBackend.commands;
 
-        #define RAYLIB_MIN(a,b) (((a)<(b))? (a):(b))
-        #define RAYLIB_MAX(a,b) (((a)>(b))? (a):(b))
+    return trace;
+}
 
-        *mipmaps = 1 + (int)floor(log(RAYLIB_MAX(width, height))/log(2));
-        RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
-    }
-    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+// Reset null backend trace counters and recorded commands
+void rlResetNullTrace(void)
+{
+    memset(&RLGL.NullBackend.trace, 0, sizeof(rlNullTrace));
+}
+#endif
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-#else
-    RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+// GPU timer queries
+//-----------------------------------------------------------------------------------------
+// Check if GPU timer queries are supported
+bool rlIsGpuTimerSupported(void)
+{
+    bool supported = false;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    supported = RLGL.ExtSupported.timerQuery;
 #endif
+    return supported;
 }
 
-// Read texture pixel data
-void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+// Begin GPU timer scope
+// NOTE: Pending batch data is drawn first so it is not measured in this scope
+void rlBeginGpuTimer(const char *name)
 {
-    void *pixels = NULL;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.timerQuery) return;
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_11) || defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (RLGL.GpuTimers.stackCounter >= RL_MAX_GPU_TIMERS)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: GPU timer scopes nesting limit reached (%i)", RL_MAX_GPU_TIMERS);
+        return;
+    }
 
-    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    rlGpuTimerFrame *frame = &RLGL.GpuTimers.frames[RLGL.GpuTimers.currentFrame];
+    int index = -1;
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    if (frame->timerCount < RL_MAX_GPU_TIMERS)
+    {
+        rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = rlGetPixelDataSize(width, height, format);
+        if (frame->queryIds[0] == 0) glGenQueries(RL_MAX_GPU_TIMERS*2, frame->queryIds);
 
-    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
-    {
-        pixels = RL_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+        index = frame->timerCount;
+        strncpy(frame->timers[index].name, (name != NULL)? name : "", RL_MAX_GPU_TIMER_NAME_SIZE - 1);
+        frame->timers[index].name[RL_MAX_GPU_TIMER_NAME_SIZE - 1] = '\0';
+        frame->timers[index].depth = RLGL.GpuTimers.stackCounter;
+        frame->timers[index].time = 0.0f;
+
+        glQueryCounter(frame->queryIds[2*index], GL_TIMESTAMP);
+        frame->timerCount++;
     }
-    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+    else RAYLIB_TRACELOG(RL_LOG_DEBUG, "RLGL: GPU timer scopes limit reached (%i), scope not measured", RL_MAX_GPU_TIMERS);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    RLGL.GpuTimers.stack[RLGL.GpuTimers.stackCounter] = index;
+    RLGL.GpuTimers.stackCounter++;
 #endif
+}
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // RaylibTexture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    unsigned int fboId = rlLoadFramebuffer();
+// End latest GPU timer scope
+void rlEndGpuTimer(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.timerQuery) return;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
-
-    // Attach our texture to FBO
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
-
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    if (RLGL.GpuTimers.stackCounter <= 0)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: GPU timer scope end without begin");
+        return;
+    }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RLGL.GpuTimers.stackCounter--;
+    int index = RLGL.GpuTimers.stack[RLGL.GpuTimers.stackCounter];
 
-    // Clean up temporal fbo
-    rlUnloadFramebuffer(fboId);
+    if (index >= 0)
+    {
+        rlFlushRenderBatch(&RLGL.Stats.flushExplicit);
+        glQueryCounter(RLGL.GpuTimers.frames[RLGL.GpuTimers.currentFrame].queryIds[2*index + 1], GL_TIMESTAMP);
+    }
 #endif
-
-    return pixels;
 }
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
+// Finish frame GPU timers and read back available results
+// NOTE: Queries are only checked for availability (no pipeline stall), frames in flight are resolved
+// in order, a frame whose results are not available after RL_GPU_TIMER_FRAMES frames is dropped
+void rlUpdateGpuTimers(void)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.timerQuery) return;
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    if (RLGL.GpuTimers.stackCounter > 0)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: GPU timer scopes not ended on frame end (%i)", RLGL.GpuTimers.stackCounter);
+        while (RLGL.GpuTimers.stackCounter > 0) rlEndGpuTimer();
+    }
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    rlGpuTimerFrame *frame = &RLGL.GpuTimers.frames[RLGL.GpuTimers.currentFrame];
+    frame->pending = (frame->timerCount > 0);
 
-    for (int y = height - 1; y >= 0; y--)
+    RLGL.GpuTimers.currentFrame = (RLGL.GpuTimers.currentFrame + 1)%RL_GPU_TIMER_FRAMES;
+
+    // Resolve frames in flight, oldest first
+    for (int i = 0; i < RL_GPU_TIMER_FRAMES; i++)
     {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+        frame = &RLGL.GpuTimers.frames[(RLGL.GpuTimers.currentFrame + i)%RL_GPU_TIMER_FRAMES];
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
-        }
+        if (frame->pending && !rlResolveGpuTimerFrame(frame)) break;
     }
 
-    RL_FREE(screenData);
+    // Oldest frame is reused for next frame scopes
+    frame = &RLGL.GpuTimers.frames[RLGL.GpuTimers.currentFrame];
 
-    return imgData;     // NOTE: image data should be freed
+    if (frame->pending)
+    {
+        RAYLIB_TRACELOG(RL_LOG_DEBUG, "RLGL: GPU timer results not available after %i frames, dropped", RL_GPU_TIMER_FRAMES);
+        frame->pending = false;
+    }
+
+    frame->timerCount = 0;
+#endif
 }
 
-// Framebuffer management (fbo)
-//-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(void)
+// Get number of GPU timer scopes in latest resolved frame
+int rlGetGpuTimerCount(void)
 {
-    unsigned int fboId = 0;
-
-#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+    int count = 0;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    count = RLGL.GpuTimers.resultCount;
 #endif
-
-    return fboId;
+    return count;
 }
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-RaylibColor, 1-Depth renderbuffer, 2-Depth texture
-void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+// Get GPU timer scope result from latest resolved frame
+rlGpuTimer rlGetGpuTimer(int index)
 {
-#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-
-    switch (attachType)
-    {
-        case RL_ATTACHMENT_COLOR_CHANNEL0:
-        case RL_ATTACHMENT_COLOR_CHANNEL1:
-        case RL_ATTACHMENT_COLOR_CHANNEL2:
-        case RL_ATTACHMENT_COLOR_CHANNEL3:
-        case RL_ATTACHMENT_COLOR_CHANNEL4:
-        case RL_ATTACHMENT_COLOR_CHANNEL5:
-        case RL_ATTACHMENT_COLOR_CHANNEL6:
-        case RL_ATTACHMENT_COLOR_CHANNEL7:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
-            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
-
-        } break;
-        case RL_ATTACHMENT_DEPTH:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
-
-        } break;
-        case RL_ATTACHMENT_STENCIL:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
-
-        } break;
-        default: break;
-    }
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlGpuTimer timer = { 0 };
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if ((index >= 0) && (index < RLGL.GpuTimers.resultCount)) timer = RLGL.GpuTimers.results[index];
 #endif
+    return timer;
 }
 
-// Verify render texture is complete
-bool rlFramebufferComplete(unsigned int id)
+// Get GPU timer scope time (milliseconds) by name from latest resolved frame
+// NOTE: Times of scopes with the same name are accumulated, -1.0f is returned if not found
+float rlGetGpuTimerTime(const char *name)
 {
-    bool result = false;
-
-#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
-
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+    float time = -1.0f;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    for (int i = 0; (name != NULL) && (i < RLGL.GpuTimers.resultCount); i++)
     {
-        switch (status)
+        if (strcmp(RLGL.GpuTimers.results[i].name, name) == 0)
         {
-            case GL_FRAMEBUFFER_UNSUPPORTED: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
-#endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
-            default: break;
+            if (time < 0.0f) time = 0.0f;
+            time += RLGL.GpuTimers.results[i].time;
         }
     }
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
 #endif
-
-    return result;
+    return time;
 }
 
-// Unload framebuffer from GPU memory
-// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
-void rlUnloadFramebuffer(unsigned int id)
+// Log GPU timer scopes results from latest resolved frame
+void rlTraceGpuTimers(void)
 {
-#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    // Query depth attachment to automatically delete texture/renderbuffer
-    int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
-
-    // TODO: Review warning retrieving object name in WebGL
-    // WARNING: WebGL: INVALID_ENUM: getFramebufferAttachmentParameter: invalid parameter name
-    // https://registry.khronos.org/webgl/specs/latest/1.0/
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
-
-    unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
-
-    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
-    // the texture image is automatically detached from the currently bound framebuffer.
+    if (!rlIsGpuTimerSupported())
+    {
+        RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: GPU timer queries not supported");
+        return;
+    }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &id);
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: GPU timers (%i scopes):", RLGL.GpuTimers.resultCount);
 
-    RAYLIB_TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+    for (int i = 0; i < RLGL.GpuTimers.resultCount; i++)
+    {
+        RAYLIB_TRACELOG(RL_LOG_INFO, "    > %*s%s: %.3f ms", RLGL.GpuTimers.results[i].depth*2, "",
+            RLGL.GpuTimers.results[i].name, RLGL.GpuTimers.results[i].time);
+    }
 #endif
 }
 
-// Vertex data management
+// Textures data management
 //-----------------------------------------------------------------------------------------
-// Load a new attributes buffer
-unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
 {
     unsigned int id = 0;
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-#endif
+    rlCacheBindTexture(0);    // Free any old binding
 
-    return id;
-}
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
 
-// Load a new attributes element buffer
-unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
-{
-    unsigned int id = 0;
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-#endif
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
 
-    return id;
-}
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
 
-// Enable vertex buffer (VBO)
-void rlEnableVertexBuffer(unsigned int id)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+    if ((!RLGL.ExtSupported.texCompRGTC) && ((format == RL_PIXELFORMAT_COMPRESSED_BC4_R) || (format == RL_PIXELFORMAT_COMPRESSED_BC5_RG)))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "GL: RGTC (BC4/BC5) compressed texture format not supported");
+        return id;
+    }
 #endif
-}
+#endif  // RAYLIB_GRAPHICS_API_OPENGL_11
 
-// Disable vertex buffer (VBO)
-void rlDisableVertexBuffer(void)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-#endif
-}
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-// Enable vertex buffer element (VBO element)
-void rlEnableVertexBufferElement(unsigned int id)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-#endif
-}
+    glGenTextures(1, &id);              // Generate texture id
 
-// Disable vertex buffer element (VBO element)
-void rlDisableVertexBufferElement(void)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-#endif
-}
+    rlCacheBindTexture(id);
 
-// Update vertex buffer with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
-#endif
-}
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset, only used for tracelog
 
-// Update vertex buffer elements with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
-#endif
-}
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned char *dataPtr = NULL;
+    if (data != NULL) dataPtr = (unsigned char *)data;
 
-// Enable vertex array object (VAO)
-bool rlEnableVertexArray(unsigned int vaoId)
-{
-    bool result = false;
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
     {
-        glBindVertexArray(vaoId);
-        result = true;
-    }
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        RAYLIB_TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != 0)
+        {
+            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
+#if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
 #endif
-    return result;
-}
 
-// Disable vertex array object (VAO)
-void rlDisableVertexArray(void)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
 #endif
-}
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
 
-// Enable vertex attribute index
-void rlEnableVertexAttribute(unsigned int index)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glEnableVertexAttribArray(index);
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;       // Increment offset position to next mipmap
+        if (data != NULL) dataPtr += mipSize;         // Increment data pointer to next mipmap
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    // RaylibTexture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (RLGL.ExtSupported.texNPOT)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+    }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
 #endif
-}
 
-// Disable vertex attribute index
-void rlDisableVertexAttribute(unsigned int index)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glDisableVertexAttribArray(index);
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
 #endif
-}
 
-// Draw vertex array
-void rlDrawVertexArray(int offset, int count)
-{
-    glDrawArrays(GL_TRIANGLES, offset, count);
-}
+    // At this point we have the texture loaded in GPU and texture parameters configured
 
-// Draw vertex array elements
-void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
-{
-    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned short *bufferPtr = (unsigned short *)buffer;
-    if (offset > 0) bufferPtr += offset;
+    // NOTE: If mipmaps were not in data, they are not generated automatically
 
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
-}
+    // Unbind current texture
+    rlCacheBindTexture(0);
 
-// Draw vertex array instanced
-void rlDrawVertexArrayInstanced(int offset, int count, int instances)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
-#endif
+    if (id > 0) RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] RaylibTexture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+
+    return id;
 }
 
-// Draw vertex array elements instanced
-void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture and WebGL requires WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 {
+    unsigned int id = 0;
+
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned short *bufferPtr = (unsigned short *)buffer;
-    if (offset > 0) bufferPtr += offset;
+    // In case depth textures not supported, we force renderbuffer usage
+    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
 
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
-#endif
-}
+    // NOTE: We let the implementation to choose the best bit-depth
+    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-// Enable vertex state pointer
-void rlEnableStatePointer(int vertexAttribType, void *buffer)
-{
-    if (buffer != NULL) glEnableClientState(vertexAttribType);
-    switch (vertexAttribType)
+#if (defined(RAYLIB_GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_ES3))
+    // WARNING: WebGL platform requires unsized internal format definition (GL_DEPTH_COMPONENT)
+    // while other platforms using OpenGL ES 2.0 require/support sized internal formats depending on the GPU capabilities
+    if (!RLGL.ExtSupported.texDepthWebGL || useRenderBuffer)
     {
-        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
-        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
-        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
-        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
-        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
-        default: break;
+        if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+        else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+        else glInternalFormat = GL_DEPTH_COMPONENT16;
     }
-}
-
-// Disable vertex state pointer
-void rlDisableStatePointer(int vertexAttribType)
-{
-    glDisableClientState(vertexAttribType);
-}
 #endif
 
-// Load vertex array object (VAO)
-unsigned int rlLoadVertexArray(void)
-{
-    unsigned int vaoId = 0;
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
-        glGenVertexArrays(1, &vaoId);
-    }
-#endif
-    return vaoId;
-}
+        glGenTextures(1, &id);
+        rlCacheBindTexture(id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
-// Set vertex attribute
-void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // NOTE: Data type could be: GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT, GL_INT, GL_UNSIGNED_INT
-    // Additional types (depends on OpenGL version or extensions):
-    //  - GL_HALF_FLOAT, GL_FLOAT, GL_DOUBLE, GL_FIXED,
-    //  - GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT_10F_11F_11F_REV
-    glVertexAttribPointer(index, compSize, type, normalized, stride, (void *)offset);
-#endif
-}
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-// Set vertex attribute divisor
-void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribDivisor(index, divisor);
-#endif
-}
+        rlCacheBindTexture(0);
 
-// Unload vertex array object (VAO)
-void rlUnloadVertexArray(unsigned int vaoId)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+        RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
+    }
+    else
     {
-        glBindVertexArray(0);
-        glDeleteVertexArrays(1, &vaoId);
-        RAYLIB_TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
     }
 #endif
-}
 
-// Unload vertex buffer (VBO)
-void rlUnloadVertexBuffer(unsigned int vboId)
-{
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glDeleteBuffers(1, &vboId);
-    //RAYLIB_TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
-#endif
+    return id;
 }
 
-// Shaders management
-//-----------------------------------------------------------------------------------------------
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 {
     unsigned int id = 0;
 
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    unsigned int vertexShaderId = 0;
-    unsigned int fragmentShaderId = 0;
+    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
 
-    // Compile vertex shader (if provided)
-    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
-    // In case no vertex shader was provided or compilation failed, we use default vertex shader
-    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+    glGenTextures(1, &id);
+    rlCacheBindTextureCubemap(id);
 
-    // Compile fragment shader (if provided)
-    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
-    // In case no fragment shader was provided or compilation failed, we use default fragment shader
-    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
-    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
-    else
+    if (glInternalFormat != 0)
+    {
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (data == NULL)
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                {
+                    if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)
+                            || (format == RL_PIXELFORMAT_UNCOMPRESSED_R16) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))
+                        RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
+                }
+                else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
+            }
+            else
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+            }
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
+    }
+
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+#endif
+
+    rlCacheBindTextureCubemap(0);
+#endif
+
+    if (id > 0) RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+
+    return id;
+}
+
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+    rlCacheBindTexture(id);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+        RLGL.Stats.uploadedBytes += rlGetPixelDataSize(width, height, format);
+#endif
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+}
+
+// Get OpenGL internal formats and data type from raylib RaylibPixelFormat
+void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+{
+    *glInternalFormat = 0;
+    *glFormat = 0;
+    *glType = 0;
+
+    switch (format)
+    {
+    #if defined(RAYLIB_GRAPHICS_API_OPENGL_11) || defined(RAYLIB_GRAPHICS_API_OPENGL_21) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+        #if defined(GRAPHICS_API_OPENGL_ES3)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F_EXT; *glFormat = GL_RED_EXT; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F_EXT; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F_EXT; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F_EXT; *glFormat = GL_RED_EXT; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F_EXT; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F_EXT; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
+        #else
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;            // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;                  // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;             // NOTE: Requires extension OES_texture_float
+        #if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_ARB; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_ARB; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_ARB; break;
+        #else // defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_OES; break;   // NOTE: Requires extension OES_texture_half_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_OES; break;         // NOTE: Requires extension OES_texture_half_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_OES; break;    // NOTE: Requires extension OES_texture_half_float
+        #endif
+        #endif
+        #endif
+    #elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F; *glFormat = GL_RED; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
+    #endif
+    #if !defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_BC4_R: if (RLGL.ExtSupported.texCompRGTC) *glInternalFormat = GL_COMPRESSED_RED_RGTC1; break;                 // NOTE: Requires OpenGL 3.0
+        case RL_PIXELFORMAT_COMPRESSED_BC5_RG: if (RLGL.ExtSupported.texCompRGTC) *glInternalFormat = GL_COMPRESSED_RG_RGTC2; break;                 // NOTE: Requires OpenGL 3.0
+    #endif
+        default: RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    glDeleteTextures(1, &id);
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // Deleted texture is unbound by OpenGL and its id could be reused
+    for (int i = 0; i < RL_MAX_CACHED_TEXTURE_SLOTS; i++)
+    {
+        if (RLGL.State.cachedTextureIds[i] == id) RLGL.State.cachedTextureIds[i] = RL_STATE_CACHE_INVALID;
+        if (RLGL.State.cachedCubemapIds[i] == id) RLGL.State.cachedCubemapIds[i] = RL_STATE_CACHE_INVALID;
+    }
+#endif
+}
+
+// Generate mipmap data for selected texture
+// NOTE: Only supports GPU mipmap generation
+void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindTexture(id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((width > 0) && ((width & (width - 1)) == 0)) &&
+        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+
+    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+
+        #define RAYLIB_MIN(a,b) (((a)<(b))? (a):(b))
+        #define RAYLIB_MAX(a,b) (((a)>(b))? (a):(b))
+
+        *mipmaps = 1 + (int)floor(log(RAYLIB_MAX(width, height))/log(2));
+        RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+
+    rlCacheBindTexture(0);
+#else
+    RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+#endif
+}
+
+// Read texture pixel data
+void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+{
+    void *pixels = NULL;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_11) || defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    rlCacheBindTexture(id);
+
+    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = rlGetPixelDataSize(width, height, format);
+
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        pixels = RL_MALLOC(size);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+
+    rlCacheBindTexture(0);
+#endif
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // RaylibTexture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    unsigned int fboId = rlLoadFramebuffer();
+
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlCacheBindTexture(0);
+
+    // Attach our texture to FBO
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+
+    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
+    pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Clean up temporal fbo
+    rlUnloadFramebuffer(fboId);
+#endif
+
+    return pixels;
+}
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+
+    // Flip image vertically!
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    rlCopyScreenPixels(imgData, screenData, width, height);
+
+    RL_FREE(screenData);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Start asynchronous screen pixel data read (color buffer)
+// NOTE: Pixel data is copied to a pixel pack buffer by the GPU, retrieve it some frames later
+// with rlGetScreenPixelsAsync(), -1 is returned if not supported (OpenGL 1.1, OpenGL ES 2.0)
+// or if all RL_MAX_SCREEN_READBACKS requests are in flight
+int rlReadScreenPixelsAsync(int width, int height)
+{
+    int request = -1;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    for (int i = 0; i < RL_MAX_SCREEN_READBACKS; i++)
+    {
+        if (!RLGL.Readbacks[i].busy)
+        {
+            request = i;
+            break;
+        }
+    }
+
+    if (request < 0)
+    {
+        RAYLIB_TRACELOG(RL_LOG_DEBUG, "RLGL: Screen readback requests limit reached (%i)", RL_MAX_SCREEN_READBACKS);
+        return request;
+    }
+
+    rlScreenReadback *readback = &RLGL.Readbacks[request];
+    int size = width*height*4;
+
+    if (readback->pboId == 0) glGenBuffers(1, &readback->pboId);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+
+    if (readback->size < size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        readback->size = size;
+    }
+
+    // NOTE: With a pixel pack buffer bound, glReadPixels() returns without waiting for the GPU
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (RLGL.ExtSupported.sync) readback->syncFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    readback->width = width;
+    readback->height = height;
+    readback->busy = true;
+#endif
+
+    return request;
+}
+
+// Check if asynchronous screen pixel data read is completed (no wait)
+// NOTE: Without sync objects support, requests are always reported completed
+bool rlIsScreenPixelsAsyncReady(int request)
+{
+    bool ready = false;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if ((request < 0) || (request >= RL_MAX_SCREEN_READBACKS) || !RLGL.Readbacks[request].busy) return false;
+
+    rlScreenReadback *readback = &RLGL.Readbacks[request];
+
+    if (readback->syncFence != NULL)
+    {
+        GLenum result = glClientWaitSync((GLsync)readback->syncFence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        ready = ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED));
+    }
+    else ready = true;
+#endif
+
+    return ready;
+}
+
+// Get asynchronous screen pixel data read result
+// NOTE: If not completed, NULL is returned (wait = false) or the GPU is waited (wait = true),
+// returned data is flipped vertically and alpha set to 255 (same as rlReadScreenPixels()), it should be freed
+unsigned char *rlGetScreenPixelsAsync(int request, bool wait)
+{
+    unsigned char *imgData = NULL;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if ((request < 0) || (request >= RL_MAX_SCREEN_READBACKS) || !RLGL.Readbacks[request].busy) return NULL;
+    if (!wait && !rlIsScreenPixelsAsyncReady(request)) return NULL;
+
+    rlScreenReadback *readback = &RLGL.Readbacks[request];
+
+    if (readback->syncFence != NULL)
+    {
+        glDeleteSync((GLsync)readback->syncFence);
+        readback->syncFence = NULL;
+    }
+
+    // NOTE: Mapping the buffer waits for the read to complete if required
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+    const unsigned char *screenData = (const unsigned char *)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+
+    if (screenData != NULL)
+    {
+        imgData = (unsigned char *)RL_MALLOC(readback->width*readback->height*4*sizeof(unsigned char));
+        rlCopyScreenPixels(imgData, screenData, readback->width, readback->height);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map screen readback buffer");
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback->busy = false;
+#endif
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Load texture stream for an uncompressed texture (pixel unpack buffers ring)
+// NOTE: slots defines the number of buffers in flight, more slots allow more updates
+// before waiting for the GPU to consume the previous ones (clamped to RL_MAX_TEXTURE_STREAM_SLOTS)
+rlTextureStream *rlLoadTextureStream(unsigned int id, int width, int height, int format, int slots)
+{
+    if ((id == 0) || (width <= 0) || (height <= 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to load texture stream, uncompressed texture required", id);
+        return NULL;
+    }
+
+    rlTextureStream *stream = (rlTextureStream *)RL_CALLOC(1, sizeof(rlTextureStream));
+    stream->textureId = id;
+    stream->width = width;
+    stream->height = height;
+    stream->format = format;
+    stream->size = rlGetPixelDataSize(width, height, format);
+
+    if (slots < 1) slots = 1;
+    if (slots > RL_MAX_TEXTURE_STREAM_SLOTS) slots = RL_MAX_TEXTURE_STREAM_SLOTS;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    stream->slotCount = slots;
+    stream->currentSlot = slots - 1;    // First update uses first slot
+    glGenBuffers(slots, stream->pboIds);
+
+    for (int i = 0; i < slots; i++)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pboIds[i]);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, stream->size, NULL, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture stream loaded successfully (%i slots, %i bytes)", id, slots, stream->size);
+#else
+    stream->data = RL_MALLOC(stream->size);
+
+    RAYLIB_TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture stream loaded successfully (system memory)", id);
+#endif
+
+    return stream;
+}
+
+// Unload texture stream buffers (texture is not unloaded)
+void rlUnloadTextureStream(rlTextureStream *stream)
+{
+    if (stream == NULL) return;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (stream->updating)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pboIds[stream->currentSlot]);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    for (int i = 0; i < stream->slotCount; i++)
+    {
+        if (stream->syncFences[i] != NULL) glDeleteSync((GLsync)stream->syncFences[i]);
+    }
+
+    if (stream->slotCount > 0) glDeleteBuffers(stream->slotCount, stream->pboIds);
+#endif
+
+    RL_FREE(stream->data);
+    RL_FREE(stream);
+}
+
+// Begin texture stream update, returns pointer to write next full texture pixel data
+// NOTE: Next pixel unpack buffer is mapped for writing (no copy required), only waits for the GPU
+// if the buffer upload is still pending, pointer is valid until rlEndTextureStreamUpdate()
+void *rlBeginTextureStreamUpdate(rlTextureStream *stream)
+{
+    if (stream == NULL) return NULL;
+    if (stream->slotCount == 0)
+    {
+        stream->updating = true;
+        return stream->data;
+    }
+
+    void *data = NULL;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (stream->updating) rlEndTextureStreamUpdate(stream);
+
+    stream->currentSlot = (stream->currentSlot + 1)%stream->slotCount;
+
+    // Wait for buffer upload to texture to be completed before writing on it
+    // NOTE: Fence is polled first, flushing commands is only required if not signaled yet
+    void **fence = &stream->syncFences[stream->currentSlot];
+
+    if (*fence != NULL)
+    {
+        GLenum result = glClientWaitSync((GLsync)*fence, 0, 0);
+        while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync((GLsync)*fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+        glDeleteSync((GLsync)*fence);
+        *fence = NULL;
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pboIds[stream->currentSlot]);
+
+    // NOTE: Buffer released by fence can be mapped unsynchronized, without sync objects
+    // buffer storage is orphaned, driver allocates a new one instead of waiting for the GPU
+    if (RLGL.ExtSupported.sync) data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, stream->size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    else
+    {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, stream->size, NULL, GL_STREAM_DRAW);
+        data = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (data != NULL) stream->updating = true;
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to map texture stream buffer", stream->textureId);
+#endif
+
+    return data;
+}
+
+// End texture stream update, written pixel data is uploaded to texture (asynchronous)
+// NOTE: Texture upload reads from the pixel unpack buffer on the GPU timeline, call returns without waiting
+void rlEndTextureStreamUpdate(rlTextureStream *stream)
+{
+    if ((stream == NULL) || !stream->updating) return;
+
+    stream->updating = false;
+
+    if (stream->slotCount == 0)
+    {
+        rlUpdateTexture(stream->textureId, 0, 0, stream->width, stream->height, stream->format, stream->data);
+        return;
+    }
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(stream->format, &glInternalFormat, &glFormat, &glType);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pboIds[stream->currentSlot]);
+
+    if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE)
+    {
+        rlCacheBindTexture(stream->textureId);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        // NOTE: With a pixel unpack buffer bound, data parameter is an offset into the buffer
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, stream->width, stream->height, glFormat, glType, 0);
+        RLGL.Stats.uploadedBytes += stream->size;
+
+        if (RLGL.ExtSupported.sync) stream->syncFences[stream->currentSlot] = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Texture stream buffer data corrupted, update skipped", stream->textureId);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif
+}
+
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(void)
+{
+    unsigned int fboId = 0;
+
+#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+#endif
+
+    return fboId;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-RaylibColor, 1-Depth renderbuffer, 2-Depth texture
+void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+{
+#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        case RL_ATTACHMENT_COLOR_CHANNEL1:
+        case RL_ATTACHMENT_COLOR_CHANNEL2:
+        case RL_ATTACHMENT_COLOR_CHANNEL3:
+        case RL_ATTACHMENT_COLOR_CHANNEL4:
+        case RL_ATTACHMENT_COLOR_CHANNEL5:
+        case RL_ATTACHMENT_COLOR_CHANNEL6:
+        case RL_ATTACHMENT_COLOR_CHANNEL7:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
+            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        case RL_ATTACHMENT_STENCIL:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        default: break;
+    }
+
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+}
+
+// Verify render texture is complete
+bool rlFramebufferComplete(unsigned int id)
+{
+    bool result = false;
+
+#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: RAYLIB_TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+            default: break;
+        }
+    }
+
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Unload framebuffer from GPU memory
+// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
+void rlUnloadFramebuffer(unsigned int id)
+{
+#if (defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    // Query depth attachment to automatically delete texture/renderbuffer
+    int depthType = 0, depthId = 0;
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+
+    // TODO: Review warning retrieving object name in WebGL
+    // WARNING: WebGL: INVALID_ENUM: getFramebufferAttachmentParameter: invalid parameter name
+    // https://registry.khronos.org/webgl/specs/latest/1.0/
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
+    else if (depthType == GL_TEXTURE) rlUnloadTexture(depthIdU);
+
+    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
+    // the texture image is automatically detached from the currently bound framebuffer.
+
+    rlCacheBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &id);
+
+    RAYLIB_TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#endif
+}
+
+// Vertex data management
+//-----------------------------------------------------------------------------------------
+// Load a new attributes buffer
+unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#endif
+
+    return id;
+}
+
+// Load a new attributes element buffer
+unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#endif
+
+    return id;
+}
+
+// Enable vertex buffer (VBO)
+void rlEnableVertexBuffer(unsigned int id)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer (VBO)
+void rlDisableVertexBuffer(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Enable vertex buffer element (VBO element)
+void rlEnableVertexBufferElement(unsigned int id)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer element (VBO element)
+void rlDisableVertexBufferElement(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Update vertex buffer with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+
+    RLGL.Stats.uploadedBytes += dataSize;
+#endif
+}
+
+// Update vertex buffer elements with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+
+    RLGL.Stats.uploadedBytes += dataSize;
+#endif
+}
+
+// Enable vertex array object (VAO)
+bool rlEnableVertexArray(unsigned int vaoId)
+{
+    bool result = false;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlCacheBindVertexArray(vaoId);
+        result = true;
+    }
+#endif
+    return result;
+}
+
+// Disable vertex array object (VAO)
+void rlDisableVertexArray(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+#endif
+}
+
+// Enable vertex attribute index
+void rlEnableVertexAttribute(unsigned int index)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glEnableVertexAttribArray(index);
+#endif
+}
+
+// Disable vertex attribute index
+void rlDisableVertexAttribute(unsigned int index)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glDisableVertexAttribArray(index);
+#endif
+}
+
+// Draw vertex array
+void rlDrawVertexArray(int offset, int count)
+{
+    glDrawArrays(GL_TRIANGLES, offset, count);
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertexCount += count;
+#endif
+}
+
+// Draw vertex array elements
+void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
+{
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned short *bufferPtr = (unsigned short *)buffer;
+    if (offset > 0) bufferPtr += offset;
+
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertexCount += count;
+#endif
+}
+
+// Draw vertex array instanced
+void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertexCount += count*instances;
+#endif
+}
+
+// Draw vertex array elements instanced
+void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned short *bufferPtr = (unsigned short *)buffer;
+    if (offset > 0) bufferPtr += offset;
+
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertexCount += count*instances;
+#endif
+}
+
+// Check if indirect multi-draw is supported (OpenGL 4.3)
+bool rlIsDrawIndirectSupported(void)
+{
+    bool supported = false;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    supported = RLGL.ExtSupported.drawIndirect;
+#endif
+    return supported;
+}
+
+// Draw vertex array elements with multiple draw commands from buffer (rlDrawIndirectCommand)
+// NOTE: Currently active vao is used, indices are unsigned short (baseVertex offsets meshes in shared buffers),
+// offset and drawCount are measured in commands; vertex count is not registered on render statistics (GPU side)
+void rlDrawVertexArrayElementsIndirect(unsigned int commandsId, int offset, int drawCount)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    if (!RLGL.ExtSupported.drawIndirect || (drawCount <= 0)) return;
+
+    // Commands or instanced attributes could have been written by a compute shader
+    if (RLGL.State.computeBarrierRequired)
+    {
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT);
+        RLGL.State.computeBarrierRequired = false;
+    }
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandsId);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)((size_t)offset*sizeof(rlDrawIndirectCommand)), drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    RLGL.Stats.drawCalls++;
+#endif
+}
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+// Enable vertex state pointer
+void rlEnableStatePointer(int vertexAttribType, void *buffer)
+{
+    if (buffer != NULL) glEnableClientState(vertexAttribType);
+    switch (vertexAttribType)
+    {
+        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
+        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
+        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
+        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
+        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
+        default: break;
+    }
+}
+
+// Disable vertex state pointer
+void rlDisableStatePointer(int vertexAttribType)
+{
+    glDisableClientState(vertexAttribType);
+}
+#endif
+
+// Load vertex array object (VAO)
+unsigned int rlLoadVertexArray(void)
+{
+    unsigned int vaoId = 0;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        glGenVertexArrays(1, &vaoId);
+    }
+#endif
+    return vaoId;
+}
+
+// Set vertex attribute
+void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Data type could be: GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT, GL_INT, GL_UNSIGNED_INT
+    // Additional types (depends on OpenGL version or extensions):
+    //  - GL_HALF_FLOAT, GL_FLOAT, GL_DOUBLE, GL_FIXED,
+    //  - GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT_10F_11F_11F_REV
+    glVertexAttribPointer(index, compSize, type, normalized, stride, (void *)offset);
+#endif
+}
+
+// Set vertex attribute divisor
+void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glVertexAttribDivisor(index, divisor);
+#endif
+}
+
+// Unload vertex array object (VAO)
+void rlUnloadVertexArray(unsigned int vaoId)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlCacheBindVertexArray(0);
+        glDeleteVertexArrays(1, &vaoId);
+        RAYLIB_TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+    }
+#endif
+}
+
+// Unload vertex buffer (VBO)
+void rlUnloadVertexBuffer(unsigned int vboId)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glDeleteBuffers(1, &vboId);
+    //RAYLIB_TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+#endif
+}
+
+// Shaders management
+//-----------------------------------------------------------------------------------------------
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    unsigned int vertexShaderId = 0;
+    unsigned int fragmentShaderId = 0;
+
+    // Compile vertex shader (if provided)
+    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
+    // In case no vertex shader was provided or compilation failed, we use default vertex shader
+    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+
+    // Compile fragment shader (if provided)
+    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+    // In case no fragment shader was provided or compilation failed, we use default fragment shader
+    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+
+    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
+    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
+    else
+    {
+        // One of or both shader are new, we need to compile a new shader program
+        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        // We can detach and delete vertex/fragment shaders (if not default ones)
+        // NOTE: We detach shader before deletion to make sure memory is freed
+        if (vertexShaderId != RLGL.State.defaultVShaderId)
+        {
+            // WARNING: RaylibShader program linkage could fail and returned id is 0
+            if (id > 0) glDetachShader(id, vertexShaderId);
+            glDeleteShader(vertexShaderId);
+        }
+        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+        {
+            // WARNING: RaylibShader program linkage could fail and returned id is 0
+            if (id > 0) glDetachShader(id, fragmentShaderId);
+            glDeleteShader(fragmentShaderId);
+        }
+
+        // In case shader program loading failed, we assign default shader
+        if (id == 0)
+        {
+            // In case shader loading fails, we return the default shader
+            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+            id = RLGL.State.defaultShaderId;
+        }
+        /*
+        else
+        {
+            // Get available shader uniforms
+            // NOTE: This information is useful for debug...
+            int uniformCount = -1;
+            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+            for (int i = 0; i < uniformCount; i++)
+            {
+                int namelen = -1;
+                int num = -1;
+                char name[256] = { 0 };     // Assume no variable names longer than 256
+                GLenum type = GL_ZERO;
+
+                // Get the name of the uniforms
+                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+
+                name[namelen] = 0;
+                RAYLIB_TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+            }
+        }
+        */
+    }
+#endif
+
+    return id;
+}
+
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
+{
+    unsigned int shader = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderCode, NULL);
+
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
+            case GL_FRAGMENT_SHADER: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
+        #endif
+            default: break;
+        }
+
+        int maxLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetShaderInfoLog(shader, maxLength, &length, log);
+            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
+            RL_FREE(log);
+        }
+    }
+    else
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
+            case GL_FRAGMENT_SHADER: RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
+        #endif
+            default: break;
+        }
+    }
+#endif
+
+    return shader;
+}
+
+// Load custom shader strings and return program id
+unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    GLint success = 0;
+    program = glCreateProgram();
+
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    // NOTE: Default attribute shader locations must be Bound before linking
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    // Program binary must be requested before linking to be retrieved later (program binary caching)
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // NOTE: Program id could be reused from a deleted program, remove any stale cached location
+        rlClearUniformLocations(program);
+        rlCheckTexSlotShader(program, true);
+    #if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+        rlBindCameraUniformBlock(program);
+    #endif
+
+        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+    }
+#endif
+    return program;
+}
+
+// Unload shader program
+void rlUnloadShaderProgram(unsigned int id)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    glDeleteProgram(id);
+
+    // Deleted program id could be reused
+    if (RLGL.State.cachedShaderId == id) RLGL.State.cachedShaderId = RL_STATE_CACHE_INVALID;
+    rlClearUniformLocations(id);
+    rlCheckTexSlotShader(id, false);
+
+    RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+#endif
+}
+
+// Get shader program binary
+// NOTE: Program binary is driver specific, it can be rejected after a driver update (not available on OpenGL ES 2.0)
+unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize, unsigned int *format)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+    *format = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.programBinary || (id == 0)) return NULL;
+
+    // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero
+    GLint binarySize = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+    if (binarySize > 0)
+    {
+        GLsizei length = 0;
+        GLenum binaryFormat = 0;
+        data = (unsigned char *)RL_MALLOC(binarySize);
+        glGetProgramBinary(id, binarySize, &length, &binaryFormat, data);
+
+        if (length > 0)
+        {
+            *dataSize = length;
+            *format = binaryFormat;
+        }
+        else
+        {
+            RL_FREE(data);
+            data = NULL;
+        }
+    }
+#endif
+
+    return data;
+}
+
+// Load shader program from binary
+// NOTE: Driver could reject the binary (driver or hardware changed), 0 is returned and program must be compiled from code
+unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize, unsigned int format)
+{
+    unsigned int program = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.programBinary || (data == NULL) || (dataSize <= 0)) return 0;
+
+    GLint success = 0;
+    program = glCreateProgram();
+    glProgramBinary(program, format, data, dataSize);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        RAYLIB_TRACELOG(RL_LOG_DEBUG, "SHADER: [ID %i] Program binary rejected by driver", program);
+        glDeleteProgram(program);
+        program = 0;
+    }
+    else
+    {
+        // NOTE: Uniform block bindings are not part of program binary, they are reset on load
+        rlClearUniformLocations(program);
+        rlCheckTexSlotShader(program, true);
+        rlBindCameraUniformBlock(program);
+
+        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary", program);
+    }
+#endif
+
+    return program;
+}
+
+// Get shader code hash for program binary caching (FNV-1a, 64bit)
+// NOTE: GL vendor, renderer and version are hashed, a driver change produces a different hash
+// NOTE: NULL code is linked against default shader, its source is hashed instead (changes with rlgl)
+unsigned long long rlGetShaderCodeHash(const char *vsCode, const char *fsCode)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    char *defaultCode[2] = { NULL, NULL };
+    unsigned int defaultShaderIds[2] = { RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (((i == 0) && (vsCode != NULL)) || ((i == 1) && (fsCode != NULL))) continue;
+
+        int length = 0;
+        glGetShaderiv(defaultShaderIds[i], GL_SHADER_SOURCE_LENGTH, &length);
+
+        if (length > 0)
+        {
+            defaultCode[i] = (char *)RL_CALLOC(length + 1, sizeof(char));
+            glGetShaderSource(defaultShaderIds[i], length + 1, NULL, defaultCode[i]);
+        }
+    }
+
+    const char *strings[5] = { (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION),
+                               (vsCode != NULL)? vsCode : defaultCode[0], (fsCode != NULL)? fsCode : defaultCode[1] };
+
+    for (int i = 0; i < 5; i++)
+    {
+        // NOTE: Strings are separated, hash differs if code moves between shaders
+        for (const unsigned char *c = (const unsigned char *)strings[i]; (c != NULL) && (*c != '\0'); c++)
+        {
+            hash ^= *c;
+            hash *= 1099511628211ULL;
+        }
+
+        hash ^= 0xff;
+        hash *= 1099511628211ULL;
+    }
+
+    RL_FREE(defaultCode[0]);
+    RL_FREE(defaultCode[1]);
+#endif
+
+    return hash;
+}
+
+// Get shader location uniform
+// NOTE: Locations are cached by shader id and name, program is not queried again for the same uniform
+int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+{
+    int location = -1;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if ((shaderId == 0) || (uniformName == NULL)) return -1;
+
+    // Get uniform name hash (FNV-1a) and length, long names are not cached
+    unsigned int hash = 2166136261u;
+    int length = 0;
+    for (const unsigned char *c = (const unsigned char *)uniformName; *c != '\0'; c++, length++)
+    {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+
+    if (length >= RL_MAX_UNIFORM_NAME_SIZE) return glGetUniformLocation(shaderId, uniformName);
+
+    // Look for location in shader id and name hash set (4 entries)
+    rlUniformLocation *set = &RLGL.UniformLocations.entries[((hash ^ (shaderId*2654435761u))%(RL_UNIFORM_LOCATION_CACHE_SIZE/4))*4];
+    rlUniformLocation *entry = NULL;
+
+    for (int i = 0; i < 4; i++)
+    {
+        if ((set[i].shaderId == shaderId) && (set[i].hash == hash) && (strcmp(set[i].name, uniformName) == 0)) return set[i].location;
+        if ((entry == NULL) && (set[i].shaderId == 0)) entry = &set[i];
+    }
+
+    location = glGetUniformLocation(shaderId, uniformName);
+
+    // Register location on an empty entry or replace one if the set is full
+    if (entry == NULL) entry = &set[(RLGL.UniformLocations.evictCounter++)%4];
+
+    entry->shaderId = shaderId;
+    entry->hash = hash;
+    entry->location = location;
+    memcpy(entry->name, uniformName, length + 1);
+
+    //if (location == -1) RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
+    //else RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] RaylibShader uniform (%s) set at location: %i", shaderId, uniformName, location);
+#endif
+    return location;
+}
+
+// Get shader location attribute
+int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+{
+    int location = -1;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    location = glGetAttribLocation(shaderId, attribName);
+
+    //if (location == -1) RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
+    //else RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] RaylibShader attribute (%s) set at location: %i", shaderId, attribName, location);
+#endif
+    return location;
+}
+
+// Set shader value uniform
+void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
+        default: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value attribute
+void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    switch (attribType)
+    {
+        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
+        default: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value uniform matrix
+void rlSetUniformMatrix(int locIndex, RaylibMatrix mat)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    float matfloat[16] = {
+        mat.m0, mat.m1, mat.m2, mat.m3,
+        mat.m4, mat.m5, mat.m6, mat.m7,
+        mat.m8, mat.m9, mat.m10, mat.m11,
+        mat.m12, mat.m13, mat.m14, mat.m15
+    };
+    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+#endif
+}
+
+// Set shader value uniform sampler
+void rlSetUniformSampler(int locIndex, unsigned int textureId)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // Check if texture is already active
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] == textureId)
+        {
+            glUniform1i(locIndex, 1 + i);
+            return;
+        }
+    }
+
+    // Register a new active texture for the internal batch system
+    // NOTE: Default texture is always activated as GL_TEXTURE0
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] == 0)
+        {
+            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            break;
+        }
+    }
+#endif
+}
+
+// Set shader currently active (id and locations)
+void rlSetShader(unsigned int id, int *locs)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentShaderId != id)
+    {
+        // NOTE: In deferred draw mode shader is registered with the draw call instead of forcing a batch draw
+        if (!RLGL.State.deferredDraw) rlFlushRenderBatch(&RLGL.Stats.flushShaderChange);
+        RLGL.State.currentShaderId = id;
+        RLGL.State.currentShaderLocs = locs;
+        if (RLGL.State.deferredDraw) rlNextDrawCall();
+    }
+#endif
+}
+
+// Set camera matrices uniform block (shared by all shaders declaring it)
+// NOTE: Block is uploaded once per camera change (i.e. RaylibBeginMode3D()), shaders using it only require the model matrix per draw,
+// upload is skipped until a shader declaring RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA is loaded,
+// on stereo render the block is uploaded again per eye (see rlSetUniformBlockCameraEye())
+void rlSetUniformBlockCamera(RaylibMatrix view, RaylibMatrix projection)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    RLGL.CameraBlock.view = view;
+
+    rlUploadCameraBlock(view, projection);
+#endif
+}
+
+// Set camera matrices uniform block for stereo render eye
+// NOTE: Camera block is shared by all the draws, it must be uploaded again on every eye of a stereo draw
+void rlSetUniformBlockCameraEye(int eye)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if ((eye < 0) || (eye > 1)) return;
+
+    rlUploadCameraBlock(rlMatrixMultiply(RLGL.CameraBlock.view, RLGL.State.viewOffsetStereo[eye]), RLGL.State.projectionStereo[eye]);
+#endif
+}
+
+// Load compute shader program
+unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+{
+    unsigned int program = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, shaderId);
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+    }
+#endif
+
+    return program;
+}
+
+// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
+void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glDispatchCompute(groupX, groupY, groupZ);
+    RLGL.State.computeBarrierRequired = true;
+#endif
+}
+
+// Load shader storage buffer object (SSBO)
+unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
+{
+    unsigned int ssbo = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glGenBuffers(1, &ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
+    if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);    // Clear buffer data to 0
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+#endif
+
+    return ssbo;
+}
+
+// Unload shader storage buffer object (SSBO)
+void rlUnloadShaderBuffer(unsigned int ssboId)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glDeleteBuffers(1, &ssboId);
+#endif
+}
+
+// Update SSBO buffer data
+void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+
+    RLGL.Stats.uploadedBytes += dataSize;
+#endif
+}
+
+// Get SSBO buffer size
+unsigned int rlGetShaderBufferSize(unsigned int id)
+{
+    long long size = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
+#endif
+
+    return (size > 0)? (unsigned int)size : 0;
+}
+
+// Read SSBO buffer data (GPU->CPU)
+void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, unsigned int offset)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
+#endif
+}
+
+// Bind SSBO buffer
+void rlBindShaderBuffer(unsigned int id, unsigned int index)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+#endif
+}
+
+// Copy SSBO buffer data
+void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int destOffset, unsigned int srcOffset, unsigned int count)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
+#endif
+}
+
+// Bind image texture
+void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    unsigned int glInternalFormat = 0, glFormat = 0, glType = 0;
+
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    glBindImageTexture(index, id, 0, 0, 0, readonly? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+#endif
+}
+
+// RaylibMatrix state management
+//-----------------------------------------------------------------------------------------
+// Get internal modelview matrix
+RaylibMatrix rlGetMatrixModelview(void)
+{
+    RaylibMatrix matrix = rlMatrixIdentity();
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
+    matrix.m0 = mat[0];
+    matrix.m1 = mat[1];
+    matrix.m2 = mat[2];
+    matrix.m3 = mat[3];
+    matrix.m4 = mat[4];
+    matrix.m5 = mat[5];
+    matrix.m6 = mat[6];
+    matrix.m7 = mat[7];
+    matrix.m8 = mat[8];
+    matrix.m9 = mat[9];
+    matrix.m10 = mat[10];
+    matrix.m11 = mat[11];
+    matrix.m12 = mat[12];
+    matrix.m13 = mat[13];
+    matrix.m14 = mat[14];
+    matrix.m15 = mat[15];
+#else
+    matrix = RLCTX->modelview;
+#endif
+    return matrix;
+}
+
+// Get internal projection matrix
+RaylibMatrix rlGetMatrixProjection(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_PROJECTION_MATRIX,mat);
+    RaylibMatrix m;
+    m.m0 = mat[0];
+    m.m1 = mat[1];
+    m.m2 = mat[2];
+    m.m3 = mat[3];
+    m.m4 = mat[4];
+    m.m5 = mat[5];
+    m.m6 = mat[6];
+    m.m7 = mat[7];
+    m.m8 = mat[8];
+    m.m9 = mat[9];
+    m.m10 = mat[10];
+    m.m11 = mat[11];
+    m.m12 = mat[12];
+    m.m13 = mat[13];
+    m.m14 = mat[14];
+    m.m15 = mat[15];
+    return m;
+#else
+    return RLCTX->projection;
+#endif
+}
+
+// Get internal accumulated transform matrix
+RaylibMatrix rlGetMatrixTransform(void)
+{
+    RaylibMatrix mat = rlMatrixIdentity();
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // TODO: Consider possible transform matrices in the RLCTX->stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //RaylibMatrix matStackTransform = rlMatrixIdentity();
+    //for (int i = RLCTX->stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLCTX->stack[i], matStackTransform);
+    mat = RLCTX->transform;
+#endif
+    return mat;
+}
+
+// Get internal projection matrix for stereo render (selected eye)
+RAYLIB_RLAPI RaylibMatrix rlGetMatrixProjectionStereo(int eye)
+{
+    RaylibMatrix mat = rlMatrixIdentity();
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    mat = RLGL.State.projectionStereo[eye];
+#endif
+    return mat;
+}
+
+// Get internal view offset matrix for stereo render (selected eye)
+RAYLIB_RLAPI RaylibMatrix rlGetMatrixViewOffsetStereo(int eye)
+{
+    RaylibMatrix mat = rlMatrixIdentity();
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    mat = RLGL.State.viewOffsetStereo[eye];
+#endif
+    return mat;
+}
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void rlSetMatrixModelview(RaylibMatrix view)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLCTX->modelview = view;
+#endif
+}
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void rlSetMatrixProjection(RaylibMatrix projection)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLCTX->projection = projection;
+#endif
+}
+
+// Set eyes projection matrices for stereo rendering
+void rlSetMatrixProjectionStereo(RaylibMatrix right, RaylibMatrix left)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.projectionStereo[0] = right;
+    RLGL.State.projectionStereo[1] = left;
+#endif
+}
+
+// Set eyes view offsets matrices for stereo rendering
+void rlSetMatrixViewOffsetStereo(RaylibMatrix right, RaylibMatrix left)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewOffsetStereo[0] = right;
+    RLGL.State.viewOffsetStereo[1] = left;
+#endif
+}
+
+// Load and draw a quad in NDC
+void rlLoadDrawQuad(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    unsigned int quadVAO = 0;
+    unsigned int quadVBO = 0;
+
+    float vertices[] = {
+         // Positions         Texcoords
+        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &quadVAO);
+    rlCacheBindVertexArray(quadVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &quadVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, texcoords)
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+
+    // Draw quad
+    rlCacheBindVertexArray(quadVAO);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertexCount += 4;
+    rlCacheBindVertexArray(0);
+
+    // Delete buffers (VBO and VAO)
+    glDeleteBuffers(1, &quadVBO);
+    glDeleteVertexArrays(1, &quadVAO);
+#endif
+}
+
+// Load and draw a cube in NDC
+void rlLoadDrawCube(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    unsigned int cubeVAO = 0;
+    unsigned int cubeVBO = 0;
+
+    float vertices[] = {
+         // Positions          Normals               Texcoords
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &cubeVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, normals, texcoords)
+    rlCacheBindVertexArray(cubeVAO);
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlCacheBindVertexArray(0);
+
+    // Draw cube
+    rlCacheBindVertexArray(cubeVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 36);
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertexCount += 36;
+    rlCacheBindVertexArray(0);
+
+    // Delete VBO and VAO
+    glDeleteBuffers(1, &cubeVBO);
+    glDeleteVertexArrays(1, &cubeVAO);
+#endif
+}
+
+// Get name string for pixel format
+const char *rlGetPixelFormatName(unsigned int format)
+{
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: return "R16"; break;                     // 16 bpp (1 channel - half float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: return "R16G16B16"; break;         // 16*3 bpp (3 channels - half float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: return "R16G16B16A16"; break;   // 16*4 bpp (4 channels - half float)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
+        case RL_PIXELFORMAT_COMPRESSED_BC4_R: return "BC4_R"; break;                   // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_BC5_RG: return "BC5_RG"; break;                 // 8 bpp
+        default: return "UNKNOWN"; break;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlLoadShaderDefault(void)
+{
+    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderCode =
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderCode =
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    // NOTE: Compiled vertex/fragment shaders are not deleted,
+    // they are kept for re-use as default shaders in case some shader loading fails
+    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+
+    if (RLGL.State.defaultShaderId > 0)
+    {
+        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+
+        // Set default shader locations: attributes locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+
+        // Set default shader locations: uniform locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+        // Load default shader variant for multi-texture draws
+        if (RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS > 1) rlLoadShaderMultiTexture();
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+}
+
+// Unload default shader
+// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlUnloadShaderDefault(void)
+{
+    rlCacheUseProgram(0);
+
+    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
+    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+    glDeleteShader(RLGL.State.defaultVShaderId);
+    glDeleteShader(RLGL.State.defaultFShaderId);
+
+    glDeleteProgram(RLGL.State.defaultShaderId);
+
+    RL_FREE(RLGL.State.defaultShaderLocs);
+
+    RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+
+    if (RLGL.State.multiTextureShaderId > 0)
+    {
+        glDetachShader(RLGL.State.multiTextureShaderId, RLGL.State.multiTextureVShaderId);
+        glDetachShader(RLGL.State.multiTextureShaderId, RLGL.State.multiTextureFShaderId);
+        glDeleteProgram(RLGL.State.multiTextureShaderId);
+
+        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default multi-texture shader unloaded successfully", RLGL.State.multiTextureShaderId);
+    }
+
+    if (RLGL.State.multiTextureVShaderId > 0) glDeleteShader(RLGL.State.multiTextureVShaderId);
+    if (RLGL.State.multiTextureFShaderId > 0) glDeleteShader(RLGL.State.multiTextureFShaderId);
+    RL_FREE(RLGL.State.multiTextureShaderLocs);
+
+    RLGL.State.multiTextureVShaderId = 0;
+    RLGL.State.multiTextureFShaderId = 0;
+    RLGL.State.multiTextureShaderId = 0;
+    RLGL.State.multiTextureShaderLocs = NULL;
+}
+
+// Load default shader multi-texture variant
+// NOTE: Same as default shader, but fragment texture is sampled from one of RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
+// samplers (texture0, texture1...), selected by vertex texture slot, samplers are assigned to texture units on loading
+static void rlLoadShaderMultiTexture(void)
+{
+    const char *vShaderCode =
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+#endif
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader code is generated for the number of texture units
+    // NOTE: Samplers can not be indexed by a non-constant expression on GLSL 100/120, texture slot is checked in order
+    const char *fShaderHeader =
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+    "uniform vec4 colDiffuse;           \n";
+    const char *textureFunc = "texture2D";
+    const char *finalColor = "gl_FragColor";
+#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n";
+    const char *textureFunc = "texture";
+    const char *finalColor = "finalColor";
+#endif
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+    "uniform vec4 colDiffuse;           \n";
+    const char *textureFunc = "texture2D";
+    const char *finalColor = "gl_FragColor";
+#endif
+
+    int codeSize = 1024 + RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS*128;
+    char *fShaderCode = (char *)RL_CALLOC(codeSize, sizeof(char));
+    int length = snprintf(fShaderCode, codeSize, "%s", fShaderHeader);
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) length += snprintf(fShaderCode + length, codeSize - length, "uniform sampler2D texture%i;\n", i);
+
+    length += snprintf(fShaderCode + length, codeSize - length, "void main()\n{\n    vec4 texelColor;\n");
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS - 1; i++)
     {
-        // One of or both shader are new, we need to compile a new shader program
-        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+        length += snprintf(fShaderCode + length, codeSize - length, "    %sif (fragTexSlot < %i.5) texelColor = %s(texture%i, fragTexCoord);\n", (i > 0)? "else " : "", i, textureFunc, i);
+    }
 
-        // We can detach and delete vertex/fragment shaders (if not default ones)
-        // NOTE: We detach shader before deletion to make sure memory is freed
-        if (vertexShaderId != RLGL.State.defaultVShaderId)
-        {
-            // WARNING: RaylibShader program linkage could fail and returned id is 0
-            if (id > 0) glDetachShader(id, vertexShaderId);
-            glDeleteShader(vertexShaderId);
-        }
-        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+    length += snprintf(fShaderCode + length, codeSize - length, "    else texelColor = %s(texture%i, fragTexCoord);\n", textureFunc, RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS - 1);
+    length += snprintf(fShaderCode + length, codeSize - length, "    %s = texelColor*colDiffuse*fragColor;\n}\n", finalColor);
+
+    RLGL.State.multiTextureVShaderId = rlCompileShader(vShaderCode, GL_VERTEX_SHADER);
+    RLGL.State.multiTextureFShaderId = rlCompileShader(fShaderCode, GL_FRAGMENT_SHADER);
+    RL_FREE(fShaderCode);
+
+    if ((RLGL.State.multiTextureVShaderId > 0) && (RLGL.State.multiTextureFShaderId > 0)) RLGL.State.multiTextureShaderId = rlLoadShaderProgram(RLGL.State.multiTextureVShaderId, RLGL.State.multiTextureFShaderId);
+
+    if (RLGL.State.multiTextureShaderId > 0)
+    {
+        RLGL.State.multiTextureShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.multiTextureShaderLocs[i] = -1;
+
+        // Set shader locations, same as default shader
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+        // Assign samplers to texture units: textureN -> unit N
+        rlCacheUseProgram(RLGL.State.multiTextureShaderId);
+        for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
         {
-            // WARNING: RaylibShader program linkage could fail and returned id is 0
-            if (id > 0) glDetachShader(id, fragmentShaderId);
-            glDeleteShader(fragmentShaderId);
+            char samplerName[32] = { 0 };
+            snprintf(samplerName, sizeof(samplerName), "texture%i", i);
+            glUniform1i(glGetUniformLocation(RLGL.State.multiTextureShaderId, samplerName), i);
         }
+        rlCacheUseProgram(0);
 
-        // In case shader program loading failed, we assign default shader
-        if (id == 0)
+        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default multi-texture shader loaded successfully (%i texture units)", RLGL.State.multiTextureShaderId, RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS);
+    }
+    else RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load default multi-texture shader, batch draws use a single texture");
+}
+
+// Apply blending mode to OpenGL state
+static void rlApplyBlendMode(int mode)
+{
+    RLGL.Stats.stateChangesIssued++;
+
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
         {
-            // In case shader loading fails, we return the default shader
-            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
-            id = RLGL.State.defaultShaderId;
-        }
-        /*
-        else
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
         {
-            // Get available shader uniforms
-            // NOTE: This information is useful for debug...
-            int uniformCount = -1;
-            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
+            glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
+            glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
 
-            for (int i = 0; i < uniformCount; i++)
-            {
-                int namelen = -1;
-                int num = -1;
-                char name[256] = { 0 };     // Assume no variable names longer than 256
-                GLenum type = GL_ZERO;
+        } break;
+        default: break;
+    }
+}
 
-                // Get the name of the uniforms
-                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+// Record current state (shader, blend, layer, matrices) in draw call
+static void rlSetDrawCallState(rlDrawCall *draw)
+{
+    draw->projection = RLCTX->projection;
+    draw->modelview = RLCTX->modelview;
 
-                name[namelen] = 0;
-                RAYLIB_TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
-            }
-        }
-        */
-    }
-#endif
+    // Worker recording contexts do not read renderer state, it is owned by main thread
+    // NOTE: Recorded draw calls only keep mode and textures, state is set on submission
+    if (RLCTX != &RLGL.Record) return;
 
-    return id;
+    draw->shaderId = RLGL.State.currentShaderId;
+    draw->shaderLocs = RLGL.State.currentShaderLocs;
+    draw->blendMode = RLGL.State.currentBlendMode;
+    draw->layer = RLGL.State.currentLayer;
 }
 
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
+// Set draw call single texture (slot 0)
+static void rlSetDrawCallTexture(rlDrawCall *draw, unsigned int id)
 {
-    unsigned int shader = 0;
+    draw->textureId = id;
+    draw->textureIds[0] = id;
+    draw->textureCount = 1;
+}
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderCode, NULL);
+// Finish current draw call (if not empty) and register a new one with current state
+// NOTE: Used on deferred draw mode for state changes that otherwise force a batch draw
+static void rlNextDrawCall(void)
+{
+    if (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount > 0)
+    {
+        rlDrawCall previous = RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1];
+        int mode = previous.mode;
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        // Make sure current draw vertexCount is aligned for following QUADS drawing (same as rlSetTexture())
+        if (mode == RL_LINES) RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount < 4)? RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount : RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4);
+        else if (mode == RL_TRIANGLES) RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = ((RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount%4)));
+        else RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment = 0;
 
-    if (success == GL_FALSE)
-    {
-        switch (type)
+        if (!rlCheckRenderBatchLimit(RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment))
         {
-            case GL_VERTEX_SHADER: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
-            case GL_FRAGMENT_SHADER: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
-        #endif
-            default: break;
+            RLCTX->vertexCounter += RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexAlignment;
+            RLCTX->currentBatch->drawCounter++;
         }
 
-        int maxLength = 0;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+        if (RLCTX->currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlFlushRenderBatch(&RLGL.Stats.flushDrawCallsLimit);
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetShaderInfoLog(shader, maxLength, &length, log);
-            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
-            RL_FREE(log);
-        }
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].mode = mode;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].textureId = previous.textureId;
+        memcpy(RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].textureIds, previous.textureIds, sizeof(previous.textureIds));
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].textureCount = previous.textureCount;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount = 0;
     }
-    else
+
+    // Multiple textures are only supported by default shader, keep current texture only
+    rlDrawCall *draw = &RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1];
+
+    if ((draw->textureCount > 1) && (RLGL.State.currentShaderId != RLGL.State.defaultShaderId))
     {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
-            case GL_FRAGMENT_SHADER: RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
-        #endif
-            default: break;
-        }
+        rlSetDrawCallTexture(draw, draw->textureIds[RLCTX->texslot]);
+        RLCTX->texslot = 0;
     }
-#endif
 
-    return shader;
+    rlSetDrawCallState(draw);
 }
 
-// Load custom shader strings and return program id
-unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Draw active render batch, registering the reason on render statistics
+// NOTE: Only batches with vertex data are registered
+// NOTE: On display list or worker context recording, batch data is captured instead of drawn
+static void rlFlushRenderBatch(unsigned int *reasonCounter)
 {
-    unsigned int program = 0;
+    if (RLCTX->capturing)
+    {
+        rlCaptureRenderBatch(RLCTX->currentBatch);
+        return;
+    }
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    GLint success = 0;
-    program = glCreateProgram();
+    if (RLCTX->vertexCounter > 0) (*reasonCounter)++;
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+    rlDrawRenderBatch(RLCTX->currentBatch);
+}
 
-    // NOTE: Default attribute shader locations must be Bound before linking
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+// Capture batch vertex data and draw calls into current recording context
+// NOTE: Batch is reset as if it was drawn, consecutive draws with same mode and textures are merged
+static void rlCaptureRenderBatch(rlRenderBatch *batch)
+{
+    rlFlushTransformRun(batch);
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    int vertexCount = RLCTX->vertexCounter;
 
-    glLinkProgram(program);
+    if (vertexCount > 0)
+    {
+        // Captured vertex data must start aligned to 4 vertex for following QUADS drawing (index buffer)
+        int padding = (4 - RLCTX->captureVertexCount%4)%4;
+        int requiredVertices = RLCTX->captureVertexCount + padding + vertexCount;
+        int requiredDraws = RLCTX->captureDrawCount + batch->drawCounter;
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+        if (RLCTX->captureVertexCapacity < requiredVertices)
+        {
+            int capacity = (RLCTX->captureVertexCapacity > 0)? RLCTX->captureVertexCapacity : 4096;
+            while (capacity < requiredVertices) capacity *= 2;
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+            RLCTX->captureVertices = (rlBatchVertex *)RL_REALLOC(RLCTX->captureVertices, capacity*sizeof(rlBatchVertex));
+            RLCTX->captureVertexCapacity = capacity;
+        }
 
-    if (success == GL_FALSE)
-    {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+        if (RLCTX->captureDrawCapacity < requiredDraws)
+        {
+            int capacity = (RLCTX->captureDrawCapacity > 0)? RLCTX->captureDrawCapacity : RL_DEFAULT_BATCH_DRAWCALLS;
+            while (capacity < requiredDraws) capacity *= 2;
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+            RLCTX->captureDraws = (rlDrawCall *)RL_REALLOC(RLCTX->captureDraws, capacity*sizeof(rlDrawCall));
+            RLCTX->captureDrawCapacity = capacity;
+        }
 
-        if (maxLength > 0)
+        if (padding > 0)
         {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
+            memset(RLCTX->captureVertices + RLCTX->captureVertexCount, 0, padding*sizeof(rlBatchVertex));
+            RLCTX->captureDraws[RLCTX->captureDrawCount - 1].vertexAlignment += padding;
+            RLCTX->captureVertexCount += padding;
         }
 
-        glDeleteProgram(program);
+        memcpy(RLCTX->captureVertices + RLCTX->captureVertexCount, batch->vertexBuffer[batch->currentBuffer].data, vertexCount*sizeof(rlBatchVertex));
+        RLCTX->captureVertexCount += vertexCount;
 
-        program = 0;
+        for (int i = 0; i < batch->drawCounter; i++)
+        {
+            const rlDrawCall *draw = &batch->draws[i];
+            rlDrawCall *last = (RLCTX->captureDrawCount > 0)? &RLCTX->captureDraws[RLCTX->captureDrawCount - 1] : NULL;
+
+            if ((last != NULL) && (draw->vertexCount == 0)) last->vertexAlignment += draw->vertexAlignment;
+            else if ((last != NULL) && (last->vertexAlignment == 0) && (last->mode == draw->mode) &&
+                (last->textureCount == draw->textureCount) && (memcmp(last->textureIds, draw->textureIds, draw->textureCount*sizeof(unsigned int)) == 0))
+            {
+                last->vertexCount += draw->vertexCount;
+                last->vertexAlignment = draw->vertexAlignment;
+            }
+            else if ((draw->vertexCount > 0) || (draw->vertexAlignment > 0))
+            {
+                RLCTX->captureDraws[RLCTX->captureDrawCount] = *draw;
+                RLCTX->captureDrawCount++;
+            }
+        }
     }
-    else
-    {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
-        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+    // Reset batch for next vertex data (same as rlDrawRenderBatch())
+    RLCTX->vertexCounter = 0;
+    RLCTX->transformRunStart = 0;
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        rlSetDrawCallTexture(&batch->draws[i], RLGL.State.defaultTextureId);
     }
-#endif
-    return program;
+
+    rlSetDrawCallState(&batch->draws[0]);
+    RLCTX->texslot = 0;
+    batch->drawCounter = 1;
 }
 
-// Unload shader program
-void rlUnloadShaderProgram(unsigned int id)
+// Transform vertex run added with current transform matrix, next vertex start a new run
+// NOTE: Called before transform matrix changes and before batch vertex data is drawn or captured,
+// vertex data is added untransformed and the whole contiguous run is transformed in a single pass,
+// persistently mapped vertex data is transformed on write instead (GPU memory is not read back)
+static void rlFlushTransformRun(rlRenderBatch *batch)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    glDeleteProgram(id);
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int start = RLCTX->transformRunStart;
+    int count = RLCTX->vertexCounter - start;
 
-    RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
-#endif
+    if (RLCTX->transformRequired && (count > 0) && !buffer->dataMapped)
+    {
+        if (buffer->layout != RL_BATCH_LAYOUT_SEPARATE) rlTransformVertices(buffer->data[start].position, buffer->data[start].normal, sizeof(rlBatchVertex)/sizeof(float), count, RLCTX->transform);
+        else rlTransformVertices(buffer->vertices + 3*start, buffer->normals + 3*start, 3, count, RLCTX->transform);
+    }
+
+    RLCTX->transformRunStart = RLCTX->vertexCounter;
 }
 
-// Get shader location uniform
-int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+// Transform vertex positions and normals, stride is the number of floats between consecutive vertex
+// NOTE: Normals are normalized after transform, they are not transformed on pure translations
+static void rlTransformVertices(float *positions, float *normals, int stride, int count, RaylibMatrix mat)
 {
-    int location = -1;
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shaderId, uniformName);
+#if defined(RLGL_SIMD_SSE)
+    const __m128 col0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, 0.0f);
+    const __m128 col1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, 0.0f);
+    const __m128 col2 = _mm_setr_ps(mat.m8, mat.m9, mat.m10, 0.0f);
+    const __m128 col3 = _mm_setr_ps(mat.m12, mat.m13, mat.m14, 0.0f);
 
-    //if (location == -1) RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
-    //else RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] RaylibShader uniform (%s) set at location: %i", shaderId, uniformName, location);
+    for (int i = 0; i < count; i++)
+    {
+        float *position = positions + i*stride;
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(position[0])), _mm_mul_ps(col1, _mm_set1_ps(position[1]))),
+                                   _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(position[2])), col3));
+
+        // Only XYZ are stored, next vertex data follows
+        _mm_storel_pi((__m64 *)position, result);
+        _mm_store_ss(position + 2, _mm_movehl_ps(result, result));
+    }
+#elif defined(RLGL_SIMD_NEON)
+    const float cols[16] = { mat.m0, mat.m1, mat.m2, 0.0f, mat.m4, mat.m5, mat.m6, 0.0f, mat.m8, mat.m9, mat.m10, 0.0f, mat.m12, mat.m13, mat.m14, 0.0f };
+    const float32x4_t col0 = vld1q_f32(cols);
+    const float32x4_t col1 = vld1q_f32(cols + 4);
+    const float32x4_t col2 = vld1q_f32(cols + 8);
+    const float32x4_t col3 = vld1q_f32(cols + 12);
+
+    for (int i = 0; i < count; i++)
+    {
+        float *position = positions + i*stride;
+        float32x4_t result = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, position[0]), col1, position[1]), col2, position[2]);
+
+        // Only XYZ are stored, next vertex data follows
+        vst1_f32(position, vget_low_f32(result));
+        vst1q_lane_f32(position + 2, result, 2);
+    }
+#else
+    for (int i = 0; i < count; i++)
+    {
+        float *position = positions + i*stride;
+        float x = position[0];
+        float y = position[1];
+        float z = position[2];
+
+        position[0] = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        position[1] = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        position[2] = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
 #endif
-    return location;
+
+    bool translationOnly = ((mat.m0 == 1.0f) && (mat.m1 == 0.0f) && (mat.m2 == 0.0f) &&
+                            (mat.m4 == 0.0f) && (mat.m5 == 1.0f) && (mat.m6 == 0.0f) &&
+                            (mat.m8 == 0.0f) && (mat.m9 == 0.0f) && (mat.m10 == 1.0f));
+
+    if ((normals != NULL) && !translationOnly)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            float *normal = normals + i*stride;
+            float x = normal[0];
+            float y = normal[1];
+            float z = normal[2];
+
+            float normalx = mat.m0*x + mat.m4*y + mat.m8*z;
+            float normaly = mat.m1*x + mat.m5*y + mat.m9*z;
+            float normalz = mat.m2*x + mat.m6*y + mat.m10*z;
+
+            float length = sqrtf(normalx*normalx + normaly*normaly + normalz*normalz);
+            if (length != 0.0f)
+            {
+                float ilength = 1.0f/length;
+                normalx *= ilength;
+                normaly *= ilength;
+                normalz *= ilength;
+            }
+
+            normal[0] = normalx;
+            normal[1] = normaly;
+            normal[2] = normalz;
+        }
+    }
 }
 
-// Get shader location attribute
-int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+// Set display list vertex attributes for currently bound vertex buffer (interleaved rlBatchVertex)
+static void rlSetDisplayListAttribs(void)
 {
-    int location = -1;
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    location = glGetAttribLocation(shaderId, attribName);
-
-    //if (location == -1) RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
-    //else RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] RaylibShader attribute (%s) set at location: %i", shaderId, attribName, location);
-#endif
-    return location;
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, normal));
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texslot));
 }
 
-// Set shader value uniform
-void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+// Read back GPU timer frame queries results if available
+// NOTE: Availability is checked for all scope end queries, results are never waited
+static bool rlResolveGpuTimerFrame(rlGpuTimerFrame *frame)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    switch (uniformType)
+    for (int i = 0; i < frame->timerCount; i++)
     {
-        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
-        default: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+        GLint available = 0;
+        glGetQueryObjectiv(frame->queryIds[2*i + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) return false;
     }
-#endif
+
+    for (int i = 0; i < frame->timerCount; i++)
+    {
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(frame->queryIds[2*i], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame->queryIds[2*i + 1], GL_QUERY_RESULT, &end);
+
+        frame->timers[i].time = (end > begin)? (float)((double)(end - begin)/1000000.0) : 0.0f;    // Nanoseconds to milliseconds
+    }
+
+    memcpy(RLGL.GpuTimers.results, frame->timers, frame->timerCount*sizeof(rlGpuTimer));
+    RLGL.GpuTimers.resultCount = frame->timerCount;
+    frame->pending = false;
+
+    return true;
 }
 
-// Set shader value attribute
-void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+// Bind shader camera uniform block (if declared) to camera block binding point
+static void rlBindCameraUniformBlock(unsigned int shaderId)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    switch (attribType)
-    {
-        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
-        default: RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+    if (!RLGL.ExtSupported.ubo) return;
+
+    unsigned int blockIndex = glGetUniformBlockIndex(shaderId, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA);
+
+    if (blockIndex != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(shaderId, blockIndex, RL_CAMERA_UNIFORM_BLOCK_BINDING);
+        RLGL.CameraBlock.used = true;
+
+        RAYLIB_TRACELOG(RL_LOG_DEBUG, "SHADER: [ID %i] Camera uniform block bound to binding point: %i", shaderId, RL_CAMERA_UNIFORM_BLOCK_BINDING);
     }
-#endif
 }
 
-// Set shader value uniform matrix
-void rlSetUniformMatrix(int locIndex, RaylibMatrix mat)
+// Upload camera matrices uniform block data, buffer is created on first upload
+static void rlUploadCameraBlock(RaylibMatrix view, RaylibMatrix projection)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
-#endif
+    if (!RLGL.ExtSupported.ubo || !RLGL.CameraBlock.used) return;
+
+    // NOTE: std140 layout, mat4 members are packed as 4 columns vec4 (same as rlMatrixToFloat())
+    float data[48] = { 0 };
+    memcpy(data, rlMatrixToFloat(view), 16*sizeof(float));
+    memcpy(data + 16, rlMatrixToFloat(projection), 16*sizeof(float));
+    memcpy(data + 32, rlMatrixToFloat(rlMatrixMultiply(view, projection)), 16*sizeof(float));
+
+    if (RLGL.CameraBlock.uboId == 0)
+    {
+        glGenBuffers(1, &RLGL.CameraBlock.uboId);
+        glBindBuffer(GL_UNIFORM_BUFFER, RLGL.CameraBlock.uboId);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(data), data, GL_DYNAMIC_DRAW);
+    }
+    else
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, RLGL.CameraBlock.uboId);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(data), data);
+    }
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, RL_CAMERA_UNIFORM_BLOCK_BINDING, RLGL.CameraBlock.uboId);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
+#endif
 
-// Set shader value uniform sampler
-void rlSetUniformSampler(int locIndex, unsigned int textureId)
+#if defined(RLGL_NULL_BACKEND)
+// Null backend: OpenGL functions stubs
+// NOTE: Functions with no effect on trace or returned values are resolved to typed no-op stubs
+//-----------------------------------------------------------------------------------------
+// Extensions reported by null backend, required by glad and enabling optional rlgl features
+static const char *rlNullExtensions[] = {
+    "GL_ARB_vertex_array_object", "GL_EXT_draw_instanced", "GL_ARB_instanced_arrays", "GL_ARB_texture_non_power_of_two",
+    "GL_ARB_texture_float", "GL_ARB_depth_texture", "GL_ARB_map_buffer_range", "GL_ARB_timer_query",
+    "GL_ARB_uniform_buffer_object", "GL_EXT_texture_compression_s3tc", "GL_EXT_texture_filter_anisotropic",
+    "GL_ARB_compute_shader", "GL_ARB_shader_storage_buffer_object", "GL_ARB_multi_draw_indirect", "GL_ARB_buffer_storage"
+};
+#define RL_NULL_EXTENSIONS_COUNT (sizeof(rlNullExtensions)/sizeof(rlNullExtensions[0]))
+
+// Record null backend trace command
+static void rlNullRecord(int type, unsigned int target, unsigned int id, unsigned int count, unsigned int instances, unsigned int bytes)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // Check if texture is already active
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    rlNullTrace *trace = &RLGL.NullBackend.trace;
+
+    switch (type)
     {
-        if (RLGL.State.activeTextureId[i] == textureId)
-        {
-            glUniform1i(locIndex, 1 + i);
-            return;
-        }
+        case RL_NULL_COMMAND_BUFFER_UPLOAD: if (bytes > 0) { trace->bufferUploads++; trace->bufferBytes += bytes; } break;
+        case RL_NULL_COMMAND_TEXTURE_UPLOAD: if (bytes > 0) { trace->textureUploads++; trace->textureBytes += bytes; } break;
+        case RL_NULL_COMMAND_DRAW: trace->drawCalls++; trace->vertexCount += count*instances; break;
+        case RL_NULL_COMMAND_CLEAR: trace->clears++; break;
+        default: trace->stateBinds++; break;
     }
 
-    // Register a new active texture for the internal batch system
-    // NOTE: Default texture is always activated as GL_TEXTURE0
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    if ((RLGL.NullBackend.commands != NULL) && (trace->commandCount < RL_NULL_TRACE_MAX_COMMANDS))
     {
-        if (RLGL.State.activeTextureId[i] == 0)
-        {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
-            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
-            break;
-        }
+        RLGL.NullBackend.commands[trace->commandCount] = (rlNullCommand){ type, target, id, count, instances, bytes };
     }
-#endif
+
+    trace->commandCount++;
 }
 
-// Set shader currently active (id and locations)
-void rlSetShader(unsigned int id, int *locs)
+// Get buffer binding target index, tracked targets are required for uploads and mapping
+static int rlNullBufferTargetIndex(GLenum target)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.State.currentShaderId != id)
+    int index = RL_NULL_BUFFER_TARGETS - 1;   // Other targets share last slot
+
+    switch (target)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
-        RLGL.State.currentShaderId = id;
-        RLGL.State.currentShaderLocs = locs;
+        case GL_ARRAY_BUFFER: index = 0; break;
+        case GL_ELEMENT_ARRAY_BUFFER: index = 1; break;
+        case GL_PIXEL_PACK_BUFFER: index = 2; break;
+        case GL_PIXEL_UNPACK_BUFFER: index = 3; break;
+        case GL_UNIFORM_BUFFER: index = 4; break;
+        case GL_SHADER_STORAGE_BUFFER: index = 5; break;
+        case GL_DRAW_INDIRECT_BUFFER: index = 6; break;
+        case GL_COPY_READ_BUFFER: index = 7; break;
+        case GL_COPY_WRITE_BUFFER: index = 8; break;
+        default: break;
     }
-#endif
+
+    return index;
 }
 
-// Load compute shader program
-unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+// Get buffer object bound to target, NULL if none
+static rlNullBuffer *rlNullBoundBuffer(GLenum target)
 {
-    unsigned int program = 0;
+    unsigned int id = RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(target)];
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    GLint success = 0;
-    program = glCreateProgram();
-    glAttachShader(program, shaderId);
-    glLinkProgram(program);
+    return ((id != 0) && (id < RLGL.NullBackend.bufferCapacity))? &RLGL.NullBackend.buffers[id] : NULL;
+}
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+// Get pixel data size in bytes for OpenGL format and type
+static unsigned int rlNullPixelDataSize(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    unsigned int components = 4;
+    unsigned int typeSize = 1;
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    switch (format)
+    {
+        case GL_RED: case GL_DEPTH_COMPONENT: components = 1; break;
+        case GL_RG: components = 2; break;
+        case GL_RGB: components = 3; break;
+        default: break;
+    }
 
-    if (success == GL_FALSE)
+    switch (type)
     {
-        RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: typeSize = 2; break;
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: typeSize = 4; break;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1: components = 1; typeSize = 2; break;
+        default: break;
+    }
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+    return (unsigned int)(width*height)*components*typeSize;
+}
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
-        }
+// Generate object ids, shared by all object types
+static void rlNullGenIds(GLsizei n, GLuint *ids)
+{
+    for (int i = 0; i < n; i++) ids[i] = ++RLGL.NullBackend.idCounter;
+}
 
-        glDeleteProgram(program);
+static const GLubyte *GLAD_API_PTR rlNullGetString(GLenum name)
+{
+    static char extensions[1024] = { 0 };
+    const char *result = NULL;
 
-        program = 0;
-    }
-    else
+    switch (name)
     {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
-
-        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+        case GL_VENDOR: result = "raylib"; break;
+        case GL_RENDERER: result = "rlgl null backend"; break;
+    #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+        case GL_VERSION: result = "4.3.0 rlgl null backend"; break;
+        case GL_SHADING_LANGUAGE_VERSION: result = "4.30"; break;
+    #elif defined(RAYLIB_GRAPHICS_API_OPENGL_21)
+        case GL_VERSION: result = "2.1.0 rlgl null backend"; break;
+        case GL_SHADING_LANGUAGE_VERSION: result = "1.20"; break;
+    #else
+        case GL_VERSION: result = "3.3.0 rlgl null backend"; break;
+        case GL_SHADING_LANGUAGE_VERSION: result = "3.30"; break;
+    #endif
+        case GL_EXTENSIONS:
+        {
+            // OpenGL 2.1 extensions are queried as a single string
+            if (extensions[0] == '\0')
+            {
+                for (unsigned int i = 0; i < RL_NULL_EXTENSIONS_COUNT; i++)
+                {
+                    if (i > 0) strcat(extensions, " ");
+                    strcat(extensions, rlNullExtensions[i]);
+                }
+            }
+            result = extensions;
+        } break;
+        default: break;
     }
-#endif
 
-    return program;
+    return (const GLubyte *)result;
 }
 
-// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
-void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+static const GLubyte *GLAD_API_PTR rlNullGetStringi(GLenum name, GLuint index)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glDispatchCompute(groupX, groupY, groupZ);
-#endif
+    return ((name == GL_EXTENSIONS) && (index < RL_NULL_EXTENSIONS_COUNT))? (const GLubyte *)rlNullExtensions[index] : NULL;
 }
 
-// Load shader storage buffer object (SSBO)
-unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
+static void GLAD_API_PTR rlNullGetIntegerv(GLenum pname, GLint *data)
 {
-    unsigned int ssbo = 0;
+    switch (pname)
+    {
+        case GL_NUM_EXTENSIONS: *data = RL_NULL_EXTENSIONS_COUNT; break;
+        case GL_MAX_TEXTURE_SIZE: case GL_MAX_CUBE_MAP_TEXTURE_SIZE: *data = 16384; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: case GL_MAX_VERTEX_ATTRIBS: case GL_MAX_VERTEX_ATTRIB_BINDINGS: *data = 16; break;
+        case GL_MAX_UNIFORM_BLOCK_SIZE: *data = 65536; break;
+        case GL_MAX_DRAW_BUFFERS: *data = 8; break;
+        case GL_MAX_UNIFORM_LOCATIONS: *data = 1024; break;
+        case GL_DRAW_FRAMEBUFFER_BINDING: *data = (GLint)RLGL.NullBackend.boundFramebuffer; break;
+        case GL_COMPRESSED_TEXTURE_FORMATS: break;     // No formats reported (GL_NUM_COMPRESSED_TEXTURE_FORMATS is 0)
+        default: *data = 0; break;
+    }
+}
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glGenBuffers(1, &ssbo);
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
-    if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);    // Clear buffer data to 0
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
-#endif
+static void GLAD_API_PTR rlNullGetInteger64v(GLenum pname, GLint64 *data)
+{
+    rlNullBuffer *buffer = (pname == GL_SHADER_STORAGE_BUFFER_SIZE)? rlNullBoundBuffer(GL_SHADER_STORAGE_BUFFER) : NULL;
 
-    return ssbo;
+    *data = (buffer != NULL)? (GLint64)buffer->size : 0;
 }
 
-// Unload shader storage buffer object (SSBO)
-void rlUnloadShaderBuffer(unsigned int ssboId)
+static void GLAD_API_PTR rlNullGetFloatv(GLenum pname, GLfloat *data)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glDeleteBuffers(1, &ssboId);
-#endif
+    switch (pname)
+    {
+        case GL_LINE_WIDTH: *data = 1.0f; break;
+        case GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT: *data = 16.0f; break;
+        default: *data = 0.0f; break;
+    }
 }
 
-// Update SSBO buffer data
-void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
+static void GLAD_API_PTR rlNullGetShaderiv(GLuint shader, GLenum pname, GLint *params) { *params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0; }
+static void GLAD_API_PTR rlNullGetProgramiv(GLuint program, GLenum pname, GLint *params) { *params = (pname == GL_LINK_STATUS)? GL_TRUE : 0; }
+static void GLAD_API_PTR rlNullGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { *params = (pname == GL_QUERY_RESULT_AVAILABLE)? GL_TRUE : 0; }
+static void GLAD_API_PTR rlNullGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { *params = 0; }
+static GLint GLAD_API_PTR rlNullGetLocation(GLuint program, const GLchar *name) { return 0; }
+static GLuint GLAD_API_PTR rlNullGetUniformBlockIndex(GLuint program, const GLchar *name) { return GL_INVALID_INDEX; }
+static GLenum GLAD_API_PTR rlNullCheckFramebufferStatus(GLenum target) { return GL_FRAMEBUFFER_COMPLETE; }
+static GLenum GLAD_API_PTR rlNullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { return GL_ALREADY_SIGNALED; }
+static GLsync GLAD_API_PTR rlNullFenceSync(GLenum condition, GLbitfield flags) { return (GLsync)(uintptr_t)(++RLGL.NullBackend.idCounter); }
+static GLuint GLAD_API_PTR rlNullCreateObject(void) { return ++RLGL.NullBackend.idCounter; }
+static GLuint GLAD_API_PTR rlNullCreateShader(GLenum type) { return ++RLGL.NullBackend.idCounter; }
+static void GLAD_API_PTR rlNullGenObjects(GLsizei n, GLuint *ids) { rlNullGenIds(n, ids); }
+
+static void GLAD_API_PTR rlNullGenBuffers(GLsizei n, GLuint *buffers)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
-#endif
+    rlNullGenIds(n, buffers);
+
+    // Buffer objects are indexed by id, grow array to fit latest id
+    unsigned int capacity = RLGL.NullBackend.idCounter + 1;
+    if (capacity > RLGL.NullBackend.bufferCapacity)
+    {
+        if (capacity < 2*RLGL.NullBackend.bufferCapacity) capacity = 2*RLGL.NullBackend.bufferCapacity;
+
+        rlNullBuffer *buffersGrown = (rlNullBuffer *)RL_REALLOC(RLGL.NullBackend.buffers, capacity*sizeof(rlNullBuffer));
+        if (buffersGrown == NULL) return;
+
+        memset(buffersGrown + RLGL.NullBackend.bufferCapacity, 0, (capacity - RLGL.NullBackend.bufferCapacity)*sizeof(rlNullBuffer));
+        RLGL.NullBackend.buffers = buffersGrown;
+        RLGL.NullBackend.bufferCapacity = capacity;
+    }
 }
 
-// Get SSBO buffer size
-unsigned int rlGetShaderBufferSize(unsigned int id)
+static void GLAD_API_PTR rlNullDeleteBuffers(GLsizei n, const GLuint *buffers)
 {
-    long long size = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if ((buffers[i] == 0) || (buffers[i] >= RLGL.NullBackend.bufferCapacity)) continue;
 
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
-#endif
+        RL_FREE(RLGL.NullBackend.buffers[buffers[i]].mapped);
+        memset(&RLGL.NullBackend.buffers[buffers[i]], 0, sizeof(rlNullBuffer));
 
-    return (size > 0)? (unsigned int)size : 0;
+        for (int t = 0; t < RL_NULL_BUFFER_TARGETS; t++) if (RLGL.NullBackend.boundBuffers[t] == buffers[i]) RLGL.NullBackend.boundBuffers[t] = 0;
+    }
 }
 
-// Read SSBO buffer data (GPU->CPU)
-void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, unsigned int offset)
+static void GLAD_API_PTR rlNullBindBuffer(GLenum target, GLuint buffer)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
-#endif
+    RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(target)] = buffer;
+    rlNullRecord(RL_NULL_COMMAND_BIND_BUFFER, target, buffer, 0, 0, 0);
 }
 
-// Bind SSBO buffer
-void rlBindShaderBuffer(unsigned int id, unsigned int index)
+static void GLAD_API_PTR rlNullBindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
-#endif
+    RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(target)] = buffer;   // Also binds generic target
+    rlNullRecord(RL_NULL_COMMAND_BIND_BUFFER, target, buffer, 0, 0, 0);
 }
 
-// Copy SSBO buffer data
-void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int destOffset, unsigned int srcOffset, unsigned int count)
+static void GLAD_API_PTR rlNullBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
-    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
-#endif
+    rlNullBuffer *buffer = rlNullBoundBuffer(target);
+    if (buffer != NULL) buffer->size = (unsigned int)size;
+
+    rlNullRecord(RL_NULL_COMMAND_BUFFER_UPLOAD, target, RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(target)], 0, 0, (data != NULL)? (unsigned int)size : 0);
 }
 
-// Bind image texture
-void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly)
+static void GLAD_API_PTR rlNullBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
-    unsigned int glInternalFormat = 0, glFormat = 0, glType = 0;
+    rlNullBufferData(target, size, data, 0);
+}
 
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    glBindImageTexture(index, id, 0, 0, 0, readonly? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
-#endif
+static void GLAD_API_PTR rlNullBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    rlNullRecord(RL_NULL_COMMAND_BUFFER_UPLOAD, target, RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(target)], 0, 0, (unsigned int)size);
 }
 
-// RaylibMatrix state management
-//-----------------------------------------------------------------------------------------
-// Get internal modelview matrix
-RaylibMatrix rlGetMatrixModelview(void)
+// NOTE: Mapped memory is system memory allocated on map and freed on unmap,
+// data written is only registered as uploaded bytes, on unmap or by rlgl for persistent mappings
+static void *GLAD_API_PTR rlNullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
-    RaylibMatrix matrix = rlMatrixIdentity();
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
-    matrix.m0 = mat[0];
-    matrix.m1 = mat[1];
-    matrix.m2 = mat[2];
-    matrix.m3 = mat[3];
-    matrix.m4 = mat[4];
-    matrix.m5 = mat[5];
-    matrix.m6 = mat[6];
-    matrix.m7 = mat[7];
-    matrix.m8 = mat[8];
-    matrix.m9 = mat[9];
-    matrix.m10 = mat[10];
-    matrix.m11 = mat[11];
-    matrix.m12 = mat[12];
-    matrix.m13 = mat[13];
-    matrix.m14 = mat[14];
-    matrix.m15 = mat[15];
-#else
-    matrix = RLGL.State.modelview;
-#endif
-    return matrix;
+    rlNullBuffer *buffer = rlNullBoundBuffer(target);
+    if ((buffer == NULL) || (buffer->mapped != NULL) || (length <= 0)) return NULL;
+
+    buffer->mapped = RL_CALLOC(length, 1);
+    buffer->mappedSize = (buffer->mapped != NULL)? (unsigned int)length : 0;
+    buffer->mappedWrite = (((access & GL_MAP_WRITE_BIT) != 0) && ((access & GL_MAP_PERSISTENT_BIT) == 0));
+
+    return buffer->mapped;
 }
 
-// Get internal projection matrix
-RaylibMatrix rlGetMatrixProjection(void)
+static void *GLAD_API_PTR rlNullMapBuffer(GLenum target, GLenum access)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_PROJECTION_MATRIX,mat);
-    RaylibMatrix m;
-    m.m0 = mat[0];
-    m.m1 = mat[1];
-    m.m2 = mat[2];
-    m.m3 = mat[3];
-    m.m4 = mat[4];
-    m.m5 = mat[5];
-    m.m6 = mat[6];
-    m.m7 = mat[7];
-    m.m8 = mat[8];
-    m.m9 = mat[9];
-    m.m10 = mat[10];
-    m.m11 = mat[11];
-    m.m12 = mat[12];
-    m.m13 = mat[13];
-    m.m14 = mat[14];
-    m.m15 = mat[15];
-    return m;
-#else
-    return RLGL.State.projection;
-#endif
+    rlNullBuffer *buffer = rlNullBoundBuffer(target);
+    if (buffer == NULL) return NULL;
+
+    return rlNullMapBufferRange(target, 0, buffer->size, (access != GL_READ_ONLY)? GL_MAP_WRITE_BIT : GL_MAP_READ_BIT);
 }
 
-// Get internal accumulated transform matrix
-RaylibMatrix rlGetMatrixTransform(void)
+static GLboolean GLAD_API_PTR rlNullUnmapBuffer(GLenum target)
 {
-    RaylibMatrix mat = rlMatrixIdentity();
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // TODO: Consider possible transform matrices in the RLGL.State.stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //RaylibMatrix matStackTransform = rlMatrixIdentity();
-    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
-    mat = RLGL.State.transform;
-#endif
-    return mat;
+    rlNullBuffer *buffer = rlNullBoundBuffer(target);
+    if ((buffer == NULL) || (buffer->mapped == NULL)) return GL_FALSE;
+
+    if (buffer->mappedWrite) rlNullRecord(RL_NULL_COMMAND_BUFFER_UPLOAD, target, RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(target)], 0, 0, buffer->mappedSize);
+
+    RL_FREE(buffer->mapped);
+    buffer->mapped = NULL;
+    buffer->mappedSize = 0;
+
+    return GL_TRUE;
 }
 
-// Get internal projection matrix for stereo render (selected eye)
-RAYLIB_RLAPI RaylibMatrix rlGetMatrixProjectionStereo(int eye)
+// NOTE: Texture data sourced from a pixel unpack buffer is not registered as uploaded bytes,
+// it was already registered on buffer upload
+static void GLAD_API_PTR rlNullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
 {
-    RaylibMatrix mat = rlMatrixIdentity();
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.projectionStereo[eye];
-#endif
-    return mat;
+    bool upload = ((pixels != NULL) && (RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(GL_PIXEL_UNPACK_BUFFER)] == 0));
+    rlNullRecord(RL_NULL_COMMAND_TEXTURE_UPLOAD, target, 0, 0, 0, upload? rlNullPixelDataSize(width, height, format, type) : 0);
 }
 
-// Get internal view offset matrix for stereo render (selected eye)
-RAYLIB_RLAPI RaylibMatrix rlGetMatrixViewOffsetStereo(int eye)
+static void GLAD_API_PTR rlNullTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
 {
-    RaylibMatrix mat = rlMatrixIdentity();
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.viewOffsetStereo[eye];
-#endif
-    return mat;
+    bool upload = ((pixels != NULL) && (RLGL.NullBackend.boundBuffers[rlNullBufferTargetIndex(GL_PIXEL_UNPACK_BUFFER)] == 0));
+    rlNullRecord(RL_NULL_COMMAND_TEXTURE_UPLOAD, target, 0, 0, 0, upload? rlNullPixelDataSize(width, height, format, type) : 0);
 }
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void rlSetMatrixModelview(RaylibMatrix view)
+static void GLAD_API_PTR rlNullCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.modelview = view;
-#endif
+    rlNullRecord(RL_NULL_COMMAND_TEXTURE_UPLOAD, target, 0, 0, 0, (data != NULL)? (unsigned int)imageSize : 0);
 }
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void rlSetMatrixProjection(RaylibMatrix projection)
+static void GLAD_API_PTR rlNullDrawArrays(GLenum mode, GLint first, GLsizei count) { rlNullRecord(RL_NULL_COMMAND_DRAW, mode, 0, count, 1, 0); }
+static void GLAD_API_PTR rlNullDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { rlNullRecord(RL_NULL_COMMAND_DRAW, mode, 0, count, 1, 0); }
+static void GLAD_API_PTR rlNullDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { rlNullRecord(RL_NULL_COMMAND_DRAW, mode, 0, count, instancecount, 0); }
+static void GLAD_API_PTR rlNullDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { rlNullRecord(RL_NULL_COMMAND_DRAW, mode, 0, count, instancecount, 0); }
+static void GLAD_API_PTR rlNullMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) { rlNullRecord(RL_NULL_COMMAND_DRAW, mode, 0, 0, drawcount, 0); }
+static void GLAD_API_PTR rlNullClear(GLbitfield mask) { rlNullRecord(RL_NULL_COMMAND_CLEAR, mask, 0, 0, 0, 0); }
+static void GLAD_API_PTR rlNullUseProgram(GLuint program) { rlNullRecord(RL_NULL_COMMAND_BIND_SHADER, 0, program, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBindTexture(GLenum target, GLuint texture) { rlNullRecord(RL_NULL_COMMAND_BIND_TEXTURE, target, texture, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBindVertexArray(GLuint array) { rlNullRecord(RL_NULL_COMMAND_BIND_VERTEX_ARRAY, 0, array, 0, 0, 0); }
+
+static void GLAD_API_PTR rlNullBindFramebuffer(GLenum target, GLuint framebuffer)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projection = projection;
-#endif
+    if (target != GL_READ_FRAMEBUFFER) RLGL.NullBackend.boundFramebuffer = framebuffer;
+    rlNullRecord(RL_NULL_COMMAND_BIND_FRAMEBUFFER, target, framebuffer, 0, 0, 0);
 }
 
-// Set eyes projection matrices for stereo rendering
-void rlSetMatrixProjectionStereo(RaylibMatrix right, RaylibMatrix left)
+// Functions with no effect on trace, no-op stubs matching OpenGL prototypes
+// NOTE: Output parameters are cleared, caller never reads uninitialized data
+static void GLAD_API_PTR rlNullActiveTexture(GLenum texture) { }
+static void GLAD_API_PTR rlNullAttachShader(GLuint program, GLuint shader) { }
+static void GLAD_API_PTR rlNullBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { }
+static void GLAD_API_PTR rlNullBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) { }
+static void GLAD_API_PTR rlNullBindRenderbuffer(GLenum target, GLuint renderbuffer) { }
+static void GLAD_API_PTR rlNullBlendEquation(GLenum mode) { }
+static void GLAD_API_PTR rlNullBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { }
+static void GLAD_API_PTR rlNullBlendFunc(GLenum sfactor, GLenum dfactor) { }
+static void GLAD_API_PTR rlNullBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { }
+static void GLAD_API_PTR rlNullBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { }
+static void GLAD_API_PTR rlNullClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) { }
+static void GLAD_API_PTR rlNullClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { }
+static void GLAD_API_PTR rlNullClearDepth(GLdouble depth) { }
+static void GLAD_API_PTR rlNullColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { }
+static void GLAD_API_PTR rlNullCompileShader(GLuint shader) { }
+static void GLAD_API_PTR rlNullCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { }
+static void GLAD_API_PTR rlNullCullFace(GLenum mode) { }
+static void GLAD_API_PTR rlNullDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) { }
+static void GLAD_API_PTR rlNullDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) { }
+static void GLAD_API_PTR rlNullDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { }
+static void GLAD_API_PTR rlNullDeleteProgram(GLuint program) { }
+static void GLAD_API_PTR rlNullDeleteQueries(GLsizei n, const GLuint *ids) { }
+static void GLAD_API_PTR rlNullDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { }
+static void GLAD_API_PTR rlNullDeleteShader(GLuint shader) { }
+static void GLAD_API_PTR rlNullDeleteSync(GLsync sync) { }
+static void GLAD_API_PTR rlNullDeleteTextures(GLsizei n, const GLuint *textures) { }
+static void GLAD_API_PTR rlNullDeleteVertexArrays(GLsizei n, const GLuint *arrays) { }
+static void GLAD_API_PTR rlNullDepthFunc(GLenum func) { }
+static void GLAD_API_PTR rlNullDepthMask(GLboolean flag) { }
+static void GLAD_API_PTR rlNullDetachShader(GLuint program, GLuint shader) { }
+static void GLAD_API_PTR rlNullDisable(GLenum cap) { }
+static void GLAD_API_PTR rlNullDisableVertexAttribArray(GLuint index) { }
+static void GLAD_API_PTR rlNullDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) { }
+static void GLAD_API_PTR rlNullDrawBuffers(GLsizei n, const GLenum *bufs) { }
+static void GLAD_API_PTR rlNullEnable(GLenum cap) { }
+static void GLAD_API_PTR rlNullEnableVertexAttribArray(GLuint index) { }
+static void GLAD_API_PTR rlNullFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { }
+static void GLAD_API_PTR rlNullFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { }
+static void GLAD_API_PTR rlNullFrontFace(GLenum mode) { }
+static void GLAD_API_PTR rlNullGenerateMipmap(GLenum target) { }
+
+static void GLAD_API_PTR rlNullGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    if (length != NULL) *length = 0;
+    *size = 0;
+    *type = 0;
+    if (bufSize > 0) name[0] = '\0';
+}
+
+static void GLAD_API_PTR rlNullGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { }
+static GLenum GLAD_API_PTR rlNullGetError(void) { return GL_NO_ERROR; }
+static void GLAD_API_PTR rlNullGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { *params = 0; }
+static void GLAD_API_PTR rlNullGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { if (length != NULL) *length = 0; }
+
+static void GLAD_API_PTR rlNullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) infoLog[0] = '\0';
+}
+
+static void GLAD_API_PTR rlNullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) infoLog[0] = '\0';
+}
+
+static void GLAD_API_PTR rlNullGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) source[0] = '\0';
+}
+
+static void GLAD_API_PTR rlNullGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { }
+static void GLAD_API_PTR rlNullGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { *params = 0; }
+static void GLAD_API_PTR rlNullHint(GLenum target, GLenum mode) { }
+static void GLAD_API_PTR rlNullLineWidth(GLfloat width) { }
+static void GLAD_API_PTR rlNullLinkProgram(GLuint program) { }
+static void GLAD_API_PTR rlNullMemoryBarrier(GLbitfield barriers) { }
+static void GLAD_API_PTR rlNullPixelStorei(GLenum pname, GLint param) { }
+static void GLAD_API_PTR rlNullPolygonMode(GLenum face, GLenum mode) { }
+static void GLAD_API_PTR rlNullProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { }
+static void GLAD_API_PTR rlNullProgramParameteri(GLuint program, GLenum pname, GLint value) { }
+static void GLAD_API_PTR rlNullQueryCounter(GLuint id, GLenum target) { }
+static void GLAD_API_PTR rlNullReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { }
+static void GLAD_API_PTR rlNullRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { }
+static void GLAD_API_PTR rlNullScissor(GLint x, GLint y, GLsizei width, GLsizei height) { }
+static void GLAD_API_PTR rlNullShaderSource(GLuint shader, GLsizei count, const GLchar *const * string, const GLint *length) { }
+static void GLAD_API_PTR rlNullTexParameterf(GLenum target, GLenum pname, GLfloat param) { }
+static void GLAD_API_PTR rlNullTexParameteri(GLenum target, GLenum pname, GLint param) { }
+static void GLAD_API_PTR rlNullTexParameteriv(GLenum target, GLenum pname, const GLint *params) { }
+static void GLAD_API_PTR rlNullUniform1fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void GLAD_API_PTR rlNullUniform1i(GLint location, GLint v0) { }
+static void GLAD_API_PTR rlNullUniform1iv(GLint location, GLsizei count, const GLint *value) { }
+static void GLAD_API_PTR rlNullUniform2fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void GLAD_API_PTR rlNullUniform2iv(GLint location, GLsizei count, const GLint *value) { }
+static void GLAD_API_PTR rlNullUniform3fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void GLAD_API_PTR rlNullUniform3iv(GLint location, GLsizei count, const GLint *value) { }
+static void GLAD_API_PTR rlNullUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { }
+static void GLAD_API_PTR rlNullUniform4fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void GLAD_API_PTR rlNullUniform4iv(GLint location, GLsizei count, const GLint *value) { }
+static void GLAD_API_PTR rlNullUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { }
+static void GLAD_API_PTR rlNullUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { }
+static void GLAD_API_PTR rlNullVertexAttrib1fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttrib2fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttrib3fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttrib4fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttribDivisor(GLuint index, GLuint divisor) { }
+static void GLAD_API_PTR rlNullVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { }
+static void GLAD_API_PTR rlNullViewport(GLint x, GLint y, GLsizei width, GLsizei height) { }
+
+// Get null backend OpenGL function (recording or no-op stub), used as glad loader
+// NOTE: Functions not used by rlgl are not provided (NULL), glad registers them as not loaded
+static void *rlNullGetProcAddress(const char *name)
+{
+    static const struct { const char *name; void *proc; } procs[] = {
+        { "glGetString", (void *)rlNullGetString },
+        { "glGetStringi", (void *)rlNullGetStringi },
+        { "glGetIntegerv", (void *)rlNullGetIntegerv },
+        { "glGetInteger64v", (void *)rlNullGetInteger64v },
+        { "glGetFloatv", (void *)rlNullGetFloatv },
+        { "glGetShaderiv", (void *)rlNullGetShaderiv },
+        { "glGetProgramiv", (void *)rlNullGetProgramiv },
+        { "glGetQueryObjectiv", (void *)rlNullGetQueryObjectiv },
+        { "glGetQueryObjectui64v", (void *)rlNullGetQueryObjectui64v },
+        { "glGetAttribLocation", (void *)rlNullGetLocation },
+        { "glGetUniformLocation", (void *)rlNullGetLocation },
+        { "glGetUniformBlockIndex", (void *)rlNullGetUniformBlockIndex },
+        { "glCheckFramebufferStatus", (void *)rlNullCheckFramebufferStatus },
+        { "glFenceSync", (void *)rlNullFenceSync },
+        { "glClientWaitSync", (void *)rlNullClientWaitSync },
+        { "glCreateProgram", (void *)rlNullCreateObject },
+        { "glCreateShader", (void *)rlNullCreateShader },
+        { "glGenTextures", (void *)rlNullGenObjects },
+        { "glGenVertexArrays", (void *)rlNullGenObjects },
+        { "glGenFramebuffers", (void *)rlNullGenObjects },
+        { "glGenRenderbuffers", (void *)rlNullGenObjects },
+        { "glGenQueries", (void *)rlNullGenObjects },
+        { "glGenBuffers", (void *)rlNullGenBuffers },
+        { "glDeleteBuffers", (void *)rlNullDeleteBuffers },
+        { "glBindBuffer", (void *)rlNullBindBuffer },
+        { "glBindBufferBase", (void *)rlNullBindBufferBase },
+        { "glBufferData", (void *)rlNullBufferData },
+        { "glBufferStorage", (void *)rlNullBufferStorage },
+        { "glBufferSubData", (void *)rlNullBufferSubData },
+        { "glMapBuffer", (void *)rlNullMapBuffer },
+        { "glMapBufferRange", (void *)rlNullMapBufferRange },
+        { "glUnmapBuffer", (void *)rlNullUnmapBuffer },
+        { "glTexImage2D", (void *)rlNullTexImage2D },
+        { "glTexSubImage2D", (void *)rlNullTexSubImage2D },
+        { "glCompressedTexImage2D", (void *)rlNullCompressedTexImage2D },
+        { "glDrawArrays", (void *)rlNullDrawArrays },
+        { "glDrawElements", (void *)rlNullDrawElements },
+        { "glDrawArraysInstanced", (void *)rlNullDrawArraysInstanced },
+        { "glDrawElementsInstanced", (void *)rlNullDrawElementsInstanced },
+        { "glMultiDrawElementsIndirect", (void *)rlNullMultiDrawElementsIndirect },
+        { "glClear", (void *)rlNullClear },
+        { "glUseProgram", (void *)rlNullUseProgram },
+        { "glBindTexture", (void *)rlNullBindTexture },
+        { "glBindVertexArray", (void *)rlNullBindVertexArray },
+        { "glBindFramebuffer", (void *)rlNullBindFramebuffer },
+        { "glActiveTexture", (void *)rlNullActiveTexture },
+        { "glAttachShader", (void *)rlNullAttachShader },
+        { "glBindAttribLocation", (void *)rlNullBindAttribLocation },
+        { "glBindImageTexture", (void *)rlNullBindImageTexture },
+        { "glBindRenderbuffer", (void *)rlNullBindRenderbuffer },
+        { "glBlendEquation", (void *)rlNullBlendEquation },
+        { "glBlendEquationSeparate", (void *)rlNullBlendEquationSeparate },
+        { "glBlendFunc", (void *)rlNullBlendFunc },
+        { "glBlendFuncSeparate", (void *)rlNullBlendFuncSeparate },
+        { "glBlitFramebuffer", (void *)rlNullBlitFramebuffer },
+        { "glClearBufferData", (void *)rlNullClearBufferData },
+        { "glClearColor", (void *)rlNullClearColor },
+        { "glClearDepth", (void *)rlNullClearDepth },
+        { "glColorMask", (void *)rlNullColorMask },
+        { "glCompileShader", (void *)rlNullCompileShader },
+        { "glCopyBufferSubData", (void *)rlNullCopyBufferSubData },
+        { "glCullFace", (void *)rlNullCullFace },
+        { "glDebugMessageCallback", (void *)rlNullDebugMessageCallback },
+        { "glDebugMessageControl", (void *)rlNullDebugMessageControl },
+        { "glDeleteFramebuffers", (void *)rlNullDeleteFramebuffers },
+        { "glDeleteProgram", (void *)rlNullDeleteProgram },
+        { "glDeleteQueries", (void *)rlNullDeleteQueries },
+        { "glDeleteRenderbuffers", (void *)rlNullDeleteRenderbuffers },
+        { "glDeleteShader", (void *)rlNullDeleteShader },
+        { "glDeleteSync", (void *)rlNullDeleteSync },
+        { "glDeleteTextures", (void *)rlNullDeleteTextures },
+        { "glDeleteVertexArrays", (void *)rlNullDeleteVertexArrays },
+        { "glDepthFunc", (void *)rlNullDepthFunc },
+        { "glDepthMask", (void *)rlNullDepthMask },
+        { "glDetachShader", (void *)rlNullDetachShader },
+        { "glDisable", (void *)rlNullDisable },
+        { "glDisableVertexAttribArray", (void *)rlNullDisableVertexAttribArray },
+        { "glDispatchCompute", (void *)rlNullDispatchCompute },
+        { "glDrawBuffers", (void *)rlNullDrawBuffers },
+        { "glEnable", (void *)rlNullEnable },
+        { "glEnableVertexAttribArray", (void *)rlNullEnableVertexAttribArray },
+        { "glFramebufferRenderbuffer", (void *)rlNullFramebufferRenderbuffer },
+        { "glFramebufferTexture2D", (void *)rlNullFramebufferTexture2D },
+        { "glFrontFace", (void *)rlNullFrontFace },
+        { "glGenerateMipmap", (void *)rlNullGenerateMipmap },
+        { "glGetActiveUniform", (void *)rlNullGetActiveUniform },
+        { "glGetBufferSubData", (void *)rlNullGetBufferSubData },
+        { "glGetError", (void *)rlNullGetError },
+        { "glGetFramebufferAttachmentParameteriv", (void *)rlNullGetFramebufferAttachmentParameteriv },
+        { "glGetProgramBinary", (void *)rlNullGetProgramBinary },
+        { "glGetProgramInfoLog", (void *)rlNullGetProgramInfoLog },
+        { "glGetShaderInfoLog", (void *)rlNullGetShaderInfoLog },
+        { "glGetShaderSource", (void *)rlNullGetShaderSource },
+        { "glGetTexImage", (void *)rlNullGetTexImage },
+        { "glGetTexLevelParameteriv", (void *)rlNullGetTexLevelParameteriv },
+        { "glHint", (void *)rlNullHint },
+        { "glLineWidth", (void *)rlNullLineWidth },
+        { "glLinkProgram", (void *)rlNullLinkProgram },
+        { "glMemoryBarrier", (void *)rlNullMemoryBarrier },
+        { "glPixelStorei", (void *)rlNullPixelStorei },
+        { "glPolygonMode", (void *)rlNullPolygonMode },
+        { "glProgramBinary", (void *)rlNullProgramBinary },
+        { "glProgramParameteri", (void *)rlNullProgramParameteri },
+        { "glQueryCounter", (void *)rlNullQueryCounter },
+        { "glReadPixels", (void *)rlNullReadPixels },
+        { "glRenderbufferStorage", (void *)rlNullRenderbufferStorage },
+        { "glScissor", (void *)rlNullScissor },
+        { "glShaderSource", (void *)rlNullShaderSource },
+        { "glTexParameterf", (void *)rlNullTexParameterf },
+        { "glTexParameteri", (void *)rlNullTexParameteri },
+        { "glTexParameteriv", (void *)rlNullTexParameteriv },
+        { "glUniform1fv", (void *)rlNullUniform1fv },
+        { "glUniform1i", (void *)rlNullUniform1i },
+        { "glUniform1iv", (void *)rlNullUniform1iv },
+        { "glUniform2fv", (void *)rlNullUniform2fv },
+        { "glUniform2iv", (void *)rlNullUniform2iv },
+        { "glUniform3fv", (void *)rlNullUniform3fv },
+        { "glUniform3iv", (void *)rlNullUniform3iv },
+        { "glUniform4f", (void *)rlNullUniform4f },
+        { "glUniform4fv", (void *)rlNullUniform4fv },
+        { "glUniform4iv", (void *)rlNullUniform4iv },
+        { "glUniformBlockBinding", (void *)rlNullUniformBlockBinding },
+        { "glUniformMatrix4fv", (void *)rlNullUniformMatrix4fv },
+        { "glVertexAttrib1fv", (void *)rlNullVertexAttrib1fv },
+        { "glVertexAttrib2fv", (void *)rlNullVertexAttrib2fv },
+        { "glVertexAttrib3fv", (void *)rlNullVertexAttrib3fv },
+        { "glVertexAttrib4fv", (void *)rlNullVertexAttrib4fv },
+        { "glVertexAttribDivisor", (void *)rlNullVertexAttribDivisor },
+        { "glVertexAttribPointer", (void *)rlNullVertexAttribPointer },
+        { "glViewport", (void *)rlNullViewport }
+    };
+
+    for (unsigned int i = 0; i < sizeof(procs)/sizeof(procs[0]); i++)
+    {
+        if (strcmp(procs[i].name, name) == 0) return procs[i].proc;
+    }
+
+    return NULL;
+}
+#endif  // RLGL_NULL_BACKEND
+
+// Clear shader cached uniform locations
+static void rlClearUniformLocations(unsigned int shaderId)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projectionStereo[0] = right;
-    RLGL.State.projectionStereo[1] = left;
-#endif
+    for (int i = 0; i < RL_UNIFORM_LOCATION_CACHE_SIZE; i++)
+    {
+        if (RLGL.UniformLocations.entries[i].shaderId == shaderId) RLGL.UniformLocations.entries[i].shaderId = 0;
+    }
 }
 
-// Set eyes view offsets matrices for stereo rendering
-void rlSetMatrixViewOffsetStereo(RaylibMatrix right, RaylibMatrix left)
+// Register (on load) or remove (on unload) shader declaring vertex texture slot attribute
+// NOTE: Attribute location is queried once per program, program id could be reused from a deleted program
+static void rlCheckTexSlotShader(unsigned int shaderId, bool loaded)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.viewOffsetStereo[0] = right;
-    RLGL.State.viewOffsetStereo[1] = left;
-#endif
+    for (int i = 0; i < RLGL.TexSlotShaders.count; i++)
+    {
+        if (RLGL.TexSlotShaders.shaderIds[i] == shaderId)
+        {
+            RLGL.TexSlotShaders.shaderIds[i] = RLGL.TexSlotShaders.shaderIds[RLGL.TexSlotShaders.count - 1];
+            RLGL.TexSlotShaders.count--;
+            break;
+        }
+    }
+
+    if (loaded && (glGetAttribLocation(shaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT) == RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT))
+    {
+        if (RLGL.TexSlotShaders.count >= RLGL.TexSlotShaders.capacity)
+        {
+            RLGL.TexSlotShaders.capacity = (RLGL.TexSlotShaders.capacity > 0)? RLGL.TexSlotShaders.capacity*2 : 8;
+            RLGL.TexSlotShaders.shaderIds = (unsigned int *)RL_REALLOC(RLGL.TexSlotShaders.shaderIds, RLGL.TexSlotShaders.capacity*sizeof(unsigned int));
+        }
+
+        RLGL.TexSlotShaders.shaderIds[RLGL.TexSlotShaders.count] = shaderId;
+        RLGL.TexSlotShaders.count++;
+    }
 }
 
-// Load and draw a quad in NDC
-void rlLoadDrawQuad(void)
+// Upload display list vertex data to GPU, VAO/VBOs are created on first upload
+// NOTE: Indices (QUADS drawing) are only uploaded when indexQuadCount > 0, they must cover all vertex data
+static bool rlUploadDisplayList(rlDisplayList *list, const rlBatchVertex *vertices, int vertexCount, int indexQuadCount, int usage)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    unsigned int quadVAO = 0;
-    unsigned int quadVBO = 0;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (vertexCount > 65536)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Display list vertex count (%i) exceeds 16bit indices limit", vertexCount);
+        return false;
+    }
+#endif
 
-    float vertices[] = {
-         // Positions         Texcoords
-        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
-    };
+    bool created = (list->vboId[0] == 0);
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    if (created)
+    {
+        if (RLGL.ExtSupported.vao) glGenVertexArrays(1, &list->vaoId);
+        glGenBuffers(2, list->vboId);
+    }
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &quadVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(list->vaoId);
 
-    // Bind vertex attributes (position, texcoords)
-    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
-    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
-    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+    glBindBuffer(GL_ARRAY_BUFFER, list->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, vertexCount*sizeof(rlBatchVertex), vertices, usage);
+    if (created && RLGL.ExtSupported.vao) rlSetDisplayListAttribs();
 
-    // Draw quad
-    glBindVertexArray(quadVAO);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list->vboId[1]);
 
-    // Delete buffers (VBO and VAO)
-    glDeleteBuffers(1, &quadVBO);
-    glDeleteVertexArrays(1, &quadVAO);
+    if (indexQuadCount > 0)
+    {
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+        unsigned short *indices = (unsigned short *)RL_MALLOC(indexQuadCount*6*sizeof(unsigned short));
+#else
+        unsigned int *indices = (unsigned int *)RL_MALLOC(indexQuadCount*6*sizeof(unsigned int));
 #endif
+        for (int i = 0, k = 0; i < indexQuadCount*6; i += 6, k++)
+        {
+            indices[i] = 4*k;
+            indices[i + 1] = 4*k + 1;
+            indices[i + 2] = 4*k + 2;
+            indices[i + 3] = 4*k;
+            indices[i + 4] = 4*k + 2;
+            indices[i + 5] = 4*k + 3;
+        }
+
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexQuadCount*6*sizeof(indices[0]), indices, GL_STATIC_DRAW);
+        RL_FREE(indices);
+    }
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    RLGL.Stats.uploadedBytes += vertexCount*sizeof(rlBatchVertex);
+    list->vertexCount = vertexCount;
+
+    return true;
 }
 
-// Load and draw a cube in NDC
-void rlLoadDrawCube(void)
+// Split multi-texture draw calls into single texture draw calls by vertex texture slot
+// NOTE: Required to draw captured data with custom shaders (only texture0 is sampled), consecutive quads
+// sharing texture slot are kept in the same draw, split array is grown as required
+// Returns split draw calls counter, 0 if no multi-texture draw call is found (no split required)
+static int rlSplitDrawsByTexSlot(const rlDrawCall *draws, int drawCount, const rlBatchVertex *vertices, rlDrawCall **split, int *splitCapacity)
 {
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    unsigned int cubeVAO = 0;
-    unsigned int cubeVBO = 0;
+    int splitCount = 0;
+    bool required = false;
 
-    float vertices[] = {
-         // Positions          Normals               Texcoords
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
-    };
+    // Count split draws, multi-texture draws are always QUADS (same slot for the 4 vertex of a quad)
+    for (int i = 0, vertexOffset = 0; i < drawCount; i++)
+    {
+        if (draws[i].textureCount > 1)
+        {
+            required = true;
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+            for (int v = 0; v < draws[i].vertexCount; v += 4)
+            {
+                if ((v == 0) || (vertices[vertexOffset + v].texslot != vertices[vertexOffset + v - 4].texslot)) splitCount++;
+            }
+        }
+        else splitCount++;
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &cubeVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
 
-    // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
-    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
-    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
-    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
-    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
-    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    if (!required) return 0;
 
-    // Draw cube
-    glBindVertexArray(cubeVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    if (*splitCapacity < splitCount)
+    {
+        *split = (rlDrawCall *)RL_REALLOC(*split, splitCount*sizeof(rlDrawCall));
+        *splitCapacity = splitCount;
+    }
 
-    // Delete VBO and VAO
-    glDeleteBuffers(1, &cubeVBO);
-    glDeleteVertexArrays(1, &cubeVAO);
-#endif
+    rlDrawCall *dst = *split;
+    int counter = 0;
+
+    for (int i = 0, vertexOffset = 0; i < drawCount; i++)
+    {
+        if (draws[i].textureCount > 1)
+        {
+            for (int v = 0; v < draws[i].vertexCount; v += 4)
+            {
+                unsigned char slot = vertices[vertexOffset + v].texslot;
+
+                if ((v == 0) || (slot != vertices[vertexOffset + v - 4].texslot))
+                {
+                    dst[counter] = draws[i];
+                    dst[counter].vertexCount = 0;
+                    dst[counter].vertexAlignment = 0;
+                    rlSetDrawCallTexture(&dst[counter], draws[i].textureIds[slot]);
+                    counter++;
+                }
+
+                dst[counter - 1].vertexCount += ((draws[i].vertexCount - v) < 4)? (draws[i].vertexCount - v) : 4;
+            }
+
+            dst[counter - 1].vertexAlignment = draws[i].vertexAlignment;
+        }
+        else dst[counter++] = draws[i];
+
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
+
+    return counter;
 }
 
-// Get name string for pixel format
-const char *rlGetPixelFormatName(unsigned int format)
+// Sort batch draw calls by (layer, shader, blend, texture) and merge them by state (deferred draw mode)
+// NOTE: Within a layer, a draw is only moved before a previous draw if their screen bounds do not overlap
+// (painter's order), overlapping draws keep recording order, vertex data is reordered accordingly so
+// consecutive draws sharing state are merged in a single draw
+// NOTE: Persistently mapped vertex data (write-only) and stereo rendering (per eye view) are only sorted by layer
+static void rlSortRenderBatch(rlRenderBatch *batch)
 {
-    switch (format)
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int drawCounter = batch->drawCounter;
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int srcOffset[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int dstOffset[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    float bounds[RL_DEFAULT_BATCH_DRAWCALLS][4] = { 0 };    // Draws screen bounds (normalized device coordinates): min x, min y, max x, max y
+    bool bounded[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };       // Draws screen bounds available, draws without bounds overlap any other draw
+    bool stateSort = (!buffer->dataMapped && !RLGL.State.stereoRender);
+
+    // Last draw could be registered but empty
+    if (batch->draws[drawCounter - 1].vertexCount == 0) drawCounter--;
+
+    if (drawCounter > 1)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: return "R16"; break;                     // 16 bpp (1 channel - half float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: return "R16G16B16"; break;         // 16*3 bpp (3 channels - half float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: return "R16G16B16A16"; break;   // 16*4 bpp (4 channels - half float)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
-        default: return "UNKNOWN"; break;
+        // Get draws vertex offsets in recording order and sort them (stable insertion sort)
+        for (int i = 0, offset = 0; i < drawCounter; i++)
+        {
+            srcOffset[i] = offset;
+            offset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+
+            const rlDrawCall *draw = &batch->draws[i];
+            int j = i;
+
+            if (stateSort) bounded[i] = rlGetDrawScreenBounds(buffer, draw, srcOffset[i], bounds[i]);
+
+            for (; j > 0; j--)
+            {
+                int prevIndex = order[j - 1];
+                const rlDrawCall *prev = &batch->draws[prevIndex];
+
+                if (prev->layer < draw->layer) break;
+
+                if (prev->layer == draw->layer)
+                {
+                    if (!stateSort || (rlCompareDrawState(prev, draw) <= 0)) break;
+
+                    // Painter's order: draws overlapping on screen are never reordered
+                    if (!bounded[i] || !bounded[prevIndex] ||
+                        ((bounds[i][0] < bounds[prevIndex][2]) && (bounds[prevIndex][0] < bounds[i][2]) &&
+                         (bounds[i][1] < bounds[prevIndex][3]) && (bounds[prevIndex][1] < bounds[i][3]))) break;
+                }
+
+                order[j] = order[j - 1];
+            }
+
+            order[j] = i;
+        }
+
+        // Get draws vertex offsets in sorted order, QUADS draws must start aligned to 4 vertex (index buffer)
+        int vertexCount = 0;
+        for (int i = 0; i < drawCounter; i++)
+        {
+            if ((batch->draws[order[i]].mode == RL_QUADS) && ((vertexCount%4) != 0)) vertexCount += (4 - vertexCount%4);
+            dstOffset[i] = vertexCount;
+            vertexCount += batch->draws[order[i]].vertexCount;
+        }
+
+        // Vertex data is reordered to allow merging draws, unless alignment requires more vertex than available
+        // or buffer is persistently mapped (write-only memory, can not be read back), in that case vertex data
+        // is kept in place and sorted draws just jump to their vertex offset
+        bool reorderData = ((vertexCount < buffer->elementCount*4) && !buffer->dataMapped);
+        int vertexDataSize = 0;
+
+        if (reorderData) vertexDataSize = ((RLCTX->vertexCounter*sizeof(rlBatchVertex) + 15)/16)*16;  // Aligned for draws data
+        else
+        {
+            for (int i = 0; i < drawCounter; i++) dstOffset[i] = srcOffset[order[i]];
+            vertexCount = RLCTX->vertexCounter;
+        }
+
+        int requiredSize = vertexDataSize + drawCounter*sizeof(rlDrawCall);
+
+        if (RLGL.State.sortBufferSize < requiredSize)
+        {
+            RL_FREE(RLGL.State.sortBuffer);
+            RLGL.State.sortBuffer = (unsigned char *)RL_MALLOC(requiredSize);
+            RLGL.State.sortBufferSize = requiredSize;
+        }
+
+        if (reorderData)
+        {
+            // Reorder vertex data, one array at a time (interleaved or separate layout)
+            unsigned char *arrays[5] = { 0 };
+            int strides[5] = { 0 };
+            int arrayCount = 0;
+
+            if (buffer->layout != RL_BATCH_LAYOUT_SEPARATE)
+            {
+                arrays[0] = (unsigned char *)buffer->data; strides[0] = sizeof(rlBatchVertex);
+                arrayCount = 1;
+            }
+            else
+            {
+                arrays[0] = (unsigned char *)buffer->vertices; strides[0] = 3*sizeof(float);
+                arrays[1] = (unsigned char *)buffer->texcoords; strides[1] = 2*sizeof(float);
+                arrays[2] = (unsigned char *)buffer->normals; strides[2] = 3*sizeof(float);
+                arrays[3] = buffer->colors; strides[3] = 4*sizeof(unsigned char);
+                arrays[4] = buffer->texslots; strides[4] = sizeof(unsigned char);
+                arrayCount = 5;
+            }
+
+            for (int k = 0; k < arrayCount; k++)
+            {
+                memcpy(RLGL.State.sortBuffer, arrays[k], RLCTX->vertexCounter*strides[k]);
+
+                for (int i = 0; i < drawCounter; i++)
+                {
+                    memcpy(arrays[k] + dstOffset[i]*strides[k], RLGL.State.sortBuffer + srcOffset[order[i]]*strides[k], batch->draws[order[i]].vertexCount*strides[k]);
+                }
+            }
+        }
+
+        // Register sorted draws, merging consecutive draws with same state and mode
+        rlDrawCall *sorted = (rlDrawCall *)(RLGL.State.sortBuffer + vertexDataSize);
+        int sortedCounter = 0;
+        int sortedOffset[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+
+        for (int i = 0; i < drawCounter; i++)
+        {
+            const rlDrawCall *draw = &batch->draws[order[i]];
+            rlDrawCall *last = (sortedCounter > 0)? &sorted[sortedCounter - 1] : NULL;
+
+            if ((last != NULL) && (last->mode == draw->mode) && (last->shaderId == draw->shaderId) &&
+                (last->blendMode == draw->blendMode) && (last->textureId == draw->textureId) &&
+                (last->textureCount == draw->textureCount) && (memcmp(last->textureIds, draw->textureIds, draw->textureCount*sizeof(unsigned int)) == 0) &&
+                ((sortedOffset[sortedCounter - 1] + last->vertexCount) == dstOffset[i]) &&
+                (memcmp(&last->projection, &draw->projection, sizeof(RaylibMatrix)) == 0) &&
+                (memcmp(&last->modelview, &draw->modelview, sizeof(RaylibMatrix)) == 0))
+            {
+                last->vertexCount += draw->vertexCount;
+            }
+            else
+            {
+                sorted[sortedCounter] = *draw;
+                sortedOffset[sortedCounter] = dstOffset[i];
+                sortedCounter++;
+            }
+        }
+
+        // Alignment is used as the offset to next draw vertex (it could be negative if vertex data is not reordered)
+        // NOTE: If first sorted draw does not start at vertex 0, an empty draw is added to jump to it,
+        // there is always space for it, batch is drawn as soon as last draw call slot is registered
+        int first = 0;
+        if (sortedOffset[0] != 0)
+        {
+            batch->draws[0] = sorted[0];
+            batch->draws[0].vertexCount = 0;
+            batch->draws[0].vertexAlignment = sortedOffset[0];
+            first = 1;
+        }
+
+        for (int i = 0; i < sortedCounter; i++)
+        {
+            batch->draws[first + i] = sorted[i];
+            if (i < (sortedCounter - 1)) batch->draws[first + i].vertexAlignment = sortedOffset[i + 1] - (sortedOffset[i] + sorted[i].vertexCount);
+            else batch->draws[first + i].vertexAlignment = 0;
+        }
+
+        batch->drawCounter = first + sortedCounter;
+        RLCTX->vertexCounter = vertexCount;
     }
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlLoadShaderDefault(void)
+// Compare draw calls state sorting key (shader, blend, texture), returns <0, 0 or >0 (same as strcmp())
+static int rlCompareDrawState(const rlDrawCall *a, const rlDrawCall *b)
 {
-    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+    if (a->shaderId != b->shaderId) return (a->shaderId < b->shaderId)? -1 : 1;
+    if (a->blendMode != b->blendMode) return (a->blendMode < b->blendMode)? -1 : 1;
+    if (a->textureId != b->textureId) return (a->textureId < b->textureId)? -1 : 1;
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+    return 0;
+}
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderCode =
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+// Get draw call vertex data screen bounds (normalized device coordinates), using draw matrices
+// NOTE: Vertex data bounding box corners are projected, bounds are not available (false returned)
+// if the draw is empty or the box crosses the camera plane (w <= 0)
+static bool rlGetDrawScreenBounds(const rlVertexBuffer *buffer, const rlDrawCall *draw, int offset, float *bounds)
+{
+    if (draw->vertexCount <= 0) return false;
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderCode =
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#elif defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-    "}                                  \n";
-#endif
-#if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#endif
+    const float *positions = NULL;
+    int stride = 3;
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    if (buffer->layout != RL_BATCH_LAYOUT_SEPARATE)
+    {
+        positions = buffer->data[offset].position;
+        stride = sizeof(rlBatchVertex)/sizeof(float);
+    }
+    else positions = buffer->vertices + 3*offset;
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    float min[3] = { positions[0], positions[1], positions[2] };
+    float max[3] = { positions[0], positions[1], positions[2] };
 
-    if (RLGL.State.defaultShaderId > 0)
+    for (int i = 1; i < draw->vertexCount; i++)
     {
-        RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+        const float *position = positions + i*stride;
 
-        // Set default shader locations: attributes locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        for (int k = 0; k < 3; k++)
+        {
+            if (position[k] < min[k]) min[k] = position[k];
+            if (position[k] > max[k]) max[k] = position[k];
+        }
+    }
 
-        // Set default shader locations: uniform locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+    RaylibMatrix mvp = rlMatrixMultiply(draw->modelview, draw->projection);
+
+    for (int c = 0; c < 8; c++)
+    {
+        float x = (c & 1)? max[0] : min[0];
+        float y = (c & 2)? max[1] : min[1];
+        float z = (c & 4)? max[2] : min[2];
+
+        float w = mvp.m3*x + mvp.m7*y + mvp.m11*z + mvp.m15;
+        if (w <= 0.0f) return false;
+
+        float sx = (mvp.m0*x + mvp.m4*y + mvp.m8*z + mvp.m12)/w;
+        float sy = (mvp.m1*x + mvp.m5*y + mvp.m9*z + mvp.m13)/w;
+
+        if ((c == 0) || (sx < bounds[0])) bounds[0] = sx;
+        if ((c == 0) || (sy < bounds[1])) bounds[1] = sy;
+        if ((c == 0) || (sx > bounds[2])) bounds[2] = sx;
+        if ((c == 0) || (sy > bounds[3])) bounds[3] = sy;
     }
-    else RAYLIB_TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+
+    return true;
 }
 
-// Unload default shader
-// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlUnloadShaderDefault(void)
+// Upload draw matrices to shader: mvp, projection, view, model and normal
+static void rlSetDrawUniforms(const int *locs, RaylibMatrix projection, RaylibMatrix modelview)
 {
-    glUseProgram(0);
+    // Create modelview-projection matrix and upload to shader
+    RaylibMatrix matMVP = rlMatrixMultiply(modelview, projection);
+    glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+    if (locs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(projection));
+    }
 
-    glDeleteProgram(RLGL.State.defaultShaderId);
+    // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
+    // transformations and rendering occur between rlPushMatrix and rlPopMatrix.
 
-    RL_FREE(RLGL.State.defaultShaderLocs);
+    if (locs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(modelview));
+    }
 
-    RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+    if (locs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLCTX->transform));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLCTX->transform))));
+    }
+}
+
+// Enable vertex texture slot attribute (shader-location = 6) only if shader declares it
+// NOTE: Location could be auto-assigned by the linker to another shader attribute otherwise,
+// default shader never declares it and its multi-texture variant always does, custom shaders
+// declaring it are registered on program load (see rlCheckTexSlotShader()), no GL query here
+static void rlSetTexSlotAttrib(unsigned int shaderId)
+{
+    bool declared = false;
+
+    if (shaderId == RLGL.State.multiTextureShaderId) declared = true;
+    else if (shaderId != RLGL.State.defaultShaderId)
+    {
+        for (int i = 0; i < RLGL.TexSlotShaders.count; i++)
+        {
+            if (RLGL.TexSlotShaders.shaderIds[i] == shaderId)
+            {
+                declared = true;
+                break;
+            }
+        }
+    }
+
+    if (declared) glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+    else glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
 }
 
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
@@ -4929,8 +8759,258 @@ static const char *rlGetCompressedFormatName(int format)
 }
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
+
+// Bind shader program, skipped if already bound (GL state cache)
+static void rlCacheUseProgram(unsigned int id)
+{
+    if (RLGL.State.cachedShaderId != id)
+    {
+        glUseProgram(id);
+        RLGL.State.cachedShaderId = id;
+        RLGL.Stats.stateChangesIssued++;
+    }
+    else RLGL.Stats.stateChangesSkipped++;
+}
+
+// Bind vertex array, skipped if already bound (GL state cache)
+static void rlCacheBindVertexArray(unsigned int id)
+{
+    if (RLGL.State.cachedVertexArrayId != id)
+    {
+        glBindVertexArray(id);
+        RLGL.State.cachedVertexArrayId = id;
+        RLGL.Stats.stateChangesIssued++;
+    }
+    else RLGL.Stats.stateChangesSkipped++;
+}
+
+// Bind framebuffer, skipped if already bound (GL state cache)
+// NOTE: GL_FRAMEBUFFER target binds both draw and read framebuffers
+static void rlCacheBindFramebuffer(unsigned int target, unsigned int id)
+{
+    bool drawTarget = ((target == GL_FRAMEBUFFER) || (target == GL_DRAW_FRAMEBUFFER));
+    bool readTarget = ((target == GL_FRAMEBUFFER) || (target == GL_READ_FRAMEBUFFER));
+
+    if ((drawTarget && (RLGL.State.cachedDrawFramebufferId != id)) || (readTarget && (RLGL.State.cachedReadFramebufferId != id)))
+    {
+        glBindFramebuffer(target, id);
+        if (drawTarget) RLGL.State.cachedDrawFramebufferId = id;
+        if (readTarget) RLGL.State.cachedReadFramebufferId = id;
+        RLGL.Stats.stateChangesIssued++;
+    }
+    else RLGL.Stats.stateChangesSkipped++;
+}
+
+// Select active texture slot, skipped if already active (GL state cache)
+static void rlCacheActiveTexture(int slot)
+{
+    if (RLGL.State.cachedTextureSlot != slot)
+    {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        RLGL.State.cachedTextureSlot = slot;
+        RLGL.Stats.stateChangesIssued++;
+    }
+    else RLGL.Stats.stateChangesSkipped++;
+}
+
+// Bind cubemap texture to active texture slot, skipped if already bound (GL state cache)
+// NOTE: Only the first RL_MAX_CACHED_TEXTURE_SLOTS slots are tracked, bindings on other slots are always issued
+static void rlCacheBindTextureCubemap(unsigned int id)
+{
+    int slot = RLGL.State.cachedTextureSlot;
+    bool tracked = ((slot >= 0) && (slot < RL_MAX_CACHED_TEXTURE_SLOTS));
+
+    if (tracked && (RLGL.State.cachedCubemapIds[slot] == id)) RLGL.Stats.stateChangesSkipped++;
+    else
+    {
+        glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+        if (tracked) RLGL.State.cachedCubemapIds[slot] = id;
+        RLGL.Stats.stateChangesIssued++;
+        RLGL.Stats.textureBinds++;
+    }
+}
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
 
+// Bind 2D texture to active texture slot, skipped if already bound (GL state cache)
+// NOTE: Only the first RL_MAX_CACHED_TEXTURE_SLOTS slots are tracked, bindings on other slots are always issued
+static void rlCacheBindTexture(unsigned int id)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    int slot = RLGL.State.cachedTextureSlot;
+    bool tracked = ((slot >= 0) && (slot < RL_MAX_CACHED_TEXTURE_SLOTS));
+
+    if (tracked && (RLGL.State.cachedTextureIds[slot] == id)) RLGL.Stats.stateChangesSkipped++;
+    else
+    {
+        glBindTexture(GL_TEXTURE_2D, id);
+        if (tracked) RLGL.State.cachedTextureIds[slot] = id;
+        RLGL.Stats.stateChangesIssued++;
+        RLGL.Stats.textureBinds++;
+    }
+#else
+    glBindTexture(GL_TEXTURE_2D, id);       // No GL state cache on OpenGL 1.1
+#endif
+}
+
+// Push multiple primitives vertex data (quads or triangles)
+// NOTE: Primitives are never split between batches, as many primitives as fit
+// in current vertex buffer are copied at once, applying current transform if required,
+// returns false (nothing pushed) if a single primitive does not fit an empty batch
+static bool rlPushPrimitives(const rlBatchVertex *vertices, int count, int mode, unsigned int textureId)
+{
+    int primitiveVertices = (mode == RL_QUADS)? 4 : 3;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_11)
+    rlSetTexture(textureId);
+    rlBegin(mode);
+    for (int i = 0; i < count*primitiveVertices; i++)
+    {
+        rlColor4ub(vertices[i].color[0], vertices[i].color[1], vertices[i].color[2], vertices[i].color[3]);
+        rlTexCoord2f(vertices[i].texcoord[0], vertices[i].texcoord[1]);
+        rlNormal3f(vertices[i].normal[0], vertices[i].normal[1], vertices[i].normal[2]);
+        rlVertex3f(vertices[i].position[0], vertices[i].position[1], vertices[i].position[2]);
+    }
+    rlEnd();
+    rlSetTexture(0);
+#endif
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // Check primitive fits an empty batch, otherwise batch would be drawn again and again
+    // NOTE: One vertex is kept as security margin, like rlVertex3f() checks
+    int elementCount = RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer].elementCount;
+
+    if ((elementCount*4 - 1) < primitiveVertices)
+    {
+        RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Render batch buffer (%i elements) can not fit a primitive of %i vertex", elementCount, primitiveVertices);
+        return false;
+    }
+
+    rlSetTexture(textureId);
+    rlBegin(mode);
+
+    const RaylibMatrix mat = RLCTX->transform;
+
+    for (int pushed = 0; pushed < count;)
+    {
+        rlVertexBuffer *buffer = &RLCTX->currentBatch->vertexBuffer[RLCTX->currentBatch->currentBuffer];
+
+        // NOTE: Vertex data is transformed by runs (rlFlushTransformRun()), except persistently mapped data
+        bool transformVertices = (RLCTX->transformRequired && buffer->dataMapped);
+
+        // Check batch limit once per chunk
+        // NOTE: One vertex is kept as security margin, like rlVertex3f() checks
+        int available = (buffer->elementCount*4 - RLCTX->vertexCounter - 1)/primitiveVertices;
+
+        if (available <= 0)
+        {
+            // Launch a draw call keeping current state (mode and texture) for next vertices
+            rlCheckRenderBatchLimit(primitiveVertices + 1);
+            continue;
+        }
+
+        int chunk = ((count - pushed) < available)? (count - pushed) : available;
+        int vertexCount = chunk*primitiveVertices;
+        const rlBatchVertex *src = vertices + pushed*primitiveVertices;
+        int offset = RLCTX->vertexCounter;
+
+        if (buffer->layout != RL_BATCH_LAYOUT_SEPARATE)
+        {
+            rlBatchVertex *dst = buffer->data + offset;
+
+            if (!transformVertices)
+            {
+                memcpy(dst, src, vertexCount*sizeof(rlBatchVertex));
+                for (int i = 0; i < vertexCount; i++) dst[i].texslot = RLCTX->texslot;
+            }
+            else
+            {
+                // NOTE: Destination could be write-combined mapped memory, it's only written
+                for (int i = 0; i < vertexCount; i++)
+                {
+                    float x = src[i].position[0];
+                    float y = src[i].position[1];
+                    float z = src[i].position[2];
+                    float nx = src[i].normal[0];
+                    float ny = src[i].normal[1];
+                    float nz = src[i].normal[2];
+
+                    dst[i] = src[i];
+                    dst[i].position[0] = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+                    dst[i].position[1] = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+                    dst[i].position[2] = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+                    dst[i].texslot = RLCTX->texslot;
+
+                    // Transform and normalize normal (same as rlNormal3f())
+                    float tnx = mat.m0*nx + mat.m4*ny + mat.m8*nz;
+                    float tny = mat.m1*nx + mat.m5*ny + mat.m9*nz;
+                    float tnz = mat.m2*nx + mat.m6*ny + mat.m10*nz;
+                    float length = sqrtf(tnx*tnx + tny*tny + tnz*tnz);
+                    if (length != 0.0f)
+                    {
+                        float ilength = 1.0f/length;
+                        tnx *= ilength;
+                        tny *= ilength;
+                        tnz *= ilength;
+                    }
+                    dst[i].normal[0] = tnx;
+                    dst[i].normal[1] = tny;
+                    dst[i].normal[2] = tnz;
+                }
+            }
+        }
+        else
+        {
+            float *positions = buffer->vertices + 3*offset;
+            float *texcoords = buffer->texcoords + 2*offset;
+            float *normals = buffer->normals + 3*offset;
+            unsigned char *colors = buffer->colors + 4*offset;
+            unsigned char *texslots = buffer->texslots + offset;
+
+            for (int i = 0; i < vertexCount; i++)
+            {
+                positions[3*i] = src[i].position[0];
+                positions[3*i + 1] = src[i].position[1];
+                positions[3*i + 2] = src[i].position[2];
+                texcoords[2*i] = src[i].texcoord[0];
+                texcoords[2*i + 1] = src[i].texcoord[1];
+                normals[3*i] = src[i].normal[0];
+                normals[3*i + 1] = src[i].normal[1];
+                normals[3*i + 2] = src[i].normal[2];
+                colors[4*i] = src[i].color[0];
+                colors[4*i + 1] = src[i].color[1];
+                colors[4*i + 2] = src[i].color[2];
+                colors[4*i + 3] = src[i].color[3];
+                texslots[i] = RLCTX->texslot;
+            }
+        }
+
+        RLCTX->vertexCounter += vertexCount;
+        RLCTX->currentBatch->draws[RLCTX->currentBatch->drawCounter - 1].vertexCount += vertexCount;
+        pushed += chunk;
+    }
+
+    rlEnd();
+    rlSetTexture(0);
+#endif
+
+    return true;
+}
+
+// Copy screen pixel data (RGBA) flipped vertically, alpha set to 255
+// NOTE: glReadPixels() returns rows bottom to top, rows are copied whole and alpha is fixed
+// while the row is still in cache (no transparent image retrieval, alpha is already applied to RGB)
+static void rlCopyScreenPixels(unsigned char *dst, const unsigned char *src, int width, int height)
+{
+    int rowSize = width*4;
+
+    for (int y = 0; y < height; y++)
+    {
+        unsigned char *row = dst + (size_t)y*rowSize;
+        memcpy(row, src + (size_t)(height - 1 - y)*rowSize, rowSize);
+
+        for (int x = 3; x < rowSize; x += 4) row[x] = 255;
+    }
+}
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
@@ -4958,11 +9038,13 @@ static int rlGetPixelDataSize(int width, int height, int format)
         case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
         case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
         case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_BC4_R: bpp = 4; break;
         case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
         case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
         case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_BC5_RG: bpp = 8; break;
         case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
         default: break;
     }
@@ -4970,11 +9052,17 @@ static int rlGetPixelDataSize(int width, int height, int format)
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
     // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // data size is rounded up to full blocks (8 or 16 bytes per block)
+    if (((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_BC4_R) || (format == RL_PIXELFORMAT_COMPRESSED_BC5_RG))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*(16*bpp/8);
+    }
+    else if ((width < 4) && (height < 4))
     {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        // PVRT textures smaller than a block, minimum dataSize is 16
+        if ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)) dataSize = 16;
     }
 
     return dataSize;
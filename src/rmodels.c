@@ -1489,18 +1489,23 @@ void RaylibDrawMesh(RaylibMesh mesh, RaylibMaterial material, RaylibMatrix trans
 
     for (int eye = 0; eye < eyeCount; eye++)
     {
-        // Calculate model-view-projection matrix (MVP)
-        RaylibMatrix matModelViewProjection = RaylibMatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = RaylibMatrixMultiply(matModelView, matProjection);
-        else
+        // Setup current eye viewport (half screen width) and camera uniform block
+        if (eyeCount > 1)
         {
-            // Setup current eye viewport (half screen width)
             rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = RaylibMatrixMultiply(RaylibMatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            rlSetUniformBlockCameraEye(eye);
         }
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        // Calculate model-view-projection matrix (MVP) and send it to shader (if location available)
+        // NOTE: Shaders using the camera uniform block (rlSetUniformBlockCamera()) could skip it, only model matrix is required per draw
+        if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP] != -1)
+        {
+            RaylibMatrix matModelViewProjection = RaylibMatrixIdentity();
+            if (eyeCount == 1) matModelViewProjection = RaylibMatrixMultiply(matModelView, matProjection);
+            else matModelViewProjection = RaylibMatrixMultiply(RaylibMatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+
+            rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        }
 
         // Draw mesh
         if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
@@ -1508,6 +1513,7 @@ void RaylibDrawMesh(RaylibMesh mesh, RaylibMaterial material, RaylibMatrix trans
     }
 
     // Unbind all bound texture maps
+    // NOTE: Unbinds go through rlgl state cache, already unbound slots are skipped
     for (int i = 0; i < RAYLIB_MAX_MATERIAL_MAPS; i++)
     {
         if (material.maps[i].texture.id > 0)
@@ -1523,6 +1529,8 @@ void RaylibDrawMesh(RaylibMesh mesh, RaylibMaterial material, RaylibMatrix trans
         }
     }
 
+    rlActiveTextureSlot(0);
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1707,18 +1715,23 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
 
     for (int eye = 0; eye < eyeCount; eye++)
     {
-        // Calculate model-view-projection matrix (MVP)
-        RaylibMatrix matModelViewProjection = RaylibMatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = RaylibMatrixMultiply(matModelView, matProjection);
-        else
+        // Setup current eye viewport (half screen width) and camera uniform block
+        if (eyeCount > 1)
         {
-            // Setup current eye viewport (half screen width)
             rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = RaylibMatrixMultiply(RaylibMatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            rlSetUniformBlockCameraEye(eye);
         }
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        // Calculate model-view-projection matrix (MVP) and send it to shader (if location available)
+        // NOTE: Shaders using the camera uniform block (rlSetUniformBlockCamera()) could skip it, only model matrix is required per draw
+        if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP] != -1)
+        {
+            RaylibMatrix matModelViewProjection = RaylibMatrixIdentity();
+            if (eyeCount == 1) matModelViewProjection = RaylibMatrixMultiply(matModelView, matProjection);
+            else matModelViewProjection = RaylibMatrixMultiply(RaylibMatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+
+            rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        }
 
         // Draw mesh instanced
         if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
@@ -1726,6 +1739,7 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
     }
 
     // Unbind all bound texture maps
+    // NOTE: Unbinds go through rlgl state cache, already unbound slots are skipped
     for (int i = 0; i < RAYLIB_MAX_MATERIAL_MAPS; i++)
     {
         if (material.maps[i].texture.id > 0)
@@ -1741,6 +1755,8 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
         }
     }
 
+    rlActiveTextureSlot(0);
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1755,6 +1771,343 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
 #endif
 }
 
+// Load mesh batch, meshes sharing vertex format packed in shared vertex/index buffers
+// NOTE: Requires indirect multi-draw support (OpenGL 4.3), mesh static vertex data is packed (no animation),
+// one draw command is registered per mesh, its transform is fetched as instanced attribute (baseInstance = mesh index)
+RaylibMeshBatch RaylibLoadMeshBatch(const RaylibMesh *meshes, int meshCount)
+{
+    RaylibMeshBatch batch = { 0 };
+
+    if ((meshes == NULL) || (meshCount <= 0)) return batch;
+
+    if (!rlIsDrawIndirectSupported())
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Mesh batch requires indirect multi-draw support (OpenGL 4.3)");
+        return batch;
+    }
+
+    // Check all meshes share vertex format and get packed data size
+    for (int i = 0; i < meshCount; i++)
+    {
+        const RaylibMesh *mesh = &meshes[i];
+
+        if ((mesh->vertices == NULL) ||
+            ((mesh->texcoords == NULL) != (meshes[0].texcoords == NULL)) ||
+            ((mesh->normals == NULL) != (meshes[0].normals == NULL)) ||
+            ((mesh->colors == NULL) != (meshes[0].colors == NULL)) ||
+            ((mesh->tangents == NULL) != (meshes[0].tangents == NULL)) ||
+            ((mesh->texcoords2 == NULL) != (meshes[0].texcoords2 == NULL)))
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: [%i] Mesh batch requires all meshes to share vertex format", i);
+            return batch;
+        }
+
+        // NOTE: Indices are generated for non-indexed meshes, limited to 16bit indices
+        if ((mesh->indices == NULL) && (mesh->vertexCount > 65536))
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: [%i] Mesh batch non-indexed mesh exceeds 16bit indices limit", i);
+            return batch;
+        }
+
+        batch.vertexCount += mesh->vertexCount;
+        batch.indexCount += (mesh->indices != NULL)? mesh->triangleCount*3 : mesh->vertexCount;
+    }
+
+    batch.meshCount = meshCount;
+
+    // Pack meshes vertex data and register one draw command per mesh
+    float *vertices = (float *)RL_MALLOC(batch.vertexCount*3*sizeof(float));
+    float *texcoords = (meshes[0].texcoords != NULL)? (float *)RL_MALLOC(batch.vertexCount*2*sizeof(float)) : NULL;
+    float *normals = (meshes[0].normals != NULL)? (float *)RL_MALLOC(batch.vertexCount*3*sizeof(float)) : NULL;
+    unsigned char *colors = (meshes[0].colors != NULL)? (unsigned char *)RL_MALLOC(batch.vertexCount*4*sizeof(unsigned char)) : NULL;
+    float *tangents = (meshes[0].tangents != NULL)? (float *)RL_MALLOC(batch.vertexCount*4*sizeof(float)) : NULL;
+    float *texcoords2 = (meshes[0].texcoords2 != NULL)? (float *)RL_MALLOC(batch.vertexCount*2*sizeof(float)) : NULL;
+    unsigned short *indices = (unsigned short *)RL_MALLOC(batch.indexCount*sizeof(unsigned short));
+    rlDrawIndirectCommand *commands = (rlDrawIndirectCommand *)RL_MALLOC(meshCount*sizeof(rlDrawIndirectCommand));
+    Raylibfloat16 *transforms = (Raylibfloat16 *)RL_MALLOC(meshCount*sizeof(Raylibfloat16));
+
+    int vertexOffset = 0;
+    int indexOffset = 0;
+
+    for (int i = 0; i < meshCount; i++)
+    {
+        const RaylibMesh *mesh = &meshes[i];
+        int indexCount = (mesh->indices != NULL)? mesh->triangleCount*3 : mesh->vertexCount;
+
+        memcpy(vertices + vertexOffset*3, mesh->vertices, mesh->vertexCount*3*sizeof(float));
+        if (texcoords != NULL) memcpy(texcoords + vertexOffset*2, mesh->texcoords, mesh->vertexCount*2*sizeof(float));
+        if (normals != NULL) memcpy(normals + vertexOffset*3, mesh->normals, mesh->vertexCount*3*sizeof(float));
+        if (colors != NULL) memcpy(colors + vertexOffset*4, mesh->colors, mesh->vertexCount*4*sizeof(unsigned char));
+        if (tangents != NULL) memcpy(tangents + vertexOffset*4, mesh->tangents, mesh->vertexCount*4*sizeof(float));
+        if (texcoords2 != NULL) memcpy(texcoords2 + vertexOffset*2, mesh->texcoords2, mesh->vertexCount*2*sizeof(float));
+
+        // NOTE: Indices are kept relative to mesh, vertex offset is applied by draw command baseVertex
+        if (mesh->indices != NULL) memcpy(indices + indexOffset, mesh->indices, indexCount*sizeof(unsigned short));
+        else for (int k = 0; k < indexCount; k++) indices[indexOffset + k] = (unsigned short)k;
+
+        commands[i].count = indexCount;
+        commands[i].instanceCount = 1;
+        commands[i].firstIndex = indexOffset;
+        commands[i].baseVertex = vertexOffset;
+        commands[i].baseInstance = i;
+
+        transforms[i] = RaylibMatrixToFloatV(RaylibMatrixIdentity());
+
+        vertexOffset += mesh->vertexCount;
+        indexOffset += indexCount;
+    }
+
+    // Upload packed data, same vertex attributes layout as RaylibUploadMesh()
+    batch.vboId = (unsigned int *)RL_CALLOC(RAYLIB_MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+    batch.vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(batch.vaoId);
+
+    batch.vboId[0] = rlLoadVertexBuffer(vertices, batch.vertexCount*3*sizeof(float), false);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, 0, 0, 0);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+
+    if (texcoords != NULL)
+    {
+        batch.vboId[1] = rlLoadVertexBuffer(texcoords, batch.vertexCount*2*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+
+    if (normals != NULL)
+    {
+        batch.vboId[2] = rlLoadVertexBuffer(normals, batch.vertexCount*3*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+
+    if (colors != NULL)
+    {
+        batch.vboId[3] = rlLoadVertexBuffer(colors, batch.vertexCount*4*sizeof(unsigned char), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+    else
+    {
+        // Default vertex attribute: color
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // RAYLIB_WHITE
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, value, RAYLIB_SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+
+    if (tangents != NULL)
+    {
+        batch.vboId[4] = rlLoadVertexBuffer(tangents, batch.vertexCount*4*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+
+    if (texcoords2 != NULL)
+    {
+        batch.vboId[5] = rlLoadVertexBuffer(texcoords2, batch.vertexCount*2*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+
+    batch.vboId[6] = rlLoadVertexBufferElement(indices, batch.indexCount*sizeof(unsigned short), false);
+
+    rlDisableVertexArray();
+
+    // NOTE: Commands and transforms are shader storage buffers, they can be written by compute shaders
+    // (i.e. GPU culling setting instanceCount to 0) binding them with rlBindShaderBuffer()
+    batch.commandsId = rlLoadShaderBuffer(meshCount*sizeof(rlDrawIndirectCommand), commands, RL_DYNAMIC_COPY);
+    batch.transformsId = rlLoadShaderBuffer(meshCount*sizeof(Raylibfloat16), transforms, RL_DYNAMIC_DRAW);
+
+    RL_FREE(vertices);
+    RL_FREE(texcoords);
+    RL_FREE(normals);
+    RL_FREE(colors);
+    RL_FREE(tangents);
+    RL_FREE(texcoords2);
+    RL_FREE(indices);
+    RL_FREE(commands);
+    RL_FREE(transforms);
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "VAO: [ID %i] Mesh batch loaded successfully (%i meshes, %i vertices)", batch.vaoId, batch.meshCount, batch.vertexCount);
+
+    return batch;
+}
+
+// Check if a mesh batch is ready
+bool RaylibIsMeshBatchReady(RaylibMeshBatch batch)
+{
+    return ((batch.vaoId > 0) && (batch.commandsId > 0) && (batch.transformsId > 0) && (batch.meshCount > 0));
+}
+
+// Unload mesh batch from GPU memory (VRAM)
+void RaylibUnloadMeshBatch(RaylibMeshBatch batch)
+{
+    rlUnloadVertexArray(batch.vaoId);
+
+    if (batch.vboId != NULL) for (int i = 0; i < RAYLIB_MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(batch.vboId[i]);
+    RL_FREE(batch.vboId);
+
+    if (batch.commandsId > 0) rlUnloadShaderBuffer(batch.commandsId);
+    if (batch.transformsId > 0) rlUnloadShaderBuffer(batch.transformsId);
+}
+
+// Update mesh batch per-draw transforms, starting at mesh index offset
+void RaylibUpdateMeshBatchTransforms(RaylibMeshBatch batch, const RaylibMatrix *transforms, int offset, int count)
+{
+    if ((offset < 0) || (count <= 0) || ((offset + count) > batch.meshCount)) return;
+
+    Raylibfloat16 *data = (Raylibfloat16 *)RL_MALLOC(count*sizeof(Raylibfloat16));
+    for (int i = 0; i < count; i++) data[i] = RaylibMatrixToFloatV(transforms[i]);
+
+    rlUpdateShaderBuffer(batch.transformsId, data, count*sizeof(Raylibfloat16), offset*sizeof(Raylibfloat16));
+
+    RL_FREE(data);
+}
+
+// Draw all mesh batch meshes with material in a single indirect multi-draw
+// NOTE: Same shader inputs as RaylibDrawMeshInstanced(), per-draw transform is sent to
+// shader attribute location RAYLIB_SHADER_LOC_MATRIX_MODEL (i.e. in mat4 instanceTransform)
+void RaylibDrawMeshBatch(RaylibMeshBatch batch, RaylibMaterial material)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    if (!RaylibIsMeshBatchReady(batch)) return;
+
+    // Bind shader program
+    rlEnableShader(material.shader.id);
+
+    // Send required data to shader (matrices, values)
+    //-----------------------------------------------------
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[RAYLIB_SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[RAYLIB_MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[RAYLIB_MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[RAYLIB_MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[RAYLIB_MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[RAYLIB_SHADER_LOC_COLOR_DIFFUSE], values, RAYLIB_SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[RAYLIB_SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[RAYLIB_MATERIAL_MAP_SPECULAR].color.r/255.0f,
+            (float)material.maps[RAYLIB_MATERIAL_MAP_SPECULAR].color.g/255.0f,
+            (float)material.maps[RAYLIB_MATERIAL_MAP_SPECULAR].color.b/255.0f,
+            (float)material.maps[RAYLIB_MATERIAL_MAP_SPECULAR].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[RAYLIB_SHADER_LOC_COLOR_SPECULAR], values, RAYLIB_SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
+    RaylibMatrix matView = rlGetMatrixModelview();
+    RaylibMatrix matProjection = rlGetMatrixProjection();
+
+    // Upload view and projection matrices (if locations available)
+    if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_VIEW], matView);
+    if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_PROJECTION], matProjection);
+
+    // Accumulate internal matrix transform (push/pop) and view matrix
+    // NOTE: Per-draw model transformation must be computed in the shader
+    RaylibMatrix matModelView = RaylibMatrixMultiply(rlGetMatrixTransform(), matView);
+    //-----------------------------------------------------
+
+    // Bind active texture maps (if available)
+    for (int i = 0; i < RAYLIB_MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
+
+            // Enable texture for active slot
+            if ((i == RAYLIB_MATERIAL_MAP_IRRADIANCE) ||
+                (i == RAYLIB_MATERIAL_MAP_PREFILTER) ||
+                (i == RAYLIB_MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
+
+            rlSetUniform(material.shader.locs[RAYLIB_SHADER_LOC_MAP_DIFFUSE + i], &i, RAYLIB_SHADER_UNIFORM_INT, 1);
+        }
+    }
+
+    rlEnableVertexArray(batch.vaoId);
+
+    // Per-draw transforms are sent to shader attribute location: RAYLIB_SHADER_LOC_MATRIX_MODEL
+    // NOTE: Transforms buffer is read as instanced attribute, draw command baseInstance selects mesh transform
+    if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        rlEnableVertexBuffer(batch.transformsId);
+
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            rlEnableVertexAttribute(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] + i);
+            rlSetVertexAttribute(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(RaylibMatrix), i*sizeof(RaylibVector4));
+            rlSetVertexAttributeDivisor(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] + i, 1);
+        }
+
+        rlDisableVertexBuffer();
+    }
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Setup current eye viewport (half screen width) and camera uniform block
+        if (eyeCount > 1)
+        {
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            rlSetUniformBlockCameraEye(eye);
+        }
+
+        // Calculate model-view-projection matrix (MVP) and send it to shader (if location available)
+        if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP] != -1)
+        {
+            RaylibMatrix matModelViewProjection = RaylibMatrixIdentity();
+            if (eyeCount == 1) matModelViewProjection = RaylibMatrixMultiply(matModelView, matProjection);
+            else matModelViewProjection = RaylibMatrixMultiply(RaylibMatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+
+            rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        }
+
+        // Draw all meshes
+        rlDrawVertexArrayElementsIndirect(batch.commandsId, 0, batch.meshCount);
+    }
+
+    // Unbind all bound texture maps
+    // NOTE: Unbinds go through rlgl state cache, already unbound slots are skipped
+    for (int i = 0; i < RAYLIB_MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
+
+            // Disable texture for active slot
+            if ((i == RAYLIB_MATERIAL_MAP_IRRADIANCE) ||
+                (i == RAYLIB_MATERIAL_MAP_PREFILTER) ||
+                (i == RAYLIB_MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
+    }
+
+    rlActiveTextureSlot(0);
+
+    rlDisableVertexArray();
+
+    // Disable shader program
+    rlDisableShader();
+#endif
+}
+
 // Unload mesh from memory (RAM and VRAM)
 void RaylibUnloadMesh(RaylibMesh mesh)
 {
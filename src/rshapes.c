@@ -721,44 +721,39 @@ void RaylibDrawRectanglePro(RaylibRectangle rec, RaylibVector2 origin, float rot
         bottomRight.y = y + (dx + rec.width)*sinRotation + (dy + rec.height)*cosRotation;
     }
 
+    float z = rlGetCurrentDepth();  // Same depth rlVertex2f() uses
+
 #if defined(RAYLIB_SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(RaylibGetShapesTexture().id);
     RaylibRectangle shapeRect = RaylibGetShapesTextureRectangle();
+    float left = shapeRect.x/texShapes.width;
+    float right = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float top = shapeRect.y/texShapes.height;
+    float bottom = (shapeRect.y + shapeRect.height)/texShapes.height;
+
+    // NOTE: Quad vertex order: top-left, bottom-left, bottom-right, top-right
+    rlQuad quad = {
+        .vertices = {
+            { { topLeft.x, topLeft.y, z }, { left, top }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { bottomLeft.x, bottomLeft.y, z }, { left, bottom }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { bottomRight.x, bottomRight.y, z }, { right, bottom }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { topRight.x, topRight.y, z }, { right, top }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } }
+        }
+    };
 
-    rlBegin(RL_QUADS);
-
-        rlNormal3f(0.0f, 0.0f, 1.0f);
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
-
-    rlEnd();
-
-    rlSetTexture(0);
+    rlPushQuads(&quad, 1, RaylibGetShapesTexture().id);
 #else
-    rlBegin(RL_TRIANGLES);
-
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlVertex2f(topLeft.x, topLeft.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(topRight.x, topRight.y);
-
-        rlVertex2f(topRight.x, topRight.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(bottomRight.x, bottomRight.y);
+    rlTriangle triangles[2] = {
+        { .vertices = {
+            { { topLeft.x, topLeft.y, z }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { bottomLeft.x, bottomLeft.y, z }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { topRight.x, topRight.y, z }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } } } },
+        { .vertices = {
+            { { topRight.x, topRight.y, z }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { bottomLeft.x, bottomLeft.y, z }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } },
+            { { bottomRight.x, bottomRight.y, z }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { color.r, color.g, color.b, color.a } } } }
+    };
 
-    rlEnd();
+    rlPushTriangles(triangles, 2, rlGetTextureIdDefault());
 #endif
 }
 
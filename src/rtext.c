@@ -1125,6 +1125,22 @@ void RaylibDrawFPS(int posX, int posY)
     RaylibDrawText(RaylibTextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw render statistics for current frame
+// NOTE: Statistics are reset on RaylibBeginDrawing(), call it after frame drawing to get them all
+void RaylibDrawRenderStats(int posX, int posY)
+{
+    rlRenderStats stats = rlGetRenderStats();
+
+    RaylibDrawText(RaylibTextFormat("DRAW CALLS: %u  VERTEX: %u", stats.drawCalls, stats.vertexCount), posX, posY, 10, RAYLIB_LIME);
+    RaylibDrawText(RaylibTextFormat("BATCH FLUSHES: %u (FULL: %u, LIMIT: %u, EXPLICIT: %u)", stats.batchFlushes,
+        stats.flushBufferFull, stats.flushDrawCallsLimit, stats.flushExplicit), posX, posY + 12, 10, RAYLIB_LIME);
+    RaylibDrawText(RaylibTextFormat("FLUSH CHANGES: SHADER %u, BLEND %u, MATRIX %u", stats.flushShaderChange,
+        stats.flushBlendChange, stats.flushMatrixChange), posX, posY + 24, 10, RAYLIB_LIME);
+    RaylibDrawText(RaylibTextFormat("BATCH BREAKS: TEXTURE %u, MODE %u", stats.textureChanges, stats.modeChanges), posX, posY + 36, 10, RAYLIB_LIME);
+    RaylibDrawText(RaylibTextFormat("UPLOADED: %u KB  TEXTURE BINDS: %u", stats.uploadedBytes/1024, stats.textureBinds), posX, posY + 48, 10, RAYLIB_LIME);
+    RaylibDrawText(RaylibTextFormat("STATE CHANGES: %u (SKIPPED: %u)", stats.stateChangesIssued, stats.stateChangesSkipped), posX, posY + 60, 10, RAYLIB_LIME);
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
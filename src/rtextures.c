@@ -34,10 +34,17 @@
 *       #define RAYLIB_SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define RTEXTURES_NO_SIMD
+*           Disable SSE2/NEON code paths on image processing, scalar code is used
+*
+*       #define RTEXTURES_NO_THREADS
+*           Disable image processing worker threads, all work is done on calling thread
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
 *       stb_image_resize - Multiple image resize algorithms
+*       stb_rect_pack    - Rectangles packing, required for texture atlas pages
 *
 *
 *   LICENSE: zlib/libpng
@@ -78,6 +85,41 @@
 #include <math.h>               // Required for: fabsf() [Used in RaylibDrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in RaylibExportImageAsCode()]
 
+#if !defined(RTEXTURES_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics [Used in GetBlockBounds(), GetBlockDots(), PackPixelsRGBA(), UnpackPixelsRGBA()]
+        #define RTEXTURES_SIMD_SSE2
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #include <arm_neon.h>   // Required for: NEON intrinsics [Used in GetBlockBounds(), GetBlockDots(), PackPixelsRGBA(), UnpackPixelsRGBA()]
+        #define RTEXTURES_SIMD_NEON
+    #endif
+#endif
+
+#if !defined(RTEXTURES_NO_THREADS)
+    #if defined(_WIN32)
+        #define RTEXTURES_THREADS_WIN32
+        // Avoid including windows.h, only some thread functions required
+        __declspec(dllimport) void *__stdcall CreateThread(void *lpThreadAttributes, size_t dwStackSize, unsigned long (__stdcall *lpStartAddress)(void *), void *lpParameter, unsigned long dwCreationFlags, unsigned long *lpThreadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **SRWLock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **SRWLock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **ConditionVariable, void **SRWLock, unsigned long dwMilliseconds, unsigned long Flags);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(void **ConditionVariable);
+        __declspec(dllimport) int __stdcall SwitchToThread(void);
+    #elif !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*() [Used by image threads pool]
+        #include <sched.h>      // Required for: sched_yield() [Used in ImageDitherRows()]
+        #include <unistd.h>     // Required for: sysconf() [Used in StartImageThreadPool()]
+        #define RTEXTURES_THREADS_PTHREAD
+    #endif
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>         // Required for: _InterlockedExchangeAdd(), _InterlockedExchange(), _InterlockedOr() [Used in ImageDitherRows()]
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -219,7 +261,12 @@
 #endif
 
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include "external/stb_image_resize2.h"     // Required for: stbir_resize_uint8_linear() [RaylibImageResize()]
+#include "external/stb_image_resize2.h"     // Required for: stbir_resize_init(), stbir_resize_extended_split() [RaylibImageResize()]
+
+// NOTE: Static implementation, rtext module compiles its own one for font atlas generation
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"         // Required for: stbrp_pack_rects() [RaylibAddTextureAtlasImages()]
 
 #if defined(__GNUC__) // GCC and Clang
     #pragma GCC diagnostic pop
@@ -244,15 +291,257 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_MAX_THREADS
+    #define IMAGE_MAX_THREADS        16    // Maximum number of threads used for image processing jobs
+#endif
+
+#ifndef IMAGE_PIPELINE_TILE_SIZE
+    #define IMAGE_PIPELINE_TILE_SIZE  512  // Pixels processed per image pipeline tile, tile buffer (RGBA 32bit) fits in L1 cache
+#endif
+
+// Threads pool synchronization primitives
+#if defined(RTEXTURES_THREADS_WIN32)
+    #define IMAGE_POOL_LOCK()           AcquireSRWLockExclusive(&imagePool.mutex)
+    #define IMAGE_POOL_UNLOCK()         ReleaseSRWLockExclusive(&imagePool.mutex)
+    #define IMAGE_POOL_WAIT()           SleepConditionVariableSRW(&imagePool.cond, &imagePool.mutex, 0xffffffff, 0)   // INFINITE
+    #define IMAGE_POOL_WAKE()           WakeAllConditionVariable(&imagePool.cond)
+    #define IMAGE_THREAD_YIELD()        SwitchToThread()
+#elif defined(RTEXTURES_THREADS_PTHREAD)
+    #define IMAGE_POOL_LOCK()           pthread_mutex_lock(&imagePool.mutex)
+    #define IMAGE_POOL_UNLOCK()         pthread_mutex_unlock(&imagePool.mutex)
+    #define IMAGE_POOL_WAIT()           pthread_cond_wait(&imagePool.cond, &imagePool.mutex)
+    #define IMAGE_POOL_WAKE()           pthread_cond_broadcast(&imagePool.cond)
+    #define IMAGE_THREAD_YIELD()        sched_yield()
+#else
+    #define IMAGE_THREAD_YIELD()        ((void)0)
+#endif
+
+// Atomic int operations, used to share progress between image job threads
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define IMAGE_ATOMIC_LOAD(ptr)          _InterlockedOr((volatile long *)(ptr), 0)
+    #define IMAGE_ATOMIC_STORE(ptr, value)  _InterlockedExchange((volatile long *)(ptr), (long)(value))
+    #define IMAGE_ATOMIC_ADD(ptr, value)    _InterlockedExchangeAdd((volatile long *)(ptr), (long)(value))
+#else
+    #define IMAGE_ATOMIC_LOAD(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define IMAGE_ATOMIC_STORE(ptr, value)  __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #define IMAGE_ATOMIC_ADD(ptr, value)    __atomic_fetch_add((ptr), (value), __ATOMIC_ACQ_REL)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Texture atlas page packing data
+typedef struct RaylibAtlasPage {
+    stbrp_context context;          // Rectangles packing context (skyline)
+    stbrp_node *nodes;              // Rectangles packing nodes, one per page column
+    int regionCount;                // Number of images packed in page
+    int usedArea;                   // Pixels covered by packed images
+} RaylibAtlasPage;
+
+// Image parallel job function, processes items in range [start, end)
+typedef void (*ImageJobFunc)(void *data, int start, int end);
+
+// Image parallel job range, processed by one thread
+typedef struct ImageJobRange {
+    ImageJobFunc func;              // Job function
+    void *data;                     // Job data, shared by all ranges
+    int start;                      // First item to process
+    int end;                        // Last item to process (not included)
+} ImageJobRange;
+
+// Image block compression job data
+typedef struct CompressBlocksJob {
+    const unsigned char *pixels;    // Source pixels (RGBA 32bit)
+    int width;                      // Source width
+    int height;                     // Source height
+    unsigned char *output;          // Compressed blocks output
+    int format;                     // Compressed format (RaylibPixelFormat type)
+    int quality;                    // Compression quality (RaylibCompressionQuality type)
+} CompressBlocksJob;
+
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+// Image worker threads pool, workers process job ranges dispatched by ImageParallelFor()
+// NOTE: First range of every job is processed by calling thread
+typedef struct ImageThreadPool {
+    int requestedCount;             // Worker threads requested (-1: processors available minus one)
+    int threadCount;                // Worker threads running
+    bool ready;                     // Worker threads started for requested count
+    bool busy;                      // Pool is processing a job, other jobs run on their calling thread
+    bool quit;                      // Worker threads must finish
+    unsigned int generation;        // Dispatched jobs counter, workers wait for it to change
+    unsigned int seen[IMAGE_MAX_THREADS];       // Last job generation seen by every worker
+    int rangeCount;                 // Current job ranges count
+    int pending;                    // Current job ranges still being processed by workers
+    ImageJobRange ranges[IMAGE_MAX_THREADS];    // Current job ranges
+#if defined(RTEXTURES_THREADS_WIN32)
+    void *mutex;                    // Pool lock (SRWLOCK)
+    void *cond;                     // Pool condition (CONDITION_VARIABLE), signaled on job dispatched and finished
+    void *threads[IMAGE_MAX_THREADS];           // Worker threads handles
+#else
+    pthread_mutex_t mutex;          // Pool lock
+    pthread_cond_t cond;            // Pool condition, signaled on job dispatched and finished
+    pthread_t threads[IMAGE_MAX_THREADS];       // Worker threads
+#endif
+} ImageThreadPool;
+#endif
+
+// Image generation job data
+// NOTE: Fields used depend on generator
+typedef struct GenImageJob {
+    RaylibColor *pixels;            // Output pixels
+    int width;                      // Image width
+    int height;                     // Image height
+    RaylibColor col1;               // Gradient start/inner color, checked first color
+    RaylibColor col2;               // Gradient end/outer color, checked second color
+    float cosDir;                   // Linear gradient direction cosine
+    float sinDir;                   // Linear gradient direction sine
+    float density;                  // Radial/square gradient density
+    int checksX;                    // Checked size X
+    int checksY;                    // Checked size Y
+    int offsetX;                    // Perlin noise offset X
+    int offsetY;                    // Perlin noise offset Y
+    float scale;                    // Perlin noise scale
+    int tileSize;                   // Cellular tile size
+    int seedsPerRow;                // Cellular seeds per row
+    int seedsPerCol;                // Cellular seeds per column
+    RaylibVector2 *seeds;           // Cellular seeds
+} GenImageJob;
+
+// Image color adjustment job data
+typedef struct ImageColorJob {
+    RaylibColor *pixels;            // Pixels to be adjusted
+    RaylibColor color;              // Tint color, color to replace
+    RaylibColor replace;            // Replacement color
+    float contrast;                 // Contrast factor
+    int brightness;                 // Brightness offset
+} ImageColorJob;
+
+// Image blur pass job data
+// NOTE: Box blur divides running sums by window size using inverse[size] = ceil(2^31/size),
+// gaussian blur uses 1.14 fixed point weights (summing 16384) padded to an even number of taps
+typedef struct ImageBlurJob {
+    unsigned char *pixels;          // Pixels to be blurred (RGBA 32bit, premultiplied alpha)
+    int width;                      // Image width
+    int height;                     // Image height
+    int blurSize;                   // Box blur radius
+    const unsigned int *inverse;    // Box blur window size inverses
+    const short *weights;           // Gaussian kernel weights (NULL for box blur)
+    int radius;                     // Gaussian kernel radius
+} ImageBlurJob;
+
+// Image kernel convolution job data
+typedef struct ImageConvolutionJob {
+    const RaylibColor *pixels;      // Input pixels
+    RaylibVector4 *output;          // Output pixels (normalized)
+    int width;                      // Image width
+    int height;                     // Image height
+    const float *kernel;            // Convolution kernel
+    int kernelWidth;                // Kernel width
+    int startRange;                 // Kernel offset start
+    int endRange;                   // Kernel offset end (not included)
+} ImageConvolutionJob;
+
+// Image rotation job data
+typedef struct ImageRotateJob {
+    const unsigned char *data;      // Input pixels
+    unsigned char *output;          // Output pixels
+    int width;                      // Input width
+    int height;                     // Input height
+    int newWidth;                   // Output width
+    int newHeight;                  // Output height
+    int bytesPerPixel;              // Pixel size in bytes
+    float sinRadius;                // Rotation sine
+    float cosRadius;                // Rotation cosine
+} ImageRotateJob;
+
+// Image dithering job data
+// NOTE: Rows are processed in order as a wavefront, every row waits on previous row progress
+typedef struct ImageDitherJob {
+    RaylibColor *pixels;            // Input pixels, error is diffused into them
+    unsigned short *output;         // Output pixels (16bit)
+    int width;                      // Image width
+    int height;                     // Image height
+    int rBpp;                       // Red bits
+    int gBpp;                       // Green bits
+    int bBpp;                       // Blue bits
+    int aBpp;                       // Alpha bits
+    int nextRow;                    // Next row to be processed (atomic)
+    int *progress;                  // Pixels processed per row (atomic)
+} ImageDitherJob;
+
+// Image pipeline operation type
+typedef enum {
+    IMAGE_PIPELINE_CROP = 0,
+    IMAGE_PIPELINE_RESIZE,
+    IMAGE_PIPELINE_FORMAT,
+    IMAGE_PIPELINE_COLOR_TINT,
+    IMAGE_PIPELINE_COLOR_INVERT,
+    IMAGE_PIPELINE_COLOR_CONTRAST,
+    IMAGE_PIPELINE_COLOR_BRIGHTNESS,
+    IMAGE_PIPELINE_COLOR_REPLACE
+} ImagePipelineOpType;
+
+// Image pipeline recorded operation
+// NOTE: Parameters are stored as provided, they are validated on pipeline execution
+typedef struct RaylibImagePipelineOp {
+    int type;                       // Operation type (ImagePipelineOpType)
+    RaylibRectangle crop;           // Crop rectangle
+    int width;                      // Resize width
+    int height;                     // Resize height
+    int format;                     // Conversion format (RaylibPixelFormat type)
+    RaylibColor color;              // Tint color, color to replace
+    RaylibColor replace;            // Replacement color
+    float contrast;                 // Contrast value (-100 to 100)
+    int brightness;                 // Brightness value (-255 to 255)
+} RaylibImagePipelineOp;
+
+// Image pipeline stage type, stages are applied in order to pixels (RGBA 32bit)
+typedef enum {
+    IMAGE_PIPELINE_STAGE_LUT = 0,   // Per channel lookup table, point operations collapsed
+    IMAGE_PIPELINE_STAGE_FORMAT,    // Quantize to format and expand back (grayscale formats, channels mixed)
+    IMAGE_PIPELINE_STAGE_REPLACE    // Replace color
+} ImagePipelineStageType;
+
+// Image pipeline stage
+typedef struct ImagePipelineStage {
+    int type;                       // Stage type (ImagePipelineStageType)
+    int format;                     // Quantization format (RaylibPixelFormat type)
+    RaylibColor color;              // Color to replace
+    RaylibColor replace;            // Replacement color
+    unsigned char lut[4][256];      // Channels lookup tables
+} ImagePipelineStage;
+
+// Image pipeline stages chain, point operations are accumulated into a lookup table until a stage can not be collapsed
+// NOTE: Lookup table is only valid for grayscale formats quantization when its input has equal RGB channels
+typedef struct ImagePipelineChain {
+    ImagePipelineStage *stages;     // Stages to apply
+    int stageCount;                 // Number of stages
+    RaylibColor lut[256];           // Accumulated lookup table, entry i maps channel value i (all channels)
+    bool lutUsed;                   // Accumulated lookup table is not identity
+    bool grayInput;                 // Accumulated lookup table input has equal RGB channels
+} ImagePipelineChain;
+
+// Image pipeline pixels processing job data
+typedef struct ImagePipelineJob {
+    const unsigned char *input;     // Input pixels (first pixel of view)
+    int inputStride;                // Input row size in bytes
+    int inputFormat;                // Input format (RaylibPixelFormat type)
+    unsigned char *output;          // Output pixels
+    int outputStride;               // Output row size in bytes
+    int outputFormat;               // Output format (RaylibPixelFormat type)
+    int width;                      // Row width
+    const ImagePipelineStage *stages;   // Stages to apply
+    int stageCount;                 // Number of stages
+} ImagePipelineJob;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if defined(RTEXTURES_THREADS_WIN32)
+static ImageThreadPool imagePool = { .requestedCount = -1 };      // NOTE: SRWLOCK and CONDITION_VARIABLE are zero initialized
+#elif defined(RTEXTURES_THREADS_PTHREAD)
+static ImageThreadPool imagePool = { .requestedCount = -1, .mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER };
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -265,6 +554,68 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static RaylibVector4 *LoadImageDataNormalized(RaylibImage image);       // Load pixel data from image as RaylibVector4 array (float normalized)
+static bool LoadTextureAtlasPage(RaylibTextureAtlas *atlas);      // Load a new texture atlas page, texture is cleared to transparent
+
+static void ImageParallelFor(int count, int minItems, ImageJobFunc func, void *data);   // Run image job over items range, split among pool threads
+static int GetImageThreadCount(void);                       // Get threads available to process an image job (including calling thread)
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+static void StartImageThreadPool(void);                     // Start image pool worker threads (pool must be locked)
+static void StopImageThreadPool(void);                      // Stop image pool worker threads and wait for them to finish
+#endif
+#if defined(RTEXTURES_THREADS_WIN32)
+static unsigned long __stdcall ImageWorkerThread(void *arg);    // Image pool worker thread entry point
+#elif defined(RTEXTURES_THREADS_PTHREAD)
+static void *ImageWorkerThread(void *arg);                  // Image pool worker thread entry point
+#endif
+
+static void ResizeImagePixels(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels);  // Resize 8bit per channel pixels, split among pool threads
+static void ResizeImageSplits(void *data, int start, int end);      // Resize image output splits, image parallel job function
+static void GenImageGradientLinearRows(void *data, int start, int end); // Generate linear gradient rows, image parallel job function
+static void GenImageGradientRadialRows(void *data, int start, int end); // Generate radial gradient rows, image parallel job function
+static void GenImageGradientSquareRows(void *data, int start, int end); // Generate square gradient rows, image parallel job function
+static void GenImageCheckedRows(void *data, int start, int end);        // Generate checked rows, image parallel job function
+static void GenImagePerlinNoiseRows(void *data, int start, int end);    // Generate perlin noise rows, image parallel job function
+static void GenImageCellularRows(void *data, int start, int end);       // Generate cellular rows, image parallel job function
+static void ImageColorTintPixels(void *data, int start, int end);       // Tint pixels, image parallel job function
+static void ImageColorInvertPixels(void *data, int start, int end);     // Invert pixels, image parallel job function
+static void ImageColorContrastPixels(void *data, int start, int end);   // Adjust pixels contrast, image parallel job function
+static void ImageColorBrightnessPixels(void *data, int start, int end); // Adjust pixels brightness, image parallel job function
+static void ImageColorReplacePixels(void *data, int start, int end);    // Replace pixels color, image parallel job function
+static void ImageAlphaPremultiplyPixels(void *data, int start, int end);     // Premultiply pixels alpha, image parallel job function
+static void ImageAlphaUnpremultiplyPixels(void *data, int start, int end);   // Reverse pixels alpha premultiply, image parallel job function
+static void ImageBlurRows(void *data, int start, int end);              // Blur rows (horizontal pass), image parallel job function
+static void ImageBlurColumns(void *data, int start, int end);           // Blur columns (vertical pass), image parallel job function
+static void BlurBoxLine(const unsigned char *input, unsigned char *output, int count, int stride, int blurSize, const unsigned int *inverse);  // Box blur pixels line (RGBA 32bit) using running sums
+static void BlurGaussianLine(const unsigned char *input, unsigned char *output, int count, int stride, const short *weights, int taps);     // Convolve edge padded pixels line (RGBA 32bit) with gaussian kernel
+static void ImageConvolutionRows(void *data, int start, int end);       // Convolve rows with kernel, image parallel job function
+static void ImageRotateRows(void *data, int start, int end);            // Rotate rows, image parallel job function
+static void ImageDitherRows(void *data, int start, int end);            // Dither rows in order, image parallel job function
+static void RecordImagePipelineOp(RaylibImagePipeline *pipeline, RaylibImagePipelineOp op);  // Record image pipeline operation, pipeline result size and format are updated
+static bool StepImagePipeline(const RaylibImagePipelineOp *op, int *width, int *height, int *format);    // Get image size and format after pipeline operation, returns true if operation can be fused
+static bool ClipImagePipelineCrop(RaylibRectangle *crop, int width, int height);    // Clip crop rectangle to image bounds same as RaylibImageCrop(), returns false if out of bounds
+static void FlushImagePipelineLut(ImagePipelineChain *chain);           // Add accumulated lookup table stage to pipeline chain (if used) and reset it
+static void QuantizeImagePipeline(ImagePipelineChain *chain, int format);   // Add format quantization to pipeline chain, collapsed into lookup table when possible
+static void ProcessImagePipelinePixels(const ImagePipelineJob *job, const unsigned char *input, unsigned char *output, int count);   // Process pixels through pipeline stages, tile by tile
+static void ImagePipelineRows(void *data, int start, int end);          // Process rows through pipeline stages, image parallel job function
+static const void *ImagePipelineResizeInput(void *output, const void *input, int count, int x, int y, void *context);    // Provide resize input pixels processed through pipeline stages, stbir input callback
+
+static void CompressImageBlocks(const unsigned char *pixels, int width, int height, unsigned char *output, int format, int quality);   // Compress image pixels (RGBA 32bit) into blocks
+static void CompressBlocksRows(void *data, int start, int end);                 // Compress image block rows, image parallel job function
+static void GetBlockBounds(const unsigned char *block, unsigned char *min, unsigned char *max);       // Get block per channel minimum and maximum values
+static void GetBlockDots(const unsigned char *block, int dr, int dg, int db, int *dots);            // Get block pixels dot products with an axis
+static unsigned short PackColor565(const int *color);                           // Pack color into R5G6B5 value
+static void GetBlockColorPalette(unsigned short c0, unsigned short c1, bool threeColor, int palette[4][3]);   // Get color block palette
+static unsigned int GetBlockColorIndices(const unsigned char *block, unsigned short c0, unsigned short c1, bool threeColor, int transparentMask);   // Get color block indices
+static int GetBlockColorError(const unsigned char *block, unsigned short c0, unsigned short c1, bool threeColor, unsigned int indices, int transparentMask);   // Get color block squared error
+static bool RefineBlockColor(const unsigned char *block, unsigned int indices, bool threeColor, int transparentMask, unsigned short *c0, unsigned short *c1);  // Refine color block endpoints
+static void CompressBlockColor(const unsigned char *block, unsigned char *output, int quality, bool alpha);     // Compress block color into BC1 block
+static int GetBlockChannelIndices(const unsigned char *values, int a0, int a1, unsigned long long *indices);    // Get single channel block indices
+static void CompressBlockChannel(const unsigned char *block, int channel, int minValue, int maxValue, unsigned char *output, int quality);   // Compress block channel into BC4 block
+
+static void ConvertPixels(const unsigned char *src, int srcFormat, unsigned char *dst, int dstFormat, int count);   // Convert pixels between 8bit per channel formats
+static void PackPixelsRGBA(const unsigned char *rgba, unsigned char *dst, int format, int count);     // Pack pixels (RGBA 32bit) into 8bit per channel format
+static void UnpackPixelsRGBA(const unsigned char *src, int format, unsigned char *rgba, int count);   // Unpack pixels from 8bit per channel format into RGBA 32bit
+static void BlendPixelsRGBA(const unsigned char *src, unsigned char *dst, int count, RaylibColor tint);    // Blend pixels (RGBA 32bit) over destination pixels (RGBA 32bit), tint applied to source
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -744,7 +1095,7 @@ bool RaylibExportImage(RaylibImage image, const char *fileName)
     else if (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    else if (!RaylibIsFileExtension(fileName, ".dds") && !RaylibIsFileExtension(fileName, ".ktx"))
     {
         // NOTE: Getting RaylibColor array as RGBA unsigned char values
         imgData = (unsigned char *)RaylibLoadImageColors(image);
@@ -792,6 +1143,23 @@ bool RaylibExportImage(RaylibImage image, const char *fileName)
         }
     }
 #endif
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_DDS)
+    else if (RaylibIsFileExtension(fileName, ".dds"))
+    {
+        // NOTE: Compressed and 8bit RGB/RGBA data is saved as is (including mipmaps), other formats are saved as RGBA
+        if ((image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+            (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            result = rl_save_dds(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+        }
+        else
+        {
+            RaylibColor *colors = RaylibLoadImageColors(image);
+            result = rl_save_dds(fileName, colors, image.width, image.height, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+            RaylibUnloadImageColors(colors);
+        }
+    }
+#endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (RaylibIsFileExtension(fileName, ".ktx"))
     {
@@ -931,27 +1299,17 @@ RaylibImage RaylibGenImageGradientLinear(int width, int height, int direction, R
     RaylibColor *pixels = (RaylibColor *)RL_MALLOC(width*height*sizeof(RaylibColor));
 
     float radianDirection = (float)(90 - direction)/180.f*3.14159f;
-    float cosDir = cosf(radianDirection);
-    float sinDir = sinf(radianDirection);
 
-    for (int i = 0; i < width; i++)
-    {
-        for (int j = 0; j < height; j++)
-        {
-            // Calculate the relative position of the pixel along the gradient direction
-            float pos = (i*cosDir + j*sinDir)/(width*cosDir + height*sinDir);
-
-            float factor = pos;
-            factor = (factor > 1.0f)? 1.0f : factor;  // RaylibClamp to [0,1]
-            factor = (factor < 0.0f)? 0.0f : factor;  // RaylibClamp to [0,1]
+    GenImageJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.col1 = start;
+    job.col2 = end;
+    job.cosDir = cosf(radianDirection);
+    job.sinDir = sinf(radianDirection);
 
-            // Generate the color for this pixel
-            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
-            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
-            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
-            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
-        }
-    }
+    ImageParallelFor(height, 16, GenImageGradientLinearRows, &job);
 
     RaylibImage image = {
         .data = pixels,
@@ -968,27 +1326,16 @@ RaylibImage RaylibGenImageGradientLinear(int width, int height, int direction, R
 RaylibImage RaylibGenImageGradientRadial(int width, int height, float density, RaylibColor inner, RaylibColor outer)
 {
     RaylibColor *pixels = (RaylibColor *)RL_MALLOC(width*height*sizeof(RaylibColor));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
-
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
 
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+    GenImageJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.col1 = inner;
+    job.col2 = outer;
+    job.density = density;
 
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    ImageParallelFor(height, 16, GenImageGradientRadialRows, &job);
 
     RaylibImage image = {
         .data = pixels,
@@ -1006,38 +1353,15 @@ RaylibImage RaylibGenImageGradientSquare(int width, int height, float density, R
 {
     RaylibColor *pixels = (RaylibColor *)RL_MALLOC(width*height*sizeof(RaylibColor));
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // RaylibNormalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX/centerX;
-            float normalizedDistY = distY/centerY;
-
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
-
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
-
-            // RaylibClamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+    GenImageJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.col1 = inner;
+    job.col2 = outer;
+    job.density = density;
 
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    ImageParallelFor(height, 16, GenImageGradientSquareRows, &job);
 
     RaylibImage image = {
         .data = pixels,
@@ -1055,14 +1379,16 @@ RaylibImage RaylibGenImageChecked(int width, int height, int checksX, int checks
 {
     RaylibColor *pixels = (RaylibColor *)RL_MALLOC(width*height*sizeof(RaylibColor));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
-        }
-    }
+    GenImageJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.col1 = col1;
+    job.col2 = col2;
+    job.checksX = checksX;
+    job.checksY = checksY;
+
+    ImageParallelFor(height, 16, GenImageCheckedRows, &job);
 
     RaylibImage image = {
         .data = pixels,
@@ -1103,34 +1429,15 @@ RaylibImage RaylibGenImagePerlinNoise(int width, int height, int offsetX, int of
 {
     RaylibColor *pixels = (RaylibColor *)RL_MALLOC(width*height*sizeof(RaylibColor));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
-
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // RaylibClamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    GenImageJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.offsetX = offsetX;
+    job.offsetY = offsetY;
+    job.scale = scale;
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (RaylibColor){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ImageParallelFor(height, 16, GenImagePerlinNoiseRows, &job);
 
     RaylibImage image = {
         .data = pixels,
@@ -1161,39 +1468,16 @@ RaylibImage RaylibGenImageCellular(int width, int height, int tileSize)
         seeds[i] = (RaylibVector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    RaylibVector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+    GenImageJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.tileSize = tileSize;
+    job.seedsPerRow = seedsPerRow;
+    job.seedsPerCol = seedsPerCol;
+    job.seeds = seeds;
 
-            pixels[y*width + x] = (RaylibColor){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ImageParallelFor(height, 16, GenImageCellularRows, &job);
 
     RL_FREE(seeds);
 
@@ -1231,6 +1515,33 @@ RaylibImage RaylibGenImageText(int width, int height, const char *text)
 //------------------------------------------------------------------------------------
 // RaylibImage manipulation functions
 //------------------------------------------------------------------------------------
+// Set worker threads used to process CPU image operations (resize, blur, convolution, rotate, dither, color adjustments, generation)
+// NOTE: 0 processes images serially on calling thread, -1 uses available processors (default),
+// results are the same for any threads count
+void RaylibSetImageThreadCount(int count)
+{
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+    if (count > (IMAGE_MAX_THREADS - 1)) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Image worker threads limited to %i", IMAGE_MAX_THREADS - 1);
+
+    StopImageThreadPool();
+
+    IMAGE_POOL_LOCK();
+    imagePool.requestedCount = (count < 0)? -1 : count;     // Threads are started on next image job
+    IMAGE_POOL_UNLOCK();
+#else
+    if (count != 0) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Image worker threads not supported on this platform");
+#endif
+}
+
+// Unload image worker threads, waiting for them to finish
+// NOTE: Required by RaylibCloseWindow(), threads are started again on next image job
+void UnloadImageThreadPool(void)
+{
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+    StopImageThreadPool();
+#endif
+}
+
 // Copy an image to a new image
 RaylibImage RaylibImageCopy(RaylibImage image)
 {
@@ -1349,7 +1660,32 @@ void RaylibImageFormat(RaylibImage *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
-        if ((image->format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        if ((image->format <= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (newFormat <= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            // Direct integer conversion between 8bit per channel formats
+            // NOTE: Only base level is converted, image data could come from RaylibLoadImageColors() (base level only)
+            // with mipmaps still set, mipmaps are regenerated at the end (same as float conversion path)
+            unsigned char *data = (unsigned char *)RL_MALLOC(RaylibGetPixelDataSize(image->width, image->height, newFormat));
+
+            if (data != NULL)
+            {
+                ConvertPixels((unsigned char *)image->data, image->format, data, newFormat, image->width*image->height);
+
+                RL_FREE(image->data);
+                image->data = data;
+                image->format = newFormat;
+
+                // In case original image had mipmaps, generate mipmaps for formatted image
+                if (image->mipmaps > 1)
+                {
+                    image->mipmaps = 1;
+                #if defined(RAYLIB_SUPPORT_IMAGE_MANIPULATION)
+                    RaylibImageMipmaps(image);
+                #endif
+                }
+            }
+        }
+        else if ((image->format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             RaylibVector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
@@ -1545,10 +1881,86 @@ void RaylibImageFormat(RaylibImage *image, int newFormat)
             #endif
             }
         }
+        else if ((image->format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+                 ((newFormat == RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (newFormat == RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                  (newFormat == RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA) || (newFormat == RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R) ||
+                  (newFormat == RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG)))
+        {
+            RaylibImageCompress(image, newFormat, RAYLIB_COMPRESSION_QUALITY_NORMAL);
+        }
         else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
 
+// Compress image data to GPU block compressed format
+// NOTE: Supported formats: DXT1 (BC1), DXT5 (BC3), BC4 and BC5, mipmap levels are compressed one by one
+void RaylibImageCompress(RaylibImage *image, int format, int quality)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Data format is compressed, can not be compressed again");
+        return;
+    }
+
+    if ((format != RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGBA) &&
+        (format != RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA) && (format != RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R) &&
+        (format != RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Compressed format not supported for image compression (%i)", format);
+        return;
+    }
+
+    if (quality < RAYLIB_COMPRESSION_QUALITY_FAST) quality = RAYLIB_COMPRESSION_QUALITY_FAST;
+    if (quality > RAYLIB_COMPRESSION_QUALITY_HIGH) quality = RAYLIB_COMPRESSION_QUALITY_HIGH;
+
+    int dataSize = 0;
+    int mipWidth = image->width;
+    int mipHeight = image->height;
+
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        dataSize += RaylibGetPixelDataSize(mipWidth, mipHeight, format);
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    unsigned char *source = (unsigned char *)image->data;
+    unsigned char *output = data;
+
+    mipWidth = image->width;
+    mipHeight = image->height;
+
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        // NOTE: Blocks are compressed from RGBA 32bit pixels, other formats are converted level by level
+        unsigned char *pixels = source;
+        if (image->format != RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (unsigned char *)RaylibLoadImageColors((RaylibImage){ source, mipWidth, mipHeight, 1, image->format });
+
+        CompressImageBlocks(pixels, mipWidth, mipHeight, output, format, quality);
+
+        if (pixels != source) RL_FREE(pixels);
+
+        source += RaylibGetPixelDataSize(mipWidth, mipHeight, image->format);
+        output += RaylibGetPixelDataSize(mipWidth, mipHeight, format);
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = format;
+}
+
 // Create an image from text (default font)
 RaylibImage RaylibImageText(const char *text, int fontSize, RaylibColor color)
 {
@@ -1688,14 +2100,8 @@ void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight)
         int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        // NOTE: Bytes per pixel match stbir_pixel_layout for 1 to 4 channels
+        ResizeImagePixels((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
@@ -1709,7 +2115,7 @@ void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight)
         RaylibColor *output = (RaylibColor *)RL_MALLOC(newWidth*newHeight*sizeof(RaylibColor));
 
         // NOTE: RaylibColor data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizeImagePixels((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -2014,146 +2420,104 @@ void RaylibImageAlphaPremultiply(RaylibImage *image)
 
 // Apply box blur to image
 void RaylibImageBlurGaussian(RaylibImage *image, int blurSize)
+{
+    RaylibImageBlurGaussianEx(image, blurSize, false);
+}
+
+// Apply gaussian blur to image, box blur approximation or true gaussian kernel
+// NOTE: Blur works on 8bit channels with integer sums, only one row/column scratch line is required per thread
+void RaylibImageBlurGaussianEx(RaylibImage *image, int blurSize, bool trueGaussian)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    RaylibImageAlphaPremultiply(image);
+    if (blurSize <= 0) return;
+    if (blurSize > 16383) blurSize = 16383;     // Keep window sums and inverses in 32bit range
 
-    RaylibColor *pixels = RaylibLoadImageColors(*image);
+    // Blur R8G8B8A8 images in-place, any other format is converted and converted back
+    int format = image->format;
+    unsigned char *pixels = NULL;
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    RaylibVector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibVector4));
-    RaylibVector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibVector4));
+    if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (unsigned char *)image->data;
+    else pixels = (unsigned char *)RaylibLoadImageColors(*image);
 
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    if (pixels == NULL) return;
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
-    {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+    ImageColorJob premultiply = { 0 };
+    premultiply.pixels = (RaylibColor *)pixels;
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
+    ImageBlurJob job = { 0 };
+    job.pixels = pixels;
+    job.width = image->width;
+    job.height = image->height;
+    job.blurSize = blurSize;
 
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
+    ImageParallelFor(image->width*image->height, 16384, ImageAlphaPremultiplyPixels, &premultiply);
 
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
+    if (trueGaussian)
+    {
+        // Gaussian variance matching the box blur approximation: iterations*((2*r + 1)^2 - 1)/12
+        float sigma = sqrtf((float)GAUSSIAN_BLUR_ITERATIONS*blurSize*(blurSize + 1)/3.0f);
+        int radius = (int)ceilf(3.0f*sigma);
+        int taps = 2*radius + 2;                // Padded to an even number of taps, last weight is 0
 
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
+        short *weights = (short *)RL_CALLOC(taps, sizeof(short));
+        float *kernel = (float *)RL_MALLOC((2*radius + 1)*sizeof(float));
+        float total = 0.0f;
+
+        for (int i = -radius; i <= radius; i++)
+        {
+            kernel[i + radius] = expf(-(float)(i*i)/(2.0f*sigma*sigma));
+            total += kernel[i + radius];
         }
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
+        // Quantize weights to 1.14 fixed point, rounding residual goes to center weight
+        int sum = 0;
+        for (int i = 0; i < 2*radius + 1; i++)
         {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+            weights[i] = (short)(kernel[i]*16384.0f/total + 0.5f);
+            sum += weights[i];
+        }
+        weights[radius] += (short)(16384 - sum);
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+        job.weights = weights;
+        job.radius = radius;
 
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+        ImageParallelFor(image->height, 16, ImageBlurRows, &job);       // Horizontal blur
+        ImageParallelFor(image->width, 16, ImageBlurColumns, &job);     // Vertical blur
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        RL_FREE(kernel);
+        RL_FREE(weights);
     }
-
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    else
     {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
+        unsigned int *inverse = (unsigned int *)RL_MALLOC((2*blurSize + 2)*sizeof(unsigned int));
+        inverse[0] = 0;
+        for (int i = 1; i < 2*blurSize + 2; i++) inverse[i] = (unsigned int)((0x80000000u + i - 1)/i);
+
+        job.inverse = inverse;
+
+        // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+        for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
         {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
+            ImageParallelFor(image->height, 16, ImageBlurRows, &job);       // Horizontal motion blur
+            ImageParallelFor(image->width, 16, ImageBlurColumns, &job);     // Vertical motion blur
         }
+
+        RL_FREE(inverse);
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    ImageParallelFor(image->width*image->height, 16384, ImageAlphaUnpremultiplyPixels, &premultiply);
 
-    image->data = pixels;
-    image->format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    if (format != RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        RL_FREE(image->data);
 
-    RaylibImageFormat(image, format);
+        image->data = pixels;
+        image->format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        RaylibImageFormat(image, format);
+    }
 }
 
 // The kernel matrix is assumed to be square. Only supply the width of the kernel
@@ -2172,21 +2536,6 @@ void RaylibImageKernelConvolution(RaylibImage *image, float* kernel, int kernelS
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
     RaylibVector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibVector4));
-    RaylibVector4 *temp = RL_MALLOC(kernelSize*sizeof(RaylibVector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
-
     int startRange = 0, endRange = 0;
 
     if (kernelWidth%2 == 0)
@@ -2200,70 +2549,17 @@ void RaylibImageKernelConvolution(RaylibImage *image, float* kernel, int kernelS
         endRange = kernelWidth/2 + 1;
     }
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+    ImageConvolutionJob job = { 0 };
+    job.pixels = pixels;
+    job.output = imageCopy2;
+    job.width = image->width;
+    job.height = image->height;
+    job.kernel = kernel;
+    job.kernelWidth = kernelWidth;
+    job.startRange = startRange;
+    job.endRange = endRange;
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
+    ImageParallelFor(image->height, 4, ImageConvolutionRows, &job);
 
     for (int i = 0; i < (image->width*image->height); i++)
     {
@@ -2278,7 +2574,6 @@ void RaylibImageKernelConvolution(RaylibImage *image, float* kernel, int kernelS
     int format = image->format;
     RL_FREE(image->data);
     RL_FREE(imageCopy2);
-    RL_FREE(temp);
 
     image->data = pixels;
     image->format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2397,71 +2692,25 @@ void RaylibImageDither(RaylibImage *image, int rBpp, int gBpp, int bBpp, int aBp
         // NOTE: We will store the dithered data as unsigned short (16bpp)
         image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        RaylibColor oldPixel = RAYLIB_WHITE;
-        RaylibColor newPixel = RAYLIB_WHITE;
-
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
-
         #define RAYLIB_MIN(a,b) (((a)<(b))?(a):(b))
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
-
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check RaylibImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
-
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
-
-                pixels[y*image->width + x] = newPixel;
-
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = RAYLIB_MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = RAYLIB_MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = RAYLIB_MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
-
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = RAYLIB_MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = RAYLIB_MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = RAYLIB_MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
-
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = RAYLIB_MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = RAYLIB_MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = RAYLIB_MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+        int *progress = (int *)RL_CALLOC(image->height, sizeof(int));
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = RAYLIB_MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = RAYLIB_MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = RAYLIB_MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+        ImageDitherJob job = { 0 };
+        job.pixels = pixels;
+        job.output = (unsigned short *)image->data;
+        job.width = image->width;
+        job.height = image->height;
+        job.rBpp = rBpp;
+        job.gBpp = gBpp;
+        job.bBpp = bBpp;
+        job.aBpp = aBpp;
+        job.progress = progress;
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+        // NOTE: Every thread processes rows until all are done, so one item per thread
+        ImageParallelFor(GetImageThreadCount(), 1, ImageDitherRows, &job);
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
+        RL_FREE(progress);
 
         RaylibUnloadImageColors(pixels);
     }
@@ -2556,37 +2805,18 @@ void RaylibImageRotate(RaylibImage *image, int degrees)
         int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
 
-        for (int y = 0; y < height; y++)
-        {
-            for (int x = 0; x < width; x++)
-            {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = RAYLIB_MIN(x1 + 1, image->width - 1);
-                    int y2 = RAYLIB_MIN(y1 + 1, image->height - 1);
-
-                    float px = oldX - x1;
-                    float py = oldY - y1;
-
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
-
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+        ImageRotateJob job = { 0 };
+        job.data = (unsigned char *)image->data;
+        job.output = rotatedData;
+        job.width = image->width;
+        job.height = image->height;
+        job.newWidth = width;
+        job.newHeight = height;
+        job.bytesPerPixel = bytesPerPixel;
+        job.sinRadius = sinRadius;
+        job.cosRadius = cosRadius;
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
-        }
+        ImageParallelFor(height, 8, ImageRotateRows, &job);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2667,18 +2897,11 @@ void RaylibImageColorTint(RaylibImage *image, RaylibColor color)
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+    ImageColorJob job = { 0 };
+    job.pixels = pixels;
+    job.color = color;
 
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
+    ImageParallelFor(image->width*image->height, 16384, ImageColorTintPixels, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2697,12 +2920,10 @@ void RaylibImageColorInvert(RaylibImage *image)
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
-    }
+    ImageColorJob job = { 0 };
+    job.pixels = pixels;
+
+    ImageParallelFor(image->width*image->height, 16384, ImageColorInvertPixels, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2734,36 +2955,11 @@ void RaylibImageColorContrast(RaylibImage *image, float contrast)
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
+    ImageColorJob job = { 0 };
+    job.pixels = pixels;
+    job.contrast = contrast;
 
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
-    }
+    ImageParallelFor(image->width*image->height, 16384, ImageColorContrastPixels, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2786,25 +2982,11 @@ void RaylibImageColorBrightness(RaylibImage *image, int brightness)
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
-
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+    ImageColorJob job = { 0 };
+    job.pixels = pixels;
+    job.brightness = brightness;
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
+    ImageParallelFor(image->width*image->height, 16384, ImageColorBrightnessPixels, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2823,19 +3005,12 @@ void RaylibImageColorReplace(RaylibImage *image, RaylibColor color, RaylibColor
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
-        {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
-        }
-    }
+    ImageColorJob job = { 0 };
+    job.pixels = pixels;
+    job.color = color;
+    job.replace = replace;
+
+    ImageParallelFor(image->width*image->height, 16384, ImageColorReplacePixels, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2845,64 +3020,375 @@ void RaylibImageColorReplace(RaylibImage *image, RaylibColor color, RaylibColor
 
     RaylibImageFormat(image, format);
 }
-#endif      // RAYLIB_SUPPORT_IMAGE_MANIPULATION
 
-// Load color data from image as a RaylibColor array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using RaylibUnloadImageColors();
-RaylibColor *RaylibLoadImageColors(RaylibImage image)
+// Load image pipeline, operations are recorded to be executed fused on RaylibLoadImageFromPipeline()
+// NOTE: Source image is not copied, it must be kept valid until pipeline is executed
+RaylibImagePipeline RaylibLoadImagePipeline(RaylibImage source)
 {
-    if ((image.width == 0) || (image.height == 0)) return NULL;
+    RaylibImagePipeline pipeline = { 0 };
 
-    RaylibColor *pixels = (RaylibColor *)RL_MALLOC(image.width*image.height*sizeof(RaylibColor));
+    pipeline.source = source;
+    pipeline.width = source.width;
+    pipeline.height = source.height;
+    pipeline.format = source.format;
 
-    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        if ((image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+    return pipeline;
+}
 
-        if ((image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
-            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+// Unload image pipeline recorded operations
+void RaylibUnloadImagePipeline(RaylibImagePipeline pipeline)
+{
+    RL_FREE(pipeline.ops);
+}
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+// Record image pipeline operation: crop
+void RaylibImagePipelineCrop(RaylibImagePipeline *pipeline, RaylibRectangle crop)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_CROP, .crop = crop };
+    RecordImagePipelineOp(pipeline, op);
+}
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+// Record image pipeline operation: resize
+void RaylibImagePipelineResize(RaylibImagePipeline *pipeline, int newWidth, int newHeight)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_RESIZE, .width = newWidth, .height = newHeight };
+    RecordImagePipelineOp(pipeline, op);
+}
 
-                    k += 2;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Record image pipeline operation: convert format
+void RaylibImagePipelineFormat(RaylibImagePipeline *pipeline, int newFormat)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_FORMAT, .format = newFormat };
+    RecordImagePipelineOp(pipeline, op);
+}
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+// Record image pipeline operation: color tint
+void RaylibImagePipelineColorTint(RaylibImagePipeline *pipeline, RaylibColor color)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_COLOR_TINT, .color = color };
+    RecordImagePipelineOp(pipeline, op);
+}
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Record image pipeline operation: color invert
+void RaylibImagePipelineColorInvert(RaylibImagePipeline *pipeline)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_COLOR_INVERT };
+    RecordImagePipelineOp(pipeline, op);
+}
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+// Record image pipeline operation: color grayscale
+void RaylibImagePipelineColorGrayscale(RaylibImagePipeline *pipeline)
+{
+    RaylibImagePipelineFormat(pipeline, RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+}
+
+// Record image pipeline operation: color contrast
+// NOTE: Contrast values between -100 and 100
+void RaylibImagePipelineColorContrast(RaylibImagePipeline *pipeline, float contrast)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_COLOR_CONTRAST, .contrast = contrast };
+    RecordImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: color brightness
+// NOTE: Brightness values between -255 and 255
+void RaylibImagePipelineColorBrightness(RaylibImagePipeline *pipeline, int brightness)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_COLOR_BRIGHTNESS, .brightness = brightness };
+    RecordImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: color replace
+void RaylibImagePipelineColorReplace(RaylibImagePipeline *pipeline, RaylibColor color, RaylibColor replace)
+{
+    RaylibImagePipelineOp op = { .type = IMAGE_PIPELINE_COLOR_REPLACE, .color = color, .replace = replace };
+    RecordImagePipelineOp(pipeline, op);
+}
+
+// Load image executing pipeline operations, result is the same as applying them one after another
+// NOTE: Crops are applied as views on input pixels and point operations (tint, invert, contrast, brightness, format)
+// are collapsed into per channel lookup tables, stages are applied tile by tile in a single pass to produce the result,
+// resize reads its input through the stages and its output becomes the input of next stages.
+// Pipelines not supported by fused execution (operations on 16bit packed or 32bit formats, compressed formats,
+// mipmaps, fractional crops) are executed one after another on an image copy
+RaylibImage RaylibLoadImageFromPipeline(RaylibImagePipeline pipeline)
+{
+    RaylibImage image = { 0 };
+    RaylibImage source = pipeline.source;
+
+    // Security check to avoid program crash
+    if ((source.data == NULL) || (source.width == 0) || (source.height == 0)) return image;
+
+    // Check if all recorded operations can be fused
+    bool fused = (source.mipmaps <= 1);
+    int width = source.width;
+    int height = source.height;
+    int format = source.format;
+
+    for (int i = 0; i < pipeline.opCount; i++)
+    {
+        if (!StepImagePipeline(&pipeline.ops[i], &width, &height, &format)) fused = false;
+    }
+
+    // Stages chain, every operation adds up to 3 stages, plus last lookup table
+    ImagePipelineChain chain = { 0 };
+    if (fused) chain.stages = (ImagePipelineStage *)RL_MALLOC((3*pipeline.opCount + 1)*sizeof(ImagePipelineStage));
+
+    if (chain.stages == NULL)
+    {
+        image = RaylibImageCopy(source);
+
+        for (int i = 0; i < pipeline.opCount; i++)
+        {
+            RaylibImagePipelineOp op = pipeline.ops[i];
+
+            switch (op.type)
+            {
+                case IMAGE_PIPELINE_CROP: RaylibImageCrop(&image, op.crop); break;
+                case IMAGE_PIPELINE_RESIZE: RaylibImageResize(&image, op.width, op.height); break;
+                case IMAGE_PIPELINE_FORMAT: RaylibImageFormat(&image, op.format); break;
+                case IMAGE_PIPELINE_COLOR_TINT: RaylibImageColorTint(&image, op.color); break;
+                case IMAGE_PIPELINE_COLOR_INVERT: RaylibImageColorInvert(&image); break;
+                case IMAGE_PIPELINE_COLOR_CONTRAST: RaylibImageColorContrast(&image, op.contrast); break;
+                case IMAGE_PIPELINE_COLOR_BRIGHTNESS: RaylibImageColorBrightness(&image, op.brightness); break;
+                case IMAGE_PIPELINE_COLOR_REPLACE: RaylibImageColorReplace(&image, op.color, op.replace); break;
+                default: break;
+            }
+        }
+
+        return image;
+    }
+
+    width = source.width;
+    height = source.height;
+    format = source.format;
+
+    for (int i = 0; i < 256; i++) chain.lut[i] = (RaylibColor){ (unsigned char)i, (unsigned char)i, (unsigned char)i, (unsigned char)i };
+    chain.grayInput = ((format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA));
+
+    // Input view, source pixels or last resize output
+    const unsigned char *input = (const unsigned char *)source.data;
+    int inputStride = RaylibGetPixelDataSize(width, 1, format);
+    int inputFormat = format;
+    unsigned char *resized = NULL;
+
+    for (int i = 0; i < pipeline.opCount; i++)
+    {
+        RaylibImagePipelineOp op = pipeline.ops[i];
+        ImageColorJob job = { .pixels = chain.lut };
+
+        switch (op.type)
+        {
+            case IMAGE_PIPELINE_CROP:
+            {
+                if (ClipImagePipelineCrop(&op.crop, width, height))
+                {
+                    input += (int)op.crop.y*inputStride + RaylibGetPixelDataSize((int)op.crop.x, 1, inputFormat);
+                    width = (int)op.crop.width;
+                    height = (int)op.crop.height;
+                }
+                else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
+            } break;
+            case IMAGE_PIPELINE_RESIZE:
+            {
+                FlushImagePipelineLut(&chain);
+
+                int bytesPerPixel = RaylibGetPixelDataSize(1, 1, format);
+
+                // Resize reads input pixels through stages using stbir input callback
+                // NOTE: Callback temporary buffer is only reliable with 4 channels layout in stbir, for other
+                // layouts stages are applied into an intermediate buffer before resize
+                if (((chain.stageCount > 0) || (inputFormat != format)) && (bytesPerPixel != 4))
+                {
+                    unsigned char *pixels = (unsigned char *)RL_MALLOC(width*height*bytesPerPixel);
+
+                    ImagePipelineJob job = { input, inputStride, inputFormat, pixels, width*bytesPerPixel, format, width, chain.stages, chain.stageCount };
+                    ImageParallelFor(height, 16, ImagePipelineRows, &job);
+
+                    RL_FREE(resized);
+                    resized = pixels;
+
+                    input = pixels;
+                    inputStride = width*bytesPerPixel;
+                    inputFormat = format;
+                    chain.stageCount = 0;
+                }
+
+                unsigned char *output = (unsigned char *)RL_MALLOC(op.width*op.height*bytesPerPixel);
+
+                ImagePipelineJob resizeJob = { input, inputStride, inputFormat, NULL, 0, format, width, chain.stages, chain.stageCount };
+
+                // NOTE: Bytes per pixel match stbir_pixel_layout for 1 to 4 channels
+                STBIR_RESIZE resize = { 0 };
+                stbir_resize_init(&resize, input, width, height, inputStride, output, op.width, op.height, 0, (stbir_pixel_layout)bytesPerPixel, STBIR_TYPE_UINT8);
+
+                if ((chain.stageCount > 0) || (inputFormat != format))
+                {
+                    stbir_set_pixel_callbacks(&resize, ImagePipelineResizeInput, NULL);
+                    stbir_set_user_data(&resize, &resizeJob);
+                }
+
+                int splits = stbir_build_samplers_with_splits(&resize, GetImageThreadCount());
+
+                if (splits > 0)
+                {
+                    ImageParallelFor(splits, 1, ResizeImageSplits, &resize);
+                    stbir_free_samplers(&resize);
+                }
+                else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to resize image data");
+
+                RL_FREE(resized);
+                resized = output;
+
+                input = output;
+                inputStride = op.width*bytesPerPixel;
+                inputFormat = format;
+                width = op.width;
+                height = op.height;
+
+                chain.stageCount = 0;
+                chain.grayInput = ((format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA));
+            } break;
+            case IMAGE_PIPELINE_FORMAT:
+            {
+                if ((op.format != 0) && (op.format != format))
+                {
+                    format = op.format;
+                    QuantizeImagePipeline(&chain, format);
+                }
+            } break;
+            case IMAGE_PIPELINE_COLOR_TINT:
+            {
+                job.color = op.color;
+                ImageColorTintPixels(&job, 0, 256);
+
+                chain.lutUsed = true;
+                QuantizeImagePipeline(&chain, format);
+            } break;
+            case IMAGE_PIPELINE_COLOR_INVERT:
+            {
+                ImageColorInvertPixels(&job, 0, 256);
+
+                chain.lutUsed = true;
+                QuantizeImagePipeline(&chain, format);
+            } break;
+            case IMAGE_PIPELINE_COLOR_CONTRAST:
+            {
+                if (op.contrast < -100) op.contrast = -100;
+                if (op.contrast > 100) op.contrast = 100;
+
+                job.contrast = (100.0f + op.contrast)/100.0f;
+                job.contrast *= job.contrast;
+                ImageColorContrastPixels(&job, 0, 256);
+
+                chain.lutUsed = true;
+                QuantizeImagePipeline(&chain, format);
+            } break;
+            case IMAGE_PIPELINE_COLOR_BRIGHTNESS:
+            {
+                job.brightness = op.brightness;
+                if (job.brightness < -255) job.brightness = -255;
+                if (job.brightness > 255) job.brightness = 255;
+                ImageColorBrightnessPixels(&job, 0, 256);
+
+                chain.lutUsed = true;
+                QuantizeImagePipeline(&chain, format);
+            } break;
+            case IMAGE_PIPELINE_COLOR_REPLACE:
+            {
+                // Replace compares all channels at once, it can not be collapsed into lookup table
+                FlushImagePipelineLut(&chain);
+
+                ImagePipelineStage *stage = &chain.stages[chain.stageCount++];
+                stage->type = IMAGE_PIPELINE_STAGE_REPLACE;
+                stage->color = op.color;
+                stage->replace = op.replace;
+
+                chain.grayInput = false;
+                QuantizeImagePipeline(&chain, format);
+            } break;
+            default: break;
+        }
+    }
+
+    FlushImagePipelineLut(&chain);
+
+    image.data = RL_MALLOC(RaylibGetPixelDataSize(width, height, format));
+
+    if (image.data != NULL)
+    {
+        ImagePipelineJob job = { input, inputStride, inputFormat, (unsigned char *)image.data, RaylibGetPixelDataSize(width, 1, format), format, width, chain.stages, chain.stageCount };
+        ImageParallelFor(height, 16, ImagePipelineRows, &job);
+
+        image.width = width;
+        image.height = height;
+        image.mipmaps = 1;
+        image.format = format;
+    }
+
+    RL_FREE(resized);
+    RL_FREE(chain.stages);
+
+    return image;
+}
+#endif      // RAYLIB_SUPPORT_IMAGE_MANIPULATION
+
+// Load color data from image as a RaylibColor array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using RaylibUnloadImageColors();
+RaylibColor *RaylibLoadImageColors(RaylibImage image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+
+    RaylibColor *pixels = (RaylibColor *)RL_MALLOC(image.width*image.height*sizeof(RaylibColor));
+
+    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        if ((image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+            (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
+
+                } break;
+                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                    k += 2;
+                } break;
+                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+                } break;
+                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
                     pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
                     pixels[i].a = 255;
 
@@ -3691,6 +4177,7 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] RaylibGetPixelColor(): Get RaylibVector4 instead of RaylibColor, easier for RaylibColorAlphaBlend()
+        //    [x] Consider fast path: blend 8bit per channel formats line by line, SIMD for R8G8B8A8/R8G8B8 destination
         //    [ ] Support f32bit channels drawing
 
         // TODO: Support RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
@@ -3710,6 +4197,18 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
+        // Fast path: Blend whole lines if source is 8bit per channel format and destination is R8G8B8A8/R8G8B8,
+        // other formats are unpacked into RGBA 32bit lines (and packed back for destination)
+        // NOTE: R5G5B5A1 source is left to per pixel path to keep RaylibGetPixelColor() blue channel results
+        bool blendLines = blendRequired && ((int)srcRec.width > 0) && (srcPtr->format <= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+            (srcPtr->format != RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) &&
+            ((dst->format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (dst->format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8));
+        unsigned char *srcLine = NULL;
+        unsigned char *dstLine = NULL;
+
+        if (blendLines && (srcPtr->format != RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) srcLine = (unsigned char *)RL_MALLOC((int)srcRec.width*4);
+        if (blendLines && (dst->format != RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) dstLine = (unsigned char *)RL_MALLOC((int)srcRec.width*4);
+
         for (int y = 0; y < (int)srcRec.height; y++)
         {
             unsigned char *pSrc = pSrcBase;
@@ -3717,6 +4216,15 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else if (blendLines)
+            {
+                if (srcLine != NULL) UnpackPixelsRGBA(pSrc, srcPtr->format, srcLine, (int)srcRec.width);
+                if (dstLine != NULL) UnpackPixelsRGBA(pDst, dst->format, dstLine, (int)srcRec.width);
+
+                BlendPixelsRGBA((srcLine != NULL)? srcLine : pSrc, (dstLine != NULL)? dstLine : pDst, (int)srcRec.width, tint);
+
+                if (dstLine != NULL) PackPixelsRGBA(dstLine, pDst, dst->format, (int)srcRec.width);
+            }
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -3739,6 +4247,9 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
             pDstBase += strideDst;
         }
 
+        RL_FREE(srcLine);
+        RL_FREE(dstLine);
+
         if (useSrcMod) RaylibUnloadImage(srcMod);     // Unload source modified image
     }
 }
@@ -4018,87 +4529,316 @@ void RaylibUpdateTextureRec(Texture2D texture, RaylibRectangle rec, const void *
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
-//------------------------------------------------------------------------------------
-// RaylibTexture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void RaylibGenTextureMipmaps(Texture2D *texture)
+// Load texture for streaming updates
+// NOTE: Texture data is uploaded through a ring of pixel unpack buffers (slots), uploads overlap GPU work
+// and pixel data can be written directly into mapped buffers with RaylibBeginTextureStreamUpdate()
+RaylibTextureStream RaylibLoadTextureStream(int width, int height, int format, int slots)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+    RaylibTextureStream stream = { 0 };
+
+    if (format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: Texture stream requires an uncompressed pixel format");
+        return stream;
+    }
+
+    stream.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+
+    if (stream.texture.id > 0)
+    {
+        stream.texture.width = width;
+        stream.texture.height = height;
+        stream.texture.format = format;
+        stream.texture.mipmaps = 1;
+
+        stream.stream = rlLoadTextureStream(stream.texture.id, width, height, format, slots);
+    }
+
+    return stream;
 }
 
-// Set texture scaling filter mode
-void RaylibSetTextureFilter(Texture2D texture, int filter)
+// Check if a texture stream is ready
+bool RaylibIsTextureStreamReady(RaylibTextureStream stream)
 {
-    switch (filter)
-    {
-        case RAYLIB_TEXTURE_FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+    return (RaylibIsTextureReady(stream.texture) && (stream.stream != NULL));
+}
 
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case RAYLIB_TEXTURE_FILTER_BILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+// Unload texture stream and its texture from GPU memory (VRAM)
+void RaylibUnloadTextureStream(RaylibTextureStream stream)
+{
+    rlUnloadTextureStream(stream.stream);
+    RaylibUnloadTexture(stream.texture);
+}
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case RAYLIB_TEXTURE_FILTER_TRILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+// Begin texture stream update, returns pointer to write full texture pixel data
+// NOTE: Pointer is only valid until RaylibEndTextureStreamUpdate(), data must match stream.texture.format
+void *RaylibBeginTextureStreamUpdate(RaylibTextureStream stream)
+{
+    return rlBeginTextureStreamUpdate(stream.stream);
+}
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+// End texture stream update, upload written pixel data to texture (asynchronous)
+void RaylibEndTextureStreamUpdate(RaylibTextureStream stream)
+{
+    rlEndTextureStreamUpdate(stream.stream);
+}
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case RAYLIB_TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case RAYLIB_TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case RAYLIB_TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+// Update texture stream with new data
+// NOTE: pixels data must match stream.texture.format, it is copied to next pixel unpack buffer
+void RaylibUpdateTextureStream(RaylibTextureStream stream, const void *pixels)
+{
+    void *data = rlBeginTextureStreamUpdate(stream.stream);
+
+    if (data != NULL)
+    {
+        memcpy(data, pixels, RaylibGetPixelDataSize(stream.texture.width, stream.texture.height, stream.texture.format));
+        rlEndTextureStreamUpdate(stream.stream);
     }
 }
 
-// Set texture wrapping mode
-void RaylibSetTextureWrap(Texture2D texture, int wrap)
+// Load texture atlas
+// NOTE: Pages are loaded on demand when images are added, padding is kept around every packed image
+// (left/top page borders included) to avoid texture filtering bleeding between images
+RaylibTextureAtlas RaylibLoadTextureAtlas(int pageWidth, int pageHeight, int padding)
 {
-    switch (wrap)
+    RaylibTextureAtlas atlas = { 0 };
+
+    if ((padding < 0) || (pageWidth <= padding) || (pageHeight <= padding))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: Failed to load texture atlas, invalid page size (%ix%i) or padding (%i)", pageWidth, pageHeight, padding);
+        return atlas;
+    }
+
+    atlas.pageWidth = pageWidth;
+    atlas.pageHeight = pageHeight;
+    atlas.padding = padding;
+
+    return atlas;
+}
+
+// Check if a texture atlas is ready
+bool RaylibIsTextureAtlasReady(RaylibTextureAtlas atlas)
+{
+    return ((atlas.pageWidth > 0) && (atlas.pageHeight > 0));
+}
+
+// Unload texture atlas pages from GPU memory (VRAM)
+// NOTE: Regions returned by the atlas are no longer valid
+void RaylibUnloadTextureAtlas(RaylibTextureAtlas atlas)
+{
+    for (int i = 0; i < atlas.pageCount; i++)
+    {
+        RaylibUnloadTexture(atlas.pages[i]);
+        RL_FREE(atlas.pagesData[i]->nodes);
+        RL_FREE(atlas.pagesData[i]);
+    }
+
+    RL_FREE(atlas.pages);
+    RL_FREE(atlas.pagesData);
+}
+
+// Pack image into texture atlas, returns its region (empty on failure)
+// NOTE: Adding multiple images at once with RaylibAddTextureAtlasImages() packs them better
+RaylibTextureRegion RaylibAddTextureAtlasImage(RaylibTextureAtlas *atlas, RaylibImage image)
+{
+    RaylibTextureRegion region = { 0 };
+
+    RaylibAddTextureAtlasImages(atlas, &image, 1, &region);
+
+    return region;
+}
+
+// Pack multiple images into texture atlas, returns number of images packed
+// NOTE: Images are packed into loaded pages first, following pages are loaded while images remain,
+// regions are returned in images order, failed images (compressed or bigger than a page) get an empty region
+int RaylibAddTextureAtlasImages(RaylibTextureAtlas *atlas, const RaylibImage *images, int count, RaylibTextureRegion *regions)
+{
+    int packedCount = 0;
+
+    if ((atlas == NULL) || !RaylibIsTextureAtlasReady(*atlas) || (images == NULL) || (regions == NULL) || (count <= 0)) return packedCount;
+
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(count*sizeof(stbrp_rect));
+    int rectCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        regions[i] = (RaylibTextureRegion){ 0 };
+
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0)) continue;
+
+        if (images[i].format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: Texture atlas image %i can not be packed, compressed formats not supported", i);
+            continue;
+        }
+
+        // NOTE: Page packing area is reduced by padding (left/top) and packed rectangle includes padding (right/bottom)
+        if (((images[i].width + 2*atlas->padding) > atlas->pageWidth) || ((images[i].height + 2*atlas->padding) > atlas->pageHeight))
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: Texture atlas image %i can not be packed, size (%ix%i) bigger than page", i, images[i].width, images[i].height);
+            continue;
+        }
+
+        // Packed rectangle includes padding on right/bottom, page packing area is moved by padding on left/top
+        rects[rectCount].id = i;
+        rects[rectCount].w = images[i].width + atlas->padding;
+        rects[rectCount].h = images[i].height + atlas->padding;
+        rectCount++;
+    }
+
+    for (int page = 0; rectCount > 0; page++)
+    {
+        bool newPage = (page == atlas->pageCount);
+        if (newPage && !LoadTextureAtlasPage(atlas)) break;
+
+        RaylibAtlasPage *pageData = atlas->pagesData[page];
+        stbrp_pack_rects(&pageData->context, rects, rectCount);
+
+        // Upload packed images, remaining ones are kept for next page
+        int remainingCount = 0;
+
+        for (int r = 0; r < rectCount; r++)
+        {
+            if (rects[r].was_packed)
+            {
+                const RaylibImage *image = &images[rects[r].id];
+                RaylibRectangle source = { (float)(rects[r].x + atlas->padding), (float)(rects[r].y + atlas->padding), (float)image->width, (float)image->height };
+
+                if (image->format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) RaylibUpdateTextureRec(atlas->pages[page], source, image->data);
+                else
+                {
+                    RaylibColor *pixels = RaylibLoadImageColors(*image);
+                    RaylibUpdateTextureRec(atlas->pages[page], source, pixels);
+                    RaylibUnloadImageColors(pixels);
+                }
+
+                regions[rects[r].id].texture = atlas->pages[page];
+                regions[rects[r].id].source = source;
+
+                pageData->regionCount++;
+                pageData->usedArea += image->width*image->height;
+                packedCount++;
+            }
+            else rects[remainingCount++] = rects[r];
+        }
+
+        // Every image fits an empty page, packing nothing there means page packing failed,
+        // empty page is unloaded so following calls don't keep loading new pages
+        if (newPage && (remainingCount == rectCount))
+        {
+            atlas->pageCount--;
+            RaylibUnloadTexture(atlas->pages[atlas->pageCount]);
+            RL_FREE(pageData->nodes);
+            RL_FREE(pageData);
+            break;
+        }
+
+        rectCount = remainingCount;
+    }
+
+    RL_FREE(rects);
+
+    if (packedCount < count) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: Texture atlas packed %i of %i images", packedCount, count);
+
+    return packedCount;
+}
+
+// Get texture atlas page utilization stats
+RaylibTextureAtlasPageInfo RaylibGetTextureAtlasPageInfo(RaylibTextureAtlas atlas, int page)
+{
+    RaylibTextureAtlasPageInfo info = { 0 };
+
+    if ((page >= 0) && (page < atlas.pageCount))
+    {
+        info.regionCount = atlas.pagesData[page]->regionCount;
+        info.usedArea = atlas.pagesData[page]->usedArea;
+        info.utilization = (float)info.usedArea/((float)atlas.pageWidth*atlas.pageHeight);
+    }
+
+    return info;
+}
+
+//------------------------------------------------------------------------------------
+// RaylibTexture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void RaylibGenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set texture scaling filter mode
+void RaylibSetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case RAYLIB_TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case RAYLIB_TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case RAYLIB_TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case RAYLIB_TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case RAYLIB_TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case RAYLIB_TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void RaylibSetTextureWrap(Texture2D texture, int wrap)
+{
+    switch (wrap)
     {
         case RAYLIB_TEXTURE_WRAP_REPEAT:
         {
@@ -4211,34 +4951,27 @@ void RaylibDrawTexturePro(Texture2D texture, RaylibRectangle source, RaylibRecta
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
-
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+        // Texture coordinates for every corner
+        float left = source.x/width;
+        float right = (source.x + source.width)/width;
+        float top = source.y/height;
+        float bottom = (source.y + source.height)/height;
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+        if (flipX) { float temp = left; left = right; right = temp; }
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+        float z = rlGetCurrentDepth();  // Same depth rlVertex2f() uses
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
-
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+        // NOTE: Quad vertex order: top-left, bottom-left, bottom-right, top-right
+        rlQuad quad = {
+            .vertices = {
+                { { topLeft.x, topLeft.y, z }, { left, top }, { 0.0f, 0.0f, 1.0f }, { tint.r, tint.g, tint.b, tint.a } },
+                { { bottomLeft.x, bottomLeft.y, z }, { left, bottom }, { 0.0f, 0.0f, 1.0f }, { tint.r, tint.g, tint.b, tint.a } },
+                { { bottomRight.x, bottomRight.y, z }, { right, bottom }, { 0.0f, 0.0f, 1.0f }, { tint.r, tint.g, tint.b, tint.a } },
+                { { topRight.x, topRight.y, z }, { right, top }, { 0.0f, 0.0f, 1.0f }, { tint.r, tint.g, tint.b, tint.a } }
+            }
+        };
 
-        rlEnd();
-        rlSetTexture(0);
+        rlPushQuads(&quad, 1, texture.id);
 
         // NOTE: Vertex position can be transformed using matrices
         // but the process is way more costly than just calculating
@@ -5007,11 +5740,13 @@ int RaylibGetPixelDataSize(int width, int height, int format)
         case RAYLIB_PIXELFORMAT_COMPRESSED_ETC1_RGB:
         case RAYLIB_PIXELFORMAT_COMPRESSED_ETC2_RGB:
         case RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA:
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R: bpp = 4; break;
         case RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
         case RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
         case RAYLIB_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG: bpp = 8; break;
         case RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
         default: break;
     }
@@ -5019,11 +5754,17 @@ int RaylibGetPixelDataSize(int width, int height, int format)
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
     // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // data size is rounded up to full blocks (8 or 16 bytes per block)
+    if (((format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RAYLIB_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) ||
+        (format == RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R) || (format == RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*(16*bpp/8);
+    }
+    else if ((width < 4) && (height < 4))
     {
-        if ((format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RAYLIB_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        // PVRT textures smaller than a block, minimum dataSize is 16
+        if ((format == RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RAYLIB_PIXELFORMAT_COMPRESSED_PVRT_RGBA)) dataSize = 16;
     }
 
     return dataSize;
@@ -5199,4 +5940,2576 @@ static RaylibVector4 *LoadImageDataNormalized(RaylibImage image)
     return pixels;
 }
 
+// Load a new texture atlas page, texture is cleared to transparent
+static bool LoadTextureAtlasPage(RaylibTextureAtlas *atlas)
+{
+    int packWidth = atlas->pageWidth - atlas->padding;
+    int packHeight = atlas->pageHeight - atlas->padding;
+
+    void *pixels = RL_CALLOC(atlas->pageWidth*atlas->pageHeight, 4);
+    unsigned int id = rlLoadTexture(pixels, atlas->pageWidth, atlas->pageHeight, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    RL_FREE(pixels);
+
+    if (id == 0)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TEXTURE: Failed to load texture atlas page");
+        return false;
+    }
+
+    // NOTE: Page packing data is allocated separately, stbrp_context keeps pointers into itself
+    atlas->pages = (Texture2D *)RL_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(Texture2D));
+    atlas->pagesData = (RaylibAtlasPage **)RL_REALLOC(atlas->pagesData, (atlas->pageCount + 1)*sizeof(RaylibAtlasPage *));
+
+    RaylibAtlasPage *pageData = (RaylibAtlasPage *)RL_CALLOC(1, sizeof(RaylibAtlasPage));
+    pageData->nodes = (stbrp_node *)RL_MALLOC(packWidth*sizeof(stbrp_node));
+    stbrp_init_target(&pageData->context, packWidth, packHeight, pageData->nodes, packWidth);
+
+    atlas->pages[atlas->pageCount] = (Texture2D){ id, atlas->pageWidth, atlas->pageHeight, 1, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    atlas->pagesData[atlas->pageCount] = pageData;
+    atlas->pageCount++;
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "TEXTURE: [ID %i] Texture atlas page %i loaded successfully (%ix%i)", id, atlas->pageCount - 1, atlas->pageWidth, atlas->pageHeight);
+
+    return true;
+}
+
+// Run job function over [0, count) items, split in contiguous ranges among image pool threads
+// NOTE: Calling thread processes the first range, jobs requested while pool is busy (nested or
+// from other threads) are processed serially on their calling thread
+static void ImageParallelFor(int count, int minItems, ImageJobFunc func, void *data)
+{
+    if (count <= 0) return;
+    if (minItems < 1) minItems = 1;
+
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+    int rangeCount = 1;
+
+    IMAGE_POOL_LOCK();
+
+    if (!imagePool.busy)
+    {
+        if (!imagePool.ready) StartImageThreadPool();
+
+        rangeCount = imagePool.threadCount + 1;
+        if (rangeCount > count/minItems) rangeCount = count/minItems;
+
+        if (rangeCount > 1)
+        {
+            for (int i = 0; i < rangeCount; i++)
+            {
+                imagePool.ranges[i].func = func;
+                imagePool.ranges[i].data = data;
+                imagePool.ranges[i].start = (int)((long long)count*i/rangeCount);
+                imagePool.ranges[i].end = (int)((long long)count*(i + 1)/rangeCount);
+            }
+
+            imagePool.busy = true;
+            imagePool.rangeCount = rangeCount;
+            imagePool.pending = rangeCount - 1;
+            imagePool.generation++;
+            IMAGE_POOL_WAKE();
+        }
+    }
+
+    IMAGE_POOL_UNLOCK();
+
+    if (rangeCount > 1)
+    {
+        func(data, imagePool.ranges[0].start, imagePool.ranges[0].end);
+
+        IMAGE_POOL_LOCK();
+        while (imagePool.pending > 0) IMAGE_POOL_WAIT();
+        imagePool.busy = false;
+        IMAGE_POOL_WAKE();
+        IMAGE_POOL_UNLOCK();
+
+        return;
+    }
+#endif
+
+    func(data, 0, count);
+}
+
+// Get threads available to process an image job (including calling thread)
+// NOTE: Only a hint to split work, ImageParallelFor() could still process the job serially
+static int GetImageThreadCount(void)
+{
+    int threadCount = 1;
+
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+    IMAGE_POOL_LOCK();
+    if (!imagePool.busy)
+    {
+        if (!imagePool.ready) StartImageThreadPool();
+        threadCount = imagePool.threadCount + 1;
+    }
+    IMAGE_POOL_UNLOCK();
+#endif
+
+    return threadCount;
+}
+
+#if defined(RTEXTURES_THREADS_WIN32) || defined(RTEXTURES_THREADS_PTHREAD)
+// Start image pool worker threads
+// NOTE: Pool must be locked, on thread creation failure the pool works with the threads already created
+static void StartImageThreadPool(void)
+{
+    int threadCount = imagePool.requestedCount;
+
+    if (threadCount < 0)
+    {
+    #if defined(RTEXTURES_THREADS_WIN32)
+        threadCount = (int)GetActiveProcessorCount(0xffff) - 1;     // ALL_PROCESSOR_GROUPS
+    #else
+        threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    #endif
+    }
+
+    if (threadCount > (IMAGE_MAX_THREADS - 1)) threadCount = IMAGE_MAX_THREADS - 1;
+    if (threadCount < 0) threadCount = 0;
+
+    imagePool.threadCount = 0;
+
+    for (int i = 1; i <= threadCount; i++)
+    {
+        imagePool.seen[i] = imagePool.generation;
+
+    #if defined(RTEXTURES_THREADS_WIN32)
+        imagePool.threads[i] = CreateThread(NULL, 0, ImageWorkerThread, &imagePool.ranges[i], 0, NULL);
+        if (imagePool.threads[i] == NULL) break;
+    #else
+        if (pthread_create(&imagePool.threads[i], NULL, ImageWorkerThread, &imagePool.ranges[i]) != 0) break;
+    #endif
+
+        imagePool.threadCount++;
+    }
+
+    if (imagePool.threadCount < threadCount) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to create image worker threads, using %i of %i", imagePool.threadCount, threadCount);
+
+    imagePool.ready = true;
+}
+
+// Stop image pool worker threads and wait for them to finish
+// NOTE: Pool must not be locked, it's marked as busy meanwhile so new jobs are processed serially
+static void StopImageThreadPool(void)
+{
+    IMAGE_POOL_LOCK();
+    while (imagePool.busy) IMAGE_POOL_WAIT();
+    imagePool.busy = true;
+    imagePool.quit = true;
+    IMAGE_POOL_WAKE();
+    IMAGE_POOL_UNLOCK();
+
+    for (int i = 1; i <= imagePool.threadCount; i++)
+    {
+    #if defined(RTEXTURES_THREADS_WIN32)
+        WaitForSingleObject(imagePool.threads[i], 0xffffffff);    // INFINITE
+        CloseHandle(imagePool.threads[i]);
+    #else
+        pthread_join(imagePool.threads[i], NULL);
+    #endif
+    }
+
+    IMAGE_POOL_LOCK();
+    imagePool.threadCount = 0;
+    imagePool.ready = false;
+    imagePool.quit = false;
+    imagePool.busy = false;
+    IMAGE_POOL_WAKE();
+    IMAGE_POOL_UNLOCK();
+}
+
+// Image pool worker thread, waits for jobs and processes its range
+// NOTE: Thread argument is its range in the pool, range index is the worker index
+#if defined(RTEXTURES_THREADS_WIN32)
+static unsigned long __stdcall ImageWorkerThread(void *arg)
+#else
+static void *ImageWorkerThread(void *arg)
+#endif
+{
+    int index = (int)((ImageJobRange *)arg - imagePool.ranges);
+
+    IMAGE_POOL_LOCK();
+
+    while (true)
+    {
+        while (!imagePool.quit && (imagePool.seen[index] == imagePool.generation)) IMAGE_POOL_WAIT();
+        if (imagePool.quit) break;
+
+        imagePool.seen[index] = imagePool.generation;
+
+        if (index < imagePool.rangeCount)
+        {
+            ImageJobRange range = imagePool.ranges[index];
+
+            IMAGE_POOL_UNLOCK();
+            range.func(range.data, range.start, range.end);
+            IMAGE_POOL_LOCK();
+
+            imagePool.pending--;
+            if (imagePool.pending == 0) IMAGE_POOL_WAKE();
+        }
+    }
+
+    IMAGE_POOL_UNLOCK();
+
+#if defined(RTEXTURES_THREADS_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+#endif
+
+// Resize 8bit per channel pixels (1 to 4 channels), output is split among image pool threads
+// NOTE: Same filters as stbir_resize_uint8_linear(), every split computes its output rows same as a single pass
+static void ResizeImagePixels(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+
+    int splits = stbir_build_samplers_with_splits(&resize, GetImageThreadCount());
+
+    if (splits > 0)
+    {
+        ImageParallelFor(splits, 1, ResizeImageSplits, &resize);
+        stbir_free_samplers(&resize);
+    }
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to resize image data");
+}
+
+// Resize image output splits, image parallel job function
+static void ResizeImageSplits(void *data, int start, int end)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, start, end - start);
+}
+
+#if defined(RAYLIB_SUPPORT_IMAGE_GENERATION)
+// Generate linear gradient rows, image parallel job function
+static void GenImageGradientLinearRows(void *data, int start, int end)
+{
+    GenImageJob *job = (GenImageJob *)data;
+    RaylibColor *pixels = job->pixels;
+    int width = job->width;
+    int height = job->height;
+
+    for (int j = start; j < end; j++)
+    {
+        for (int i = 0; i < width; i++)
+        {
+            // Calculate the relative position of the pixel along the gradient direction
+            float pos = (i*job->cosDir + j*job->sinDir)/(width*job->cosDir + height*job->sinDir);
+
+            float factor = pos;
+            factor = (factor > 1.0f)? 1.0f : factor;  // RaylibClamp to [0,1]
+            factor = (factor < 0.0f)? 0.0f : factor;  // RaylibClamp to [0,1]
+
+            // Generate the color for this pixel
+            pixels[j*width + i].r = (int)((float)job->col2.r*factor + (float)job->col1.r*(1.0f - factor));
+            pixels[j*width + i].g = (int)((float)job->col2.g*factor + (float)job->col1.g*(1.0f - factor));
+            pixels[j*width + i].b = (int)((float)job->col2.b*factor + (float)job->col1.b*(1.0f - factor));
+            pixels[j*width + i].a = (int)((float)job->col2.a*factor + (float)job->col1.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate radial gradient rows, image parallel job function
+static void GenImageGradientRadialRows(void *data, int start, int end)
+{
+    GenImageJob *job = (GenImageJob *)data;
+    RaylibColor *pixels = job->pixels;
+    RaylibColor inner = job->col1;
+    RaylibColor outer = job->col2;
+    int width = job->width;
+    int height = job->height;
+    float density = job->density;
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float dist = hypotf((float)x - centerX, (float)y - centerY);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
+
+            factor = (float)fmax(factor, 0.0f);
+            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate square gradient rows, image parallel job function
+static void GenImageGradientSquareRows(void *data, int start, int end)
+{
+    GenImageJob *job = (GenImageJob *)data;
+    RaylibColor *pixels = job->pixels;
+    RaylibColor inner = job->col1;
+    RaylibColor outer = job->col2;
+    int width = job->width;
+    float density = job->density;
+
+    float centerX = (float)width/2.0f;
+    float centerY = (float)job->height/2.0f;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            // Calculate the Manhattan distance from the center
+            float distX = fabsf(x - centerX);
+            float distY = fabsf(y - centerY);
+
+            // RaylibNormalize the distances by the dimensions of the gradient rectangle
+            float normalizedDistX = distX/centerX;
+            float normalizedDistY = distY/centerY;
+
+            // Calculate the total normalized Manhattan distance
+            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
+
+            // Subtract the density from the manhattanDist, then divide by (1 - density)
+            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
+            float factor = (manhattanDist - density)/(1.0f - density);
+
+            // RaylibClamp the factor between 0 and 1
+            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+
+            // Blend the colors based on the calculated factor
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate checked rows, image parallel job function
+static void GenImageCheckedRows(void *data, int start, int end)
+{
+    GenImageJob *job = (GenImageJob *)data;
+    int width = job->width;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if ((x/job->checksX + y/job->checksY)%2 == 0) job->pixels[y*width + x] = job->col1;
+            else job->pixels[y*width + x] = job->col2;
+        }
+    }
+}
+
+// Generate perlin noise rows, image parallel job function
+static void GenImagePerlinNoiseRows(void *data, int start, int end)
+{
+    GenImageJob *job = (GenImageJob *)data;
+    RaylibColor *pixels = job->pixels;
+    int width = job->width;
+    int height = job->height;
+    int offsetX = job->offsetX;
+    int offsetY = job->offsetY;
+    float scale = job->scale;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float nx = (float)(x + offsetX)*(scale/(float)width);
+            float ny = (float)(y + offsetY)*(scale/(float)height);
+
+            // Basic perlin noise implementation (not used)
+            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+
+            // Calculate a better perlin noise using fbm (fractal brownian motion)
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+
+            // RaylibClamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            int intensity = (int)(np*255.0f);
+            pixels[y*width + x] = (RaylibColor){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Generate cellular rows, image parallel job function
+static void GenImageCellularRows(void *data, int start, int end)
+{
+    GenImageJob *job = (GenImageJob *)data;
+    RaylibColor *pixels = job->pixels;
+    RaylibVector2 *seeds = job->seeds;
+    int width = job->width;
+    int tileSize = job->tileSize;
+    int seedsPerRow = job->seedsPerRow;
+    int seedsPerCol = job->seedsPerCol;
+
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < width; x++)
+        {
+            int tileX = x/tileSize;
+
+            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+
+                    RaylibVector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+
+                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
+                    minDistance = (float)fmin(minDistance, dist);
+                }
+            }
+
+            // I made this up, but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            pixels[y*width + x] = (RaylibColor){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+#endif      // RAYLIB_SUPPORT_IMAGE_GENERATION
+
+#if defined(RAYLIB_SUPPORT_IMAGE_MANIPULATION)
+// Tint pixels, image parallel job function
+static void ImageColorTintPixels(void *data, int start, int end)
+{
+    ImageColorJob *job = (ImageColorJob *)data;
+    RaylibColor *pixels = job->pixels;
+    RaylibColor color = job->color;
+
+    for (int i = start; i < end; i++)
+    {
+        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
+        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
+        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
+        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+
+        pixels[i].r = r;
+        pixels[i].g = g;
+        pixels[i].b = b;
+        pixels[i].a = a;
+    }
+}
+
+// Invert pixels, image parallel job function
+static void ImageColorInvertPixels(void *data, int start, int end)
+{
+    RaylibColor *pixels = ((ImageColorJob *)data)->pixels;
+
+    for (int i = start; i < end; i++)
+    {
+        pixels[i].r = 255 - pixels[i].r;
+        pixels[i].g = 255 - pixels[i].g;
+        pixels[i].b = 255 - pixels[i].b;
+    }
+}
+
+// Adjust pixels contrast, image parallel job function
+static void ImageColorContrastPixels(void *data, int start, int end)
+{
+    ImageColorJob *job = (ImageColorJob *)data;
+    RaylibColor *pixels = job->pixels;
+    float contrast = job->contrast;
+
+    for (int i = start; i < end; i++)
+    {
+        float pR = (float)pixels[i].r/255.0f;
+        pR -= 0.5f;
+        pR *= contrast;
+        pR += 0.5f;
+        pR *= 255;
+        if (pR < 0) pR = 0;
+        if (pR > 255) pR = 255;
+
+        float pG = (float)pixels[i].g/255.0f;
+        pG -= 0.5f;
+        pG *= contrast;
+        pG += 0.5f;
+        pG *= 255;
+        if (pG < 0) pG = 0;
+        if (pG > 255) pG = 255;
+
+        float pB = (float)pixels[i].b/255.0f;
+        pB -= 0.5f;
+        pB *= contrast;
+        pB += 0.5f;
+        pB *= 255;
+        if (pB < 0) pB = 0;
+        if (pB > 255) pB = 255;
+
+        pixels[i].r = (unsigned char)pR;
+        pixels[i].g = (unsigned char)pG;
+        pixels[i].b = (unsigned char)pB;
+    }
+}
+
+// Adjust pixels brightness, image parallel job function
+static void ImageColorBrightnessPixels(void *data, int start, int end)
+{
+    ImageColorJob *job = (ImageColorJob *)data;
+    RaylibColor *pixels = job->pixels;
+    int brightness = job->brightness;
+
+    for (int i = start; i < end; i++)
+    {
+        int cR = pixels[i].r + brightness;
+        int cG = pixels[i].g + brightness;
+        int cB = pixels[i].b + brightness;
+
+        if (cR < 0) cR = 1;
+        if (cR > 255) cR = 255;
+
+        if (cG < 0) cG = 1;
+        if (cG > 255) cG = 255;
+
+        if (cB < 0) cB = 1;
+        if (cB > 255) cB = 255;
+
+        pixels[i].r = (unsigned char)cR;
+        pixels[i].g = (unsigned char)cG;
+        pixels[i].b = (unsigned char)cB;
+    }
+}
+
+// Replace pixels color, image parallel job function
+static void ImageColorReplacePixels(void *data, int start, int end)
+{
+    ImageColorJob *job = (ImageColorJob *)data;
+    RaylibColor *pixels = job->pixels;
+    RaylibColor color = job->color;
+    RaylibColor replace = job->replace;
+
+    for (int i = start; i < end; i++)
+    {
+        if ((pixels[i].r == color.r) &&
+            (pixels[i].g == color.g) &&
+            (pixels[i].b == color.b) &&
+            (pixels[i].a == color.a))
+        {
+            pixels[i].r = replace.r;
+            pixels[i].g = replace.g;
+            pixels[i].b = replace.b;
+            pixels[i].a = replace.a;
+        }
+    }
+}
+
+// Premultiply pixels alpha, image parallel job function
+static void ImageAlphaPremultiplyPixels(void *data, int start, int end)
+{
+    RaylibColor *pixels = ((ImageColorJob *)data)->pixels;
+
+    for (int i = start; i < end; i++)
+    {
+        int alpha = pixels[i].a;
+
+        pixels[i].r = (unsigned char)((pixels[i].r*alpha + 127)/255);
+        pixels[i].g = (unsigned char)((pixels[i].g*alpha + 127)/255);
+        pixels[i].b = (unsigned char)((pixels[i].b*alpha + 127)/255);
+    }
+}
+
+// Reverse pixels alpha premultiply, image parallel job function
+static void ImageAlphaUnpremultiplyPixels(void *data, int start, int end)
+{
+    RaylibColor *pixels = ((ImageColorJob *)data)->pixels;
+
+    for (int i = start; i < end; i++)
+    {
+        int alpha = pixels[i].a;
+
+        if (alpha == 0) pixels[i] = (RaylibColor){ 0, 0, 0, 0 };
+        else if (alpha < 255)
+        {
+            int r = (pixels[i].r*255 + alpha/2)/alpha;
+            int g = (pixels[i].g*255 + alpha/2)/alpha;
+            int b = (pixels[i].b*255 + alpha/2)/alpha;
+
+            pixels[i].r = (unsigned char)((r > 255)? 255 : r);
+            pixels[i].g = (unsigned char)((g > 255)? 255 : g);
+            pixels[i].b = (unsigned char)((b > 255)? 255 : b);
+        }
+    }
+}
+
+// Blur rows (horizontal pass), image parallel job function
+// NOTE: Every range uses its own scratch line, rows are blurred in-place
+static void ImageBlurRows(void *data, int start, int end)
+{
+    ImageBlurJob *job = (ImageBlurJob *)data;
+    int width = job->width;
+    int radius = job->radius;
+    int taps = 2*radius + 2;
+
+    unsigned char *line = (unsigned char *)RL_MALLOC((job->weights != NULL)? (width + taps - 1)*4 : width*4);
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = job->pixels + (size_t)y*width*4;
+
+        if (job->weights != NULL)
+        {
+            // Replicate edge pixels into line padding
+            for (int i = 0; i < radius; i++) memcpy(line + i*4, row, 4);
+            memcpy(line + radius*4, row, width*4);
+            for (int i = radius + width; i < width + taps - 1; i++) memcpy(line + i*4, row + (width - 1)*4, 4);
+
+            BlurGaussianLine(line, row, width, 4, job->weights, taps);
+        }
+        else
+        {
+            memcpy(line, row, width*4);
+            BlurBoxLine(line, row, width, 4, job->blurSize, job->inverse);
+        }
+    }
+
+    RL_FREE(line);
+}
+
+// Blur columns (vertical pass), image parallel job function
+// NOTE: Every range uses its own scratch line, columns are gathered and blurred in-place
+static void ImageBlurColumns(void *data, int start, int end)
+{
+    ImageBlurJob *job = (ImageBlurJob *)data;
+    int width = job->width;
+    int height = job->height;
+    int radius = job->radius;
+    int taps = 2*radius + 2;
+    int stride = width*4;
+
+    unsigned char *line = (unsigned char *)RL_MALLOC((job->weights != NULL)? (height + taps - 1)*4 : height*4);
+
+    for (int x = start; x < end; x++)
+    {
+        unsigned char *column = job->pixels + x*4;
+
+        if (job->weights != NULL)
+        {
+            // Replicate edge pixels into line padding
+            for (int i = 0; i < radius; i++) memcpy(line + i*4, column, 4);
+            for (int i = 0; i < height; i++) memcpy(line + (radius + i)*4, column + (size_t)i*stride, 4);
+            for (int i = radius + height; i < height + taps - 1; i++) memcpy(line + i*4, column + (size_t)(height - 1)*stride, 4);
+
+            BlurGaussianLine(line, column, height, stride, job->weights, taps);
+        }
+        else
+        {
+            for (int i = 0; i < height; i++) memcpy(line + i*4, column + (size_t)i*stride, 4);
+            BlurBoxLine(line, column, height, stride, job->blurSize, job->inverse);
+        }
+    }
+
+    RL_FREE(line);
+}
+
+// Box blur pixels line (RGBA 32bit) using running sums
+// NOTE: Window is clipped to line limits, sums are divided by window size: (sum*inverse[size] + 2^30) >> 31
+static void BlurBoxLine(const unsigned char *input, unsigned char *output, int count, int stride, int blurSize, const unsigned int *inverse)
+{
+    int last = (blurSize < count - 1)? blurSize : count - 1;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set_epi32(0, 1 << 30, 0, 1 << 30);
+    __m128i sum = zero;
+    int value = 0;
+
+    #define BLUR_LOAD_PIXEL(ptr) (memcpy(&value, (ptr), 4), _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(value), zero), zero))
+
+    for (int i = 0; i <= last; i++) sum = _mm_add_epi32(sum, BLUR_LOAD_PIXEL(input + i*4));
+
+    for (int x = 0; x < count; x++)
+    {
+        int first = (x > blurSize)? x - blurSize : 0;
+        last = (x + blurSize < count)? x + blurSize : count - 1;
+
+        // 32x32->64bit multiplies on even and odd channels, results fit low 32bit of every 64bit lane
+        __m128i inv = _mm_set1_epi32((int)inverse[last - first + 1]);
+        __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epu32(sum, inv), rounding), 31);
+        __m128i odd = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(sum, 32), inv), rounding), 31);
+        __m128i result = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+
+        result = _mm_packs_epi32(result, result);
+        result = _mm_packus_epi16(result, result);
+        value = _mm_cvtsi128_si32(result);
+        memcpy(output + (size_t)x*stride, &value, 4);
+
+        if (x + blurSize + 1 < count) sum = _mm_add_epi32(sum, BLUR_LOAD_PIXEL(input + (x + blurSize + 1)*4));
+        if (x - blurSize >= 0) sum = _mm_sub_epi32(sum, BLUR_LOAD_PIXEL(input + (x - blurSize)*4));
+    }
+
+    #undef BLUR_LOAD_PIXEL
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint32x4_t sum = vdupq_n_u32(0);
+    uint32_t value = 0;
+
+    #define BLUR_LOAD_PIXEL(ptr) (memcpy(&value, (ptr), 4), vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(value))))))
+
+    for (int i = 0; i <= last; i++) sum = vaddq_u32(sum, BLUR_LOAD_PIXEL(input + i*4));
+
+    for (int x = 0; x < count; x++)
+    {
+        int first = (x > blurSize)? x - blurSize : 0;
+        last = (x + blurSize < count)? x + blurSize : count - 1;
+
+        // 32x32->64bit multiplies, rounding narrowing shift adds 2^30
+        uint32_t inv = inverse[last - first + 1];
+        uint32x4_t result = vcombine_u32(vrshrn_n_u64(vmull_n_u32(vget_low_u32(sum), inv), 31),
+                                         vrshrn_n_u64(vmull_n_u32(vget_high_u32(sum), inv), 31));
+        uint16x4_t result16 = vmovn_u32(result);
+        uint8x8_t result8 = vmovn_u16(vcombine_u16(result16, result16));
+
+        value = vget_lane_u32(vreinterpret_u32_u8(result8), 0);
+        memcpy(output + (size_t)x*stride, &value, 4);
+
+        if (x + blurSize + 1 < count) sum = vaddq_u32(sum, BLUR_LOAD_PIXEL(input + (x + blurSize + 1)*4));
+        if (x - blurSize >= 0) sum = vsubq_u32(sum, BLUR_LOAD_PIXEL(input + (x - blurSize)*4));
+    }
+
+    #undef BLUR_LOAD_PIXEL
+#else
+    unsigned int sum[4] = { 0 };
+
+    for (int i = 0; i <= last; i++) for (int c = 0; c < 4; c++) sum[c] += input[i*4 + c];
+
+    for (int x = 0; x < count; x++)
+    {
+        int first = (x > blurSize)? x - blurSize : 0;
+        last = (x + blurSize < count)? x + blurSize : count - 1;
+
+        unsigned long long inv = inverse[last - first + 1];
+
+        for (int c = 0; c < 4; c++)
+        {
+            output[(size_t)x*stride + c] = (unsigned char)((sum[c]*inv + (1u << 30)) >> 31);
+
+            if (x + blurSize + 1 < count) sum[c] += input[(x + blurSize + 1)*4 + c];
+            if (x - blurSize >= 0) sum[c] -= input[(x - blurSize)*4 + c];
+        }
+    }
+#endif
+}
+
+// Convolve edge padded pixels line (RGBA 32bit) with gaussian kernel
+// NOTE: Input line contains count + taps - 1 pixels, weights are 1.14 fixed point
+static void BlurGaussianLine(const unsigned char *input, unsigned char *output, int count, int stride, const short *weights, int taps)
+{
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set1_epi32(1 << 13);
+    int value = 0;
+
+    for (int x = 0; x < count; x++)
+    {
+        const unsigned char *pixel = input + x*4;
+        __m128i sum = rounding;
+
+        // Two taps per multiply-add, both pixels channels interleaved as r0 r1 g0 g1 b0 b1 a0 a1
+        for (int k = 0; k < taps; k += 2)
+        {
+            __m128i pair = _mm_loadl_epi64((const __m128i *)(pixel + k*4));
+            pair = _mm_unpacklo_epi8(_mm_unpacklo_epi8(pair, _mm_srli_si128(pair, 4)), zero);
+
+            __m128i weight = _mm_set1_epi32((int)(((unsigned int)(unsigned short)weights[k + 1] << 16) | (unsigned short)weights[k]));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(pair, weight));
+        }
+
+        __m128i result = _mm_srai_epi32(sum, 14);
+        result = _mm_packs_epi32(result, result);
+        result = _mm_packus_epi16(result, result);
+        value = _mm_cvtsi128_si32(result);
+        memcpy(output + (size_t)x*stride, &value, 4);
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint32_t value = 0;
+
+    for (int x = 0; x < count; x++)
+    {
+        const unsigned char *pixel = input + x*4;
+        int32x4_t sum = vdupq_n_s32(1 << 13);
+
+        for (int k = 0; k < taps; k++)
+        {
+            memcpy(&value, pixel + k*4, 4);
+            int16x4_t channels = vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(value)))));
+            sum = vmlal_n_s16(sum, channels, weights[k]);
+        }
+
+        uint16x4_t result16 = vqmovun_s32(vshrq_n_s32(sum, 14));
+        uint8x8_t result8 = vqmovn_u16(vcombine_u16(result16, result16));
+
+        value = vget_lane_u32(vreinterpret_u32_u8(result8), 0);
+        memcpy(output + (size_t)x*stride, &value, 4);
+    }
+#else
+    for (int x = 0; x < count; x++)
+    {
+        const unsigned char *pixel = input + x*4;
+
+        for (int c = 0; c < 4; c++)
+        {
+            int sum = 1 << 13;
+            for (int k = 0; k < taps; k++) sum += pixel[k*4 + c]*weights[k];
+
+            sum >>= 14;
+            output[(size_t)x*stride + c] = (unsigned char)((sum > 255)? 255 : ((sum < 0)? 0 : sum));
+        }
+    }
+#endif
+}
+
+// Convolve rows with kernel, image parallel job function
+// NOTE: Every range uses its own kernel products buffer
+static void ImageConvolutionRows(void *data, int start, int end)
+{
+    ImageConvolutionJob *job = (ImageConvolutionJob *)data;
+    const RaylibColor *pixels = job->pixels;
+    const float *kernel = job->kernel;
+    RaylibVector4 *imageCopy2 = job->output;
+    int width = job->width;
+    int height = job->height;
+    int kernelWidth = job->kernelWidth;
+    int kernelSize = kernelWidth*kernelWidth;
+    int startRange = job->startRange;
+    int endRange = job->endRange;
+
+    RaylibVector4 *temp = RL_CALLOC(kernelSize, sizeof(RaylibVector4));
+
+    float rRes = 0.0f;
+    float gRes = 0.0f;
+    float bRes = 0.0f;
+    float aRes = 0.0f;
+
+    for (int x = start; x < end; x++)
+    {
+        for (int y = 0; y < width; y++)
+        {
+            for (int xk = startRange; xk < endRange; xk++)
+            {
+                for (int yk = startRange; yk < endRange; yk++)
+                {
+                    int xkabs = xk + kernelWidth/2;
+                    int ykabs = yk + kernelWidth/2;
+                    unsigned int imgindex = width*(x + xk) + (y + yk);
+
+                    if (imgindex >= (unsigned int)(width*height))
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
+                    }
+                    else
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                    }
+                }
+            }
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                rRes += temp[i].x;
+                gRes += temp[i].y;
+                bRes += temp[i].z;
+                aRes += temp[i].w;
+            }
+
+            if (rRes < 0.0f) rRes = 0.0f;
+            if (gRes < 0.0f) gRes = 0.0f;
+            if (bRes < 0.0f) bRes = 0.0f;
+
+            if (rRes > 1.0f) rRes = 1.0f;
+            if (gRes > 1.0f) gRes = 1.0f;
+            if (bRes > 1.0f) bRes = 1.0f;
+
+            imageCopy2[width*x + y].x = rRes;
+            imageCopy2[width*x + y].y = gRes;
+            imageCopy2[width*x + y].z = bRes;
+            imageCopy2[width*x + y].w = aRes;
+
+            rRes = 0.0f;
+            gRes = 0.0f;
+            bRes = 0.0f;
+            aRes = 0.0f;
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                temp[i].x = 0.0f;
+                temp[i].y = 0.0f;
+                temp[i].z = 0.0f;
+                temp[i].w = 0.0f;
+            }
+        }
+    }
+
+    RL_FREE(temp);
+}
+
+// Rotate rows, image parallel job function
+static void ImageRotateRows(void *data, int start, int end)
+{
+    ImageRotateJob *job = (ImageRotateJob *)data;
+    const unsigned char *imageData = job->data;
+    unsigned char *rotatedData = job->output;
+    int width = job->newWidth;
+    int height = job->newHeight;
+    int bytesPerPixel = job->bytesPerPixel;
+    float sinRadius = job->sinRadius;
+    float cosRadius = job->cosRadius;
+    int srcWidth = job->width;
+    int srcHeight = job->height;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + srcWidth/2.0f;
+            float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + srcHeight/2.0f;
+
+            if ((oldX >= 0) && (oldX < srcWidth) && (oldY >= 0) && (oldY < srcHeight))
+            {
+                int x1 = (int)floorf(oldX);
+                int y1 = (int)floorf(oldY);
+                int x2 = RAYLIB_MIN(x1 + 1, srcWidth - 1);
+                int y2 = RAYLIB_MIN(y1 + 1, srcHeight - 1);
+
+                float px = oldX - x1;
+                float py = oldY - y1;
+
+                for (int i = 0; i < bytesPerPixel; i++)
+                {
+                    float f1 = imageData[(y1*srcWidth + x1)*bytesPerPixel + i];
+                    float f2 = imageData[(y1*srcWidth + x2)*bytesPerPixel + i];
+                    float f3 = imageData[(y2*srcWidth + x1)*bytesPerPixel + i];
+                    float f4 = imageData[(y2*srcWidth + x2)*bytesPerPixel + i];
+
+                    float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+
+                    rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                }
+            }
+        }
+    }
+}
+
+// Dither rows in order, image parallel job function
+// NOTE: Rows are taken in order by every thread (provided range is not used), pixel x of a row is
+// processed once pixel x + 2 of previous row is done, so error is diffused in the same order as a serial pass
+static void ImageDitherRows(void *data, int start, int end)
+{
+    ImageDitherJob *job = (ImageDitherJob *)data;
+    RaylibColor *pixels = job->pixels;
+    unsigned short *output = job->output;
+    int *progress = job->progress;
+    int width = job->width;
+    int height = job->height;
+    int rBpp = job->rBpp;
+    int gBpp = job->gBpp;
+    int bBpp = job->bBpp;
+    int aBpp = job->aBpp;
+
+    RaylibColor oldPixel = RAYLIB_WHITE;
+    RaylibColor newPixel = RAYLIB_WHITE;
+
+    int rError, gError, bError;
+    unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+
+    int y = 0;
+    while ((y = IMAGE_ATOMIC_ADD(&job->nextRow, 1)) < height)
+    {
+        int ready = (y > 0)? 0 : width;     // Previous row pixels known to be processed
+
+        for (int x = 0; x < width; x++)
+        {
+            int required = RAYLIB_MIN(x + 3, width);
+
+            while (ready < required)
+            {
+                ready = IMAGE_ATOMIC_LOAD(&progress[y - 1]);
+                if (ready < required) IMAGE_THREAD_YIELD();
+            }
+
+            oldPixel = pixels[y*width + x];
+
+            // NOTE: New pixel obtained by bits truncate, it would be better to round values (check RaylibImageFormat())
+            newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+            newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+            newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+            newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+
+            // NOTE: Error must be computed between new and old pixel but using same number of bits!
+            // We want to know how much color precision we have lost...
+            rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+            gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+            bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+
+            pixels[y*width + x] = newPixel;
+
+            // NOTE: Some cases are out of the array and should be ignored
+            if (x < (width - 1))
+            {
+                pixels[y*width + x+1].r = RAYLIB_MIN((int)pixels[y*width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                pixels[y*width + x+1].g = RAYLIB_MIN((int)pixels[y*width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                pixels[y*width + x+1].b = RAYLIB_MIN((int)pixels[y*width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+            }
+
+            if ((x > 0) && (y < (height - 1)))
+            {
+                pixels[(y+1)*width + x-1].r = RAYLIB_MIN((int)pixels[(y+1)*width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                pixels[(y+1)*width + x-1].g = RAYLIB_MIN((int)pixels[(y+1)*width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                pixels[(y+1)*width + x-1].b = RAYLIB_MIN((int)pixels[(y+1)*width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+            }
+
+            if (y < (height - 1))
+            {
+                pixels[(y+1)*width + x].r = RAYLIB_MIN((int)pixels[(y+1)*width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                pixels[(y+1)*width + x].g = RAYLIB_MIN((int)pixels[(y+1)*width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                pixels[(y+1)*width + x].b = RAYLIB_MIN((int)pixels[(y+1)*width + x].b + (int)((float)bError*5.0f/16), 0xff);
+            }
+
+            if ((x < (width - 1)) && (y < (height - 1)))
+            {
+                pixels[(y+1)*width + x+1].r = RAYLIB_MIN((int)pixels[(y+1)*width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                pixels[(y+1)*width + x+1].g = RAYLIB_MIN((int)pixels[(y+1)*width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                pixels[(y+1)*width + x+1].b = RAYLIB_MIN((int)pixels[(y+1)*width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+            }
+
+            rPixel = (unsigned short)newPixel.r;
+            gPixel = (unsigned short)newPixel.g;
+            bPixel = (unsigned short)newPixel.b;
+            aPixel = (unsigned short)newPixel.a;
+
+            output[y*width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+            if ((x%32) == 31) IMAGE_ATOMIC_STORE(&progress[y], x + 1);
+        }
+
+        IMAGE_ATOMIC_STORE(&progress[y], width);
+    }
+}
+
+// Record image pipeline operation, pipeline result size and format are updated
+static void RecordImagePipelineOp(RaylibImagePipeline *pipeline, RaylibImagePipelineOp op)
+{
+    RaylibImagePipelineOp *ops = (RaylibImagePipelineOp *)RL_REALLOC(pipeline->ops, (pipeline->opCount + 1)*sizeof(RaylibImagePipelineOp));
+
+    if (ops == NULL)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to record pipeline operation");
+        return;
+    }
+
+    ops[pipeline->opCount] = op;
+    pipeline->ops = ops;
+    pipeline->opCount++;
+
+    StepImagePipeline(&op, &pipeline->width, &pipeline->height, &pipeline->format);
+}
+
+// Get image size and format after pipeline operation, same as image manipulation functions
+// NOTE: Fused operations require 8bit per channel formats (16bit packed formats only for conversions)
+// and whole pixel crop rectangles, returns false if operation must be applied on its own
+static bool StepImagePipeline(const RaylibImagePipelineOp *op, int *width, int *height, int *format)
+{
+    // Image manipulation functions do nothing on empty images
+    if ((*width == 0) || (*height == 0)) return false;
+
+    bool fused = ((*format >= RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (*format <= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    bool colors = ((*format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (*format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                   (*format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (*format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+
+    switch (op->type)
+    {
+        case IMAGE_PIPELINE_CROP:
+        {
+            RaylibRectangle crop = op->crop;
+
+            if (ClipImagePipelineCrop(&crop, *width, *height) && (*format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+            {
+                fused = fused && (crop.x == (int)crop.x) && (crop.y == (int)crop.y) &&
+                        (crop.width == (int)crop.width) && (crop.height == (int)crop.height) && (crop.width >= 1) && (crop.height >= 1);
+
+                *width = (int)crop.width;
+                *height = (int)crop.height;
+            }
+        } break;
+        case IMAGE_PIPELINE_RESIZE:
+        {
+            fused = fused && colors && (op->width > 0) && (op->height > 0);
+
+            *width = op->width;
+            *height = op->height;
+        } break;
+        case IMAGE_PIPELINE_FORMAT:
+        {
+            if ((op->format != 0) && (op->format != *format))
+            {
+                fused = fused && (op->format >= RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (op->format <= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+                if ((*format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+                    ((op->format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) ||
+                     (op->format == RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (op->format == RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                     (op->format == RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA) || (op->format == RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R) ||
+                     (op->format == RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG))) *format = op->format;
+            }
+        } break;
+        default: fused = fused && colors; break;    // Color operations
+    }
+
+    return fused;
+}
+
+// Clip crop rectangle to image bounds, same as RaylibImageCrop()
+// NOTE: Returns false if rectangle is out of bounds (crop is not applied)
+static bool ClipImagePipelineCrop(RaylibRectangle *crop, int width, int height)
+{
+    if (crop->x < 0) { crop->width += crop->x; crop->x = 0; }
+    if (crop->y < 0) { crop->height += crop->y; crop->y = 0; }
+    if ((crop->x + crop->width) > width) crop->width = width - crop->x;
+    if ((crop->y + crop->height) > height) crop->height = height - crop->y;
+
+    return ((crop->x <= width) && (crop->y <= height));
+}
+
+// Add accumulated lookup table stage to pipeline chain (if used) and reset it to identity
+static void FlushImagePipelineLut(ImagePipelineChain *chain)
+{
+    if (!chain->lutUsed) return;
+
+    ImagePipelineStage *stage = &chain->stages[chain->stageCount++];
+    stage->type = IMAGE_PIPELINE_STAGE_LUT;
+
+    for (int i = 0; i < 256; i++)
+    {
+        stage->lut[0][i] = chain->lut[i].r;
+        stage->lut[1][i] = chain->lut[i].g;
+        stage->lut[2][i] = chain->lut[i].b;
+        stage->lut[3][i] = chain->lut[i].a;
+
+        chain->lut[i] = (RaylibColor){ (unsigned char)i, (unsigned char)i, (unsigned char)i, (unsigned char)i };
+    }
+
+    chain->lutUsed = false;
+}
+
+// Add format quantization to pipeline chain, pixels are packed into format and unpacked back
+// NOTE: Channels are quantized independently so lookup table entries are quantized as pixels,
+// grayscale formats mix RGB channels, that only can be collapsed when lookup table input has equal RGB channels
+static void QuantizeImagePipeline(ImagePipelineChain *chain, int format)
+{
+    if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+
+    if (((format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)) && !chain->grayInput)
+    {
+        FlushImagePipelineLut(chain);
+
+        ImagePipelineStage *stage = &chain->stages[chain->stageCount++];
+        stage->type = IMAGE_PIPELINE_STAGE_FORMAT;
+        stage->format = format;
+
+        chain->grayInput = true;
+    }
+    else
+    {
+        unsigned char packed[256*4] = { 0 };
+
+        PackPixelsRGBA((unsigned char *)chain->lut, packed, format, 256);
+        UnpackPixelsRGBA(packed, format, (unsigned char *)chain->lut, 256);
+
+        chain->lutUsed = true;
+    }
+}
+
+// Process pixels through pipeline stages, converting from input format to output format
+// NOTE: Pixels are processed in tiles, every tile is unpacked to R8G8B8A8, goes through all stages and is packed again
+static void ProcessImagePipelinePixels(const ImagePipelineJob *job, const unsigned char *input, unsigned char *output, int count)
+{
+    unsigned char tile[IMAGE_PIPELINE_TILE_SIZE*4];
+    unsigned char quantized[IMAGE_PIPELINE_TILE_SIZE*4];
+    int inputPixelSize = RaylibGetPixelDataSize(1, 1, job->inputFormat);
+    int outputPixelSize = RaylibGetPixelDataSize(1, 1, job->outputFormat);
+
+    for (int i = 0; i < count; i += IMAGE_PIPELINE_TILE_SIZE)
+    {
+        int size = ((count - i) < IMAGE_PIPELINE_TILE_SIZE)? (count - i) : IMAGE_PIPELINE_TILE_SIZE;
+
+        UnpackPixelsRGBA(input + (size_t)i*inputPixelSize, job->inputFormat, tile, size);
+
+        for (int s = 0; s < job->stageCount; s++)
+        {
+            const ImagePipelineStage *stage = &job->stages[s];
+
+            switch (stage->type)
+            {
+                case IMAGE_PIPELINE_STAGE_LUT:
+                {
+                    for (int k = 0; k < size*4; k += 4)
+                    {
+                        tile[k] = stage->lut[0][tile[k]];
+                        tile[k + 1] = stage->lut[1][tile[k + 1]];
+                        tile[k + 2] = stage->lut[2][tile[k + 2]];
+                        tile[k + 3] = stage->lut[3][tile[k + 3]];
+                    }
+                } break;
+                case IMAGE_PIPELINE_STAGE_FORMAT:
+                {
+                    PackPixelsRGBA(tile, quantized, stage->format, size);
+                    UnpackPixelsRGBA(quantized, stage->format, tile, size);
+                } break;
+                case IMAGE_PIPELINE_STAGE_REPLACE:
+                {
+                    for (int k = 0; k < size*4; k += 4)
+                    {
+                        if ((tile[k] == stage->color.r) && (tile[k + 1] == stage->color.g) &&
+                            (tile[k + 2] == stage->color.b) && (tile[k + 3] == stage->color.a))
+                        {
+                            tile[k] = stage->replace.r;
+                            tile[k + 1] = stage->replace.g;
+                            tile[k + 2] = stage->replace.b;
+                            tile[k + 3] = stage->replace.a;
+                        }
+                    }
+                } break;
+                default: break;
+            }
+        }
+
+        PackPixelsRGBA(tile, output + (size_t)i*outputPixelSize, job->outputFormat, size);
+    }
+}
+
+// Process rows through pipeline stages, image parallel job function
+static void ImagePipelineRows(void *data, int start, int end)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)data;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *input = job->input + (size_t)y*job->inputStride;
+        unsigned char *output = job->output + (size_t)y*job->outputStride;
+
+        if ((job->stageCount == 0) && (job->inputFormat == job->outputFormat)) memcpy(output, input, job->outputStride);
+        else ProcessImagePipelinePixels(job, input, output, job->width);
+    }
+}
+
+// Provide resize input pixels processed through pipeline stages, stbir input callback
+// NOTE: Input points to row start, pixels are written to temporary buffer provided by stbir (resize layout)
+static const void *ImagePipelineResizeInput(void *output, const void *input, int count, int x, int y, void *context)
+{
+    const ImagePipelineJob *job = (const ImagePipelineJob *)context;
+
+    ProcessImagePipelinePixels(job, (const unsigned char *)input + RaylibGetPixelDataSize(x, 1, job->inputFormat), (unsigned char *)output, count);
+
+    return output;
+}
+#endif      // RAYLIB_SUPPORT_IMAGE_MANIPULATION
+
+// Compress image pixels (RGBA 32bit) into blocks, block rows are processed in parallel
+static void CompressImageBlocks(const unsigned char *pixels, int width, int height, unsigned char *output, int format, int quality)
+{
+    CompressBlocksJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.output = output;
+    job.format = format;
+    job.quality = quality;
+
+    ImageParallelFor((height + 3)/4, 16, CompressBlocksRows, &job);
+}
+
+// Compress image block rows in range [start, end), image parallel job function
+static void CompressBlocksRows(void *data, int start, int end)
+{
+    CompressBlocksJob *job = (CompressBlocksJob *)data;
+
+    int blocksX = (job->width + 3)/4;
+    int blockSize = ((job->format == RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) ||
+                     (job->format == RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                     (job->format == RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R))? 8 : 16;
+
+    unsigned char block[64] = { 0 };
+    unsigned char min[4] = { 0 };
+    unsigned char max[4] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            // Load block pixels, edge pixels are replicated on partial blocks
+            if (((bx*4 + 4) <= job->width) && ((by*4 + 4) <= job->height))
+            {
+                for (int y = 0; y < 4; y++) memcpy(block + y*16, job->pixels + ((by*4 + y)*job->width + bx*4)*4, 16);
+            }
+            else
+            {
+                for (int y = 0; y < 4; y++)
+                {
+                    int py = ((by*4 + y) < job->height)? (by*4 + y) : (job->height - 1);
+
+                    for (int x = 0; x < 4; x++)
+                    {
+                        int px = ((bx*4 + x) < job->width)? (bx*4 + x) : (job->width - 1);
+                        memcpy(block + (y*4 + x)*4, job->pixels + (py*job->width + px)*4, 4);
+                    }
+                }
+            }
+
+            unsigned char *output = job->output + ((size_t)by*blocksX + bx)*blockSize;
+
+            switch (job->format)
+            {
+                case RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB: CompressBlockColor(block, output, job->quality, false); break;
+                case RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGBA: CompressBlockColor(block, output, job->quality, true); break;
+                case RAYLIB_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    GetBlockBounds(block, min, max);
+                    CompressBlockChannel(block, 3, min[3], max[3], output, job->quality);
+                    CompressBlockColor(block, output + 8, job->quality, false);
+                } break;
+                case RAYLIB_PIXELFORMAT_COMPRESSED_BC4_R:
+                {
+                    GetBlockBounds(block, min, max);
+                    CompressBlockChannel(block, 0, min[0], max[0], output, job->quality);
+                } break;
+                case RAYLIB_PIXELFORMAT_COMPRESSED_BC5_RG:
+                {
+                    GetBlockBounds(block, min, max);
+                    CompressBlockChannel(block, 0, min[0], max[0], output, job->quality);
+                    CompressBlockChannel(block, 1, min[1], max[1], output + 8, job->quality);
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Get per channel minimum and maximum values of a 4x4 block (RGBA 32bit)
+static void GetBlockBounds(const unsigned char *block, unsigned char *min, unsigned char *max)
+{
+#if defined(RTEXTURES_SIMD_SSE2)
+    __m128i p0 = _mm_loadu_si128((const __m128i *)block);
+    __m128i p1 = _mm_loadu_si128((const __m128i *)(block + 16));
+    __m128i p2 = _mm_loadu_si128((const __m128i *)(block + 32));
+    __m128i p3 = _mm_loadu_si128((const __m128i *)(block + 48));
+
+    __m128i vmin = _mm_min_epu8(_mm_min_epu8(p0, p1), _mm_min_epu8(p2, p3));
+    __m128i vmax = _mm_max_epu8(_mm_max_epu8(p0, p1), _mm_max_epu8(p2, p3));
+
+    // Reduce 4 pixels to 1
+    vmin = _mm_min_epu8(vmin, _mm_srli_si128(vmin, 8));
+    vmin = _mm_min_epu8(vmin, _mm_srli_si128(vmin, 4));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 8));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 4));
+
+    int minValue = _mm_cvtsi128_si32(vmin);
+    int maxValue = _mm_cvtsi128_si32(vmax);
+    memcpy(min, &minValue, 4);
+    memcpy(max, &maxValue, 4);
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint8x16_t p0 = vld1q_u8(block);
+    uint8x16_t p1 = vld1q_u8(block + 16);
+    uint8x16_t p2 = vld1q_u8(block + 32);
+    uint8x16_t p3 = vld1q_u8(block + 48);
+
+    uint8x16_t vmin = vminq_u8(vminq_u8(p0, p1), vminq_u8(p2, p3));
+    uint8x16_t vmax = vmaxq_u8(vmaxq_u8(p0, p1), vmaxq_u8(p2, p3));
+
+    // Reduce 4 pixels to 1
+    uint8x8_t min8 = vmin_u8(vget_low_u8(vmin), vget_high_u8(vmin));
+    uint8x8_t max8 = vmax_u8(vget_low_u8(vmax), vget_high_u8(vmax));
+    min8 = vmin_u8(min8, vext_u8(min8, min8, 4));
+    max8 = vmax_u8(max8, vext_u8(max8, max8, 4));
+
+    unsigned char result[8] = { 0 };
+    vst1_u8(result, min8);
+    memcpy(min, result, 4);
+    vst1_u8(result, max8);
+    memcpy(max, result, 4);
+#else
+    memcpy(min, block, 4);
+    memcpy(max, block, 4);
+
+    for (int i = 4; i < 64; i++)
+    {
+        if (block[i] < min[i%4]) min[i%4] = block[i];
+        if (block[i] > max[i%4]) max[i%4] = block[i];
+    }
+#endif
+}
+
+// Get dot products of 4x4 block pixels color (RGB) with an integer axis
+// NOTE: Axis components must be in range [-255..255]
+static void GetBlockDots(const unsigned char *block, int dr, int dg, int db, int *dots)
+{
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i axis = _mm_setr_epi16((short)dr, (short)dg, (short)db, 0, (short)dr, (short)dg, (short)db, 0);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (int i = 0; i < 16; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(block + i*4));
+
+        // Two pixels per register: [r*dr + g*dg, b*db, r*dr + g*dg, b*db]
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(p, zero), axis);
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(p, zero), axis);
+        lo = _mm_add_epi32(lo, _mm_srli_epi64(lo, 32));
+        hi = _mm_add_epi32(hi, _mm_srli_epi64(hi, 32));
+
+        __m128i result = _mm_unpacklo_epi64(_mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 3, 2, 0)), _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 3, 2, 0)));
+        _mm_storeu_si128((__m128i *)(dots + i), result);
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    for (int i = 0; i < 16; i += 8)
+    {
+        uint8x8x4_t p = vld4_u8(block + i*4);     // Deinterleaved channels, 8 pixels
+
+        int16x8_t r = vreinterpretq_s16_u16(vmovl_u8(p.val[0]));
+        int16x8_t g = vreinterpretq_s16_u16(vmovl_u8(p.val[1]));
+        int16x8_t b = vreinterpretq_s16_u16(vmovl_u8(p.val[2]));
+
+        int32x4_t lo = vmull_n_s16(vget_low_s16(r), (int16_t)dr);
+        lo = vmlal_n_s16(lo, vget_low_s16(g), (int16_t)dg);
+        lo = vmlal_n_s16(lo, vget_low_s16(b), (int16_t)db);
+
+        int32x4_t hi = vmull_n_s16(vget_high_s16(r), (int16_t)dr);
+        hi = vmlal_n_s16(hi, vget_high_s16(g), (int16_t)dg);
+        hi = vmlal_n_s16(hi, vget_high_s16(b), (int16_t)db);
+
+        vst1q_s32(dots + i, lo);
+        vst1q_s32(dots + i + 4, hi);
+    }
+#else
+    for (int i = 0; i < 16; i++) dots[i] = block[i*4]*dr + block[i*4 + 1]*dg + block[i*4 + 2]*db;
+#endif
+}
+
+// Pack color (RGB) into R5G6B5 16bit value, components are rounded
+static unsigned short PackColor565(const int *color)
+{
+    int r = (color[0] < 0)? 0 : ((color[0] > 255)? 255 : color[0]);
+    int g = (color[1] < 0)? 0 : ((color[1] > 255)? 255 : color[1]);
+    int b = (color[2] < 0)? 0 : ((color[2] > 255)? 255 : color[2]);
+
+    return (unsigned short)((((r*31 + 127)/255) << 11) | (((g*63 + 127)/255) << 5) | ((b*31 + 127)/255));
+}
+
+// Get color block palette (RGB) from endpoints
+// NOTE: In three color mode, last palette entry is transparent black
+static void GetBlockColorPalette(unsigned short c0, unsigned short c1, bool threeColor, int palette[4][3])
+{
+    palette[0][0] = ((c0 >> 11) << 3) | (c0 >> 13);
+    palette[0][1] = (((c0 >> 5) & 0x3f) << 2) | (((c0 >> 5) & 0x3f) >> 4);
+    palette[0][2] = ((c0 & 0x1f) << 3) | ((c0 & 0x1f) >> 2);
+    palette[1][0] = ((c1 >> 11) << 3) | (c1 >> 13);
+    palette[1][1] = (((c1 >> 5) & 0x3f) << 2) | (((c1 >> 5) & 0x3f) >> 4);
+    palette[1][2] = ((c1 & 0x1f) << 3) | ((c1 & 0x1f) >> 2);
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (threeColor)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+            palette[3][c] = 0;
+        }
+        else
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+    }
+}
+
+// Get color block indices (2 bit per pixel) for endpoints
+// NOTE: Palette colors are aligned on endpoints axis, nearest color is selected by projection on that axis
+static unsigned int GetBlockColorIndices(const unsigned char *block, unsigned short c0, unsigned short c1, bool threeColor, int transparentMask)
+{
+    static const int indices4[4] = { 1, 3, 2, 0 };     // Position on axis (from c1 to c0) to four color mode index
+    static const int indices3[3] = { 1, 2, 0 };        // Position on axis (from c1 to c0) to three color mode index
+
+    int palette[4][3] = { 0 };
+    GetBlockColorPalette(c0, c1, threeColor, palette);
+
+    int dr = palette[0][0] - palette[1][0];
+    int dg = palette[0][1] - palette[1][1];
+    int db = palette[0][2] - palette[1][2];
+    int length = dr*dr + dg*dg + db*db;
+
+    unsigned int indices = 0;
+    int dots[16] = { 0 };
+
+    if (length > 0)
+    {
+        GetBlockDots(block, dr, dg, db, dots);
+
+        int base = palette[1][0]*dr + palette[1][1]*dg + palette[1][2]*db;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int position = dots[i] - base;
+            int index = 0;
+
+            if (threeColor) index = indices3[(4*position >= length) + (4*position >= 3*length)];
+            else index = indices4[(6*position >= length) + (6*position >= 3*length) + (6*position >= 5*length)];
+
+            indices |= (unsigned int)index << (2*i);
+        }
+    }
+
+    for (int i = 0; i < 16; i++) if (transparentMask & (1 << i)) indices |= (3u << (2*i));
+
+    return indices;
+}
+
+// Get color block squared error for endpoints and indices, transparent pixels are not considered
+static int GetBlockColorError(const unsigned char *block, unsigned short c0, unsigned short c1, bool threeColor, unsigned int indices, int transparentMask)
+{
+    int palette[4][3] = { 0 };
+    GetBlockColorPalette(c0, c1, threeColor, palette);
+
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparentMask & (1 << i)) continue;
+
+        const int *color = palette[(indices >> (2*i)) & 3];
+        int dr = block[i*4] - color[0];
+        int dg = block[i*4 + 1] - color[1];
+        int db = block[i*4 + 2] - color[2];
+
+        error += (dr*dr + dg*dg + db*db);
+    }
+
+    return error;
+}
+
+// Refine color block endpoints by least squares fitting to current indices
+static bool RefineBlockColor(const unsigned char *block, unsigned int indices, bool threeColor, int transparentMask, unsigned short *c0, unsigned short *c1)
+{
+    static const float weights4[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };   // Endpoint c0 weight per index, four color mode
+    static const float weights3[4] = { 1.0f, 0.0f, 0.5f, 0.0f };             // Endpoint c0 weight per index, three color mode
+
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    float ax[3] = { 0 };
+    float bx[3] = { 0 };
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparentMask & (1 << i)) continue;
+
+        int index = (indices >> (2*i)) & 3;
+        float a = threeColor? weights3[index] : weights4[index];
+        float b = 1.0f - a;
+
+        aa += a*a;
+        bb += b*b;
+        ab += a*b;
+
+        for (int c = 0; c < 3; c++)
+        {
+            ax[c] += a*block[i*4 + c];
+            bx[c] += b*block[i*4 + c];
+        }
+    }
+
+    float det = aa*bb - ab*ab;
+    if (fabsf(det) < 0.0001f) return false;     // All pixels use the same endpoint weight
+
+    int endpoint0[3] = { 0 };
+    int endpoint1[3] = { 0 };
+
+    for (int c = 0; c < 3; c++)
+    {
+        endpoint0[c] = (int)floorf((ax[c]*bb - bx[c]*ab)/det + 0.5f);
+        endpoint1[c] = (int)floorf((bx[c]*aa - ax[c]*ab)/det + 0.5f);
+    }
+
+    *c0 = PackColor565(endpoint0);
+    *c1 = PackColor565(endpoint1);
+
+    return true;
+}
+
+// Compress 4x4 block color data (RGBA 32bit) into BC1 block (8 bytes)
+// NOTE: Three color mode is used if alpha is requested and some pixel is transparent (alpha < 128)
+static void CompressBlockColor(const unsigned char *block, unsigned char *output, int quality, bool alpha)
+{
+    unsigned char pixels[64] = { 0 };
+    const unsigned char *source = block;
+    int transparentMask = 0;
+
+    if (alpha)
+    {
+        int opaque = -1;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (block[i*4 + 3] < 128) transparentMask |= (1 << i);
+            else if (opaque < 0) opaque = i;
+        }
+
+        if (transparentMask == 0xffff)
+        {
+            // Fully transparent block, three color mode (c0 <= c1) with all indices to 3
+            memset(output, 0, 4);
+            memset(output + 4, 0xff, 4);
+            return;
+        }
+        else if (transparentMask != 0)
+        {
+            // Transparent pixels are replaced by an opaque one, to avoid their influence on endpoints
+            memcpy(pixels, block, 64);
+            for (int i = 0; i < 16; i++) if (transparentMask & (1 << i)) memcpy(pixels + i*4, block + opaque*4, 4);
+            source = pixels;
+        }
+    }
+
+    bool threeColor = (transparentMask != 0);
+
+    unsigned char min[4] = { 0 };
+    unsigned char max[4] = { 0 };
+    GetBlockBounds(source, min, max);
+
+    // Bounding box diagonal is used as main axis, channel with biggest range is the reference:
+    // other channels are flipped when they are anti-correlated with it
+    int endpoint0[3] = { max[0], max[1], max[2] };
+    int endpoint1[3] = { min[0], min[1], min[2] };
+
+    int reference = 0;
+    for (int c = 1; c < 3; c++) if ((max[c] - min[c]) > (max[reference] - min[reference])) reference = c;
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (c == reference) continue;
+
+        int covariance = 0;
+        for (int i = 0; i < 16; i++) covariance += (2*source[i*4 + c] - min[c] - max[c])*(2*source[i*4 + reference] - min[reference] - max[reference]);
+
+        if (covariance < 0)
+        {
+            endpoint0[c] = min[c];
+            endpoint1[c] = max[c];
+        }
+    }
+
+    if (quality == RAYLIB_COMPRESSION_QUALITY_FAST)
+    {
+        // Inset bounding box to reduce error on box corners
+        for (int c = 0; c < 3; c++)
+        {
+            int inset = (endpoint0[c] - endpoint1[c])/16;
+            endpoint0[c] -= inset;
+            endpoint1[c] += inset;
+        }
+    }
+    else
+    {
+        // Principal axis by power iteration over colors covariance, starting from bounding box diagonal
+        float mean[3] = { 0 };
+        float covariance[6] = { 0 };    // rr, rg, rb, gg, gb, bb
+
+        for (int i = 0; i < 16; i++) for (int c = 0; c < 3; c++) mean[c] += source[i*4 + c];
+        for (int c = 0; c < 3; c++) mean[c] /= 16.0f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            float r = source[i*4] - mean[0];
+            float g = source[i*4 + 1] - mean[1];
+            float b = source[i*4 + 2] - mean[2];
+
+            covariance[0] += r*r;
+            covariance[1] += r*g;
+            covariance[2] += r*b;
+            covariance[3] += g*g;
+            covariance[4] += g*b;
+            covariance[5] += b*b;
+        }
+
+        float axis[3] = { (float)(endpoint0[0] - endpoint1[0]), (float)(endpoint0[1] - endpoint1[1]), (float)(endpoint0[2] - endpoint1[2]) };
+        float length = 0.0f;
+        int iterations = (quality == RAYLIB_COMPRESSION_QUALITY_HIGH)? 8 : 4;
+
+        for (int k = 0; k < iterations; k++)
+        {
+            float r = axis[0]*covariance[0] + axis[1]*covariance[1] + axis[2]*covariance[2];
+            float g = axis[0]*covariance[1] + axis[1]*covariance[3] + axis[2]*covariance[4];
+            float b = axis[0]*covariance[2] + axis[1]*covariance[4] + axis[2]*covariance[5];
+
+            length = fmaxf(fabsf(r), fmaxf(fabsf(g), fabsf(b)));
+            if (length < 0.0001f) break;
+
+            axis[0] = r/length;
+            axis[1] = g/length;
+            axis[2] = b/length;
+        }
+
+        if (length >= 0.0001f)
+        {
+            // Endpoints are the pixels with extreme projections on principal axis
+            int dots[16] = { 0 };
+            GetBlockDots(source, (int)(axis[0]*255.0f), (int)(axis[1]*255.0f), (int)(axis[2]*255.0f), dots);
+
+            int minIndex = 0;
+            int maxIndex = 0;
+
+            for (int i = 1; i < 16; i++)
+            {
+                if (dots[i] < dots[minIndex]) minIndex = i;
+                if (dots[i] > dots[maxIndex]) maxIndex = i;
+            }
+
+            for (int c = 0; c < 3; c++)
+            {
+                endpoint0[c] = source[maxIndex*4 + c];
+                endpoint1[c] = source[minIndex*4 + c];
+            }
+        }
+    }
+
+    unsigned short c0 = PackColor565(endpoint0);
+    unsigned short c1 = PackColor565(endpoint1);
+
+    // Four color mode requires c0 > c1, three color mode requires c0 <= c1
+    if (threeColor? (c0 > c1) : (c0 < c1)) { unsigned short temp = c0; c0 = c1; c1 = temp; }
+
+    unsigned int indices = GetBlockColorIndices(source, c0, c1, threeColor, transparentMask);
+
+    if (quality != RAYLIB_COMPRESSION_QUALITY_FAST)
+    {
+        int error = GetBlockColorError(source, c0, c1, threeColor, indices, transparentMask);
+        int iterations = (quality == RAYLIB_COMPRESSION_QUALITY_HIGH)? 4 : 1;
+
+        for (int k = 0; (k < iterations) && (error > 0); k++)
+        {
+            unsigned short refined0 = c0;
+            unsigned short refined1 = c1;
+
+            if (!RefineBlockColor(source, indices, threeColor, transparentMask, &refined0, &refined1)) break;
+            if (threeColor? (refined0 > refined1) : (refined0 < refined1)) { unsigned short temp = refined0; refined0 = refined1; refined1 = temp; }
+            if ((refined0 == c0) && (refined1 == c1)) break;
+
+            unsigned int refinedIndices = GetBlockColorIndices(source, refined0, refined1, threeColor, transparentMask);
+            int refinedError = GetBlockColorError(source, refined0, refined1, threeColor, refinedIndices, transparentMask);
+
+            if (refinedError >= error) break;
+
+            c0 = refined0;
+            c1 = refined1;
+            indices = refinedIndices;
+            error = refinedError;
+        }
+    }
+
+    // Write block: endpoints and indices, little endian
+    output[0] = (unsigned char)(c0 & 0xff);
+    output[1] = (unsigned char)(c0 >> 8);
+    output[2] = (unsigned char)(c1 & 0xff);
+    output[3] = (unsigned char)(c1 >> 8);
+    output[4] = (unsigned char)(indices & 0xff);
+    output[5] = (unsigned char)((indices >> 8) & 0xff);
+    output[6] = (unsigned char)((indices >> 16) & 0xff);
+    output[7] = (unsigned char)(indices >> 24);
+}
+
+// Get single channel block indices (3 bit per value) for endpoints, returns squared error
+// NOTE: Mode depends on endpoints order: a0 > a1, eight interpolated values; a0 <= a1, six values plus 0 and 255
+static int GetBlockChannelIndices(const unsigned char *values, int a0, int a1, unsigned long long *indices)
+{
+    int palette[8] = { a0, a1 };
+
+    if (a0 > a1)
+    {
+        for (int i = 2; i < 8; i++) palette[i] = ((8 - i)*a0 + (i - 1)*a1 + 3)/7;
+    }
+    else
+    {
+        for (int i = 2; i < 6; i++) palette[i] = ((6 - i)*a0 + (i - 1)*a1 + 2)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int bestIndex = 0;
+        int bestError = 256*256;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int diff = values[i] - palette[k];
+            if ((diff*diff) < bestError)
+            {
+                bestError = diff*diff;
+                bestIndex = k;
+            }
+        }
+
+        error += bestError;
+        *indices |= (unsigned long long)bestIndex << (3*i);
+    }
+
+    return error;
+}
+
+// Compress 4x4 block single channel data (RGBA 32bit, channel selected) into BC4 block (8 bytes)
+// NOTE: Used for BC4 and BC5 channels and BC3 alpha
+static void CompressBlockChannel(const unsigned char *block, int channel, int minValue, int maxValue, unsigned char *output, int quality)
+{
+    unsigned char values[16] = { 0 };
+    for (int i = 0; i < 16; i++) values[i] = block[i*4 + channel];
+
+    // Eight values mode, range endpoints
+    int a0 = maxValue;
+    int a1 = minValue;
+    unsigned long long indices = 0;
+    int error = GetBlockChannelIndices(values, a0, a1, &indices);
+
+    if ((quality != RAYLIB_COMPRESSION_QUALITY_FAST) && (error > 0))
+    {
+        // Six values mode, 0 and 255 are represented exactly and endpoints cover the inner values range
+        int low = 255;
+        int high = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((values[i] > 0) && (values[i] < 255))
+            {
+                if (values[i] < low) low = values[i];
+                if (values[i] > high) high = values[i];
+            }
+        }
+
+        if (low > high) low = high = 0;
+
+        unsigned long long indices6 = 0;
+        int error6 = GetBlockChannelIndices(values, low, high, &indices6);
+
+        if (error6 < error)
+        {
+            a0 = low;
+            a1 = high;
+            indices = indices6;
+            error = error6;
+        }
+
+        if (quality == RAYLIB_COMPRESSION_QUALITY_HIGH)
+        {
+            // Refine eight values mode endpoints by least squares fitting to current indices
+            static const float weights[8] = { 1.0f, 0.0f, 6.0f/7.0f, 5.0f/7.0f, 4.0f/7.0f, 3.0f/7.0f, 2.0f/7.0f, 1.0f/7.0f };
+
+            for (int k = 0; (k < 4) && (a0 > a1) && (error > 0); k++)
+            {
+                float aa = 0.0f, bb = 0.0f, ab = 0.0f, ax = 0.0f, bx = 0.0f;
+
+                for (int i = 0; i < 16; i++)
+                {
+                    float a = weights[(indices >> (3*i)) & 7];
+                    float b = 1.0f - a;
+
+                    aa += a*a;
+                    bb += b*b;
+                    ab += a*b;
+                    ax += a*values[i];
+                    bx += b*values[i];
+                }
+
+                float det = aa*bb - ab*ab;
+                if (fabsf(det) < 0.0001f) break;
+
+                int refined0 = (int)floorf((ax*bb - bx*ab)/det + 0.5f);
+                int refined1 = (int)floorf((bx*aa - ax*ab)/det + 0.5f);
+                refined0 = (refined0 < 0)? 0 : ((refined0 > 255)? 255 : refined0);
+                refined1 = (refined1 < 0)? 0 : ((refined1 > 255)? 255 : refined1);
+
+                if ((refined0 <= refined1) || ((refined0 == a0) && (refined1 == a1))) break;
+
+                unsigned long long refinedIndices = 0;
+                int refinedError = GetBlockChannelIndices(values, refined0, refined1, &refinedIndices);
+
+                if (refinedError >= error) break;
+
+                a0 = refined0;
+                a1 = refined1;
+                indices = refinedIndices;
+                error = refinedError;
+            }
+        }
+    }
+
+    // Write block: endpoints and 48 bit indices, little endian
+    output[0] = (unsigned char)a0;
+    output[1] = (unsigned char)a1;
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)((indices >> (8*i)) & 0xff);
+}
+
+#if defined(RTEXTURES_SIMD_SSE2)
+// Get grayscale value of 4 pixels (R8G8B8A8), one per 32bit lane
+static inline __m128i GetGrayscaleSSE2(__m128i pixels)
+{
+    // NOTE: Channels pairs [r, b] and [g, a] as 16bit values, weighted and added by _mm_madd_epi16()
+    __m128i rb = _mm_and_si128(pixels, _mm_set1_epi32(0x00ff00ff));
+    __m128i ga = _mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0x00ff00ff));
+    __m128i sum = _mm_add_epi32(_mm_madd_epi16(rb, _mm_set1_epi32(9798 | (3735 << 16))), _mm_madd_epi16(ga, _mm_set1_epi32(19235)));
+
+    return _mm_srli_epi32(sum, 15);
+}
+
+// Quantize 8bit channel values (one per 32bit or 16bit lane) to [0..max] range, rounded
+static inline __m128i QuantizeSSE2(__m128i value, int max)
+{
+    // NOTE: x/255 computed as (x + 1 + (x >> 8)) >> 8, exact for x < 65535
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(value, _mm_set1_epi16((short)max)), _mm_set1_epi16(127));
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+// Pack 4 pixels (R8G8B8A8) into 16bit packed format, one per 32bit lane
+static inline __m128i PackPixels16SSE2(__m128i pixels, int format)
+{
+    __m128i mask = _mm_set1_epi32(0xff);
+    __m128i r = _mm_and_si128(pixels, mask);
+    __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 8), mask);
+    __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 16), mask);
+    __m128i a = _mm_srli_epi32(pixels, 24);
+    __m128i result = _mm_setzero_si128();
+
+    if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+    {
+        result = _mm_or_si128(_mm_slli_epi32(QuantizeSSE2(r, 31), 11), _mm_or_si128(_mm_slli_epi32(QuantizeSSE2(g, 63), 5), QuantizeSSE2(b, 31)));
+    }
+    else if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+    {
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi32(a, _mm_set1_epi32(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), _mm_set1_epi32(1));
+        result = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(QuantizeSSE2(r, 31), 11), _mm_slli_epi32(QuantizeSSE2(g, 31), 6)), _mm_or_si128(_mm_slli_epi32(QuantizeSSE2(b, 31), 1), alpha));
+    }
+    else
+    {
+        result = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(QuantizeSSE2(r, 15), 12), _mm_slli_epi32(QuantizeSSE2(g, 15), 8)), _mm_or_si128(_mm_slli_epi32(QuantizeSSE2(b, 15), 4), QuantizeSSE2(a, 15)));
+    }
+
+    return result;
+}
+
+// Pack 16bit values from 32bit lanes of two registers into one register (8 values)
+static inline __m128i PackDwordsSSE2(__m128i v0, __m128i v1)
+{
+    // NOTE: Values are sign extended first, so signed saturation keeps their 16 bits untouched
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(v0, 16), 16), _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16));
+}
+
+// Expand channel values (16bit lanes) from [0..max] to [0..255] range, as value*255/max
+static inline __m128i ExpandChannelSSE2(__m128i value, int max)
+{
+    // NOTE: Division by 31 and 63 as multiply-high and shift, exact for value*255 range
+    __m128i x = _mm_mullo_epi16(value, _mm_set1_epi16(255));
+
+    if (max == 31) return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)8457)), 2);
+    else return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)16645)), 4);
+}
+#elif defined(RTEXTURES_SIMD_NEON)
+// Get grayscale value of 8 pixels (R8G8B8A8 deinterleaved)
+static inline uint8x8_t GetGrayscaleNEON(uint8x8x4_t pixels)
+{
+    uint16x8_t r = vmovl_u8(pixels.val[0]);
+    uint16x8_t g = vmovl_u8(pixels.val[1]);
+    uint16x8_t b = vmovl_u8(pixels.val[2]);
+
+    uint32x4_t lo = vmull_n_u16(vget_low_u16(r), 9798);
+    lo = vmlal_n_u16(lo, vget_low_u16(g), 19235);
+    lo = vmlal_n_u16(lo, vget_low_u16(b), 3735);
+
+    uint32x4_t hi = vmull_n_u16(vget_high_u16(r), 9798);
+    hi = vmlal_n_u16(hi, vget_high_u16(g), 19235);
+    hi = vmlal_n_u16(hi, vget_high_u16(b), 3735);
+
+    return vmovn_u16(vcombine_u16(vshrn_n_u32(lo, 15), vshrn_n_u32(hi, 15)));
+}
+
+// Quantize 8bit channel values to [0..max] range, rounded
+static inline uint16x8_t QuantizeNEON(uint8x8_t value, int max)
+{
+    // NOTE: x/255 computed as (x + 1 + (x >> 8)) >> 8, exact for x < 65535
+    uint16x8_t x = vaddq_u16(vmull_u8(value, vdup_n_u8((uint8_t)max)), vdupq_n_u16(127));
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+// Expand channel values (16bit lanes) from [0..max] to [0..255] range, as value*255/max
+static inline uint8x8_t ExpandChannelNEON(uint16x8_t value, int max)
+{
+    // NOTE: Division by 31 and 63 as multiply-high and shift, exact for value*255 range
+    uint16x8_t x = vmulq_n_u16(value, 255);
+    uint16_t factor = (max == 31)? 8457 : 16645;
+    uint16x8_t result = vcombine_u16(vshrn_n_u32(vmull_n_u16(vget_low_u16(x), factor), 16), vshrn_n_u32(vmull_n_u16(vget_high_u16(x), factor), 16));
+
+    if (max == 31) return vmovn_u16(vshrq_n_u16(result, 2));
+    else return vmovn_u16(vshrq_n_u16(result, 4));
+}
+#endif
+
+// Convert pixels data between 8bit per channel formats (including 16bit packed formats), integer arithmetic
+// NOTE: Only formats up to R8G8B8A8 are supported, conversions not involving R8G8B8A8 go through a small R8G8B8A8 buffer
+static void ConvertPixels(const unsigned char *src, int srcFormat, unsigned char *dst, int dstFormat, int count)
+{
+    if (srcFormat == dstFormat) memcpy(dst, src, RaylibGetPixelDataSize(count, 1, srcFormat));
+    else if (srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) PackPixelsRGBA(src, dst, dstFormat, count);
+    else if (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) UnpackPixelsRGBA(src, srcFormat, dst, count);
+    else
+    {
+        #define CONVERT_PIXELS_BUFFER_SIZE  512
+
+        unsigned char buffer[CONVERT_PIXELS_BUFFER_SIZE*4] = { 0 };
+        int srcPixelSize = RaylibGetPixelDataSize(1, 1, srcFormat);
+        int dstPixelSize = RaylibGetPixelDataSize(1, 1, dstFormat);
+
+        for (int i = 0; i < count; i += CONVERT_PIXELS_BUFFER_SIZE)
+        {
+            int size = ((count - i) < CONVERT_PIXELS_BUFFER_SIZE)? (count - i) : CONVERT_PIXELS_BUFFER_SIZE;
+
+            UnpackPixelsRGBA(src + (size_t)i*srcPixelSize, srcFormat, buffer, size);
+            PackPixelsRGBA(buffer, dst + (size_t)i*dstPixelSize, dstFormat, size);
+        }
+    }
+}
+
+// Pack R8G8B8A8 pixels into 8bit per channel or 16bit packed format
+// NOTE: Channels are quantized with rounding, grayscale uses integer luminance weights (0.299, 0.587, 0.114)
+static void PackPixelsRGBA(const unsigned char *rgba, unsigned char *dst, int format, int count)
+{
+    int i = 0;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i gray0 = GetGrayscaleSSE2(_mm_loadu_si128((const __m128i *)(rgba + i*4)));
+                __m128i gray1 = GetGrayscaleSSE2(_mm_loadu_si128((const __m128i *)(rgba + i*4 + 16)));
+                __m128i gray = _mm_packs_epi32(gray0, gray1);
+                _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(gray, gray));
+            }
+        #elif defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8x4_t pixels = vld4_u8(rgba + i*4);
+                vst1_u8(dst + i, GetGrayscaleNEON(pixels));
+            }
+        #endif
+            for (; i < count; i++) dst[i] = (unsigned char)((rgba[i*4]*9798 + rgba[i*4 + 1]*19235 + rgba[i*4 + 2]*3735) >> 15);
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i p0 = _mm_loadu_si128((const __m128i *)(rgba + i*4));
+                __m128i p1 = _mm_loadu_si128((const __m128i *)(rgba + i*4 + 16));
+                __m128i v0 = _mm_or_si128(GetGrayscaleSSE2(p0), _mm_slli_epi32(_mm_srli_epi32(p0, 24), 8));
+                __m128i v1 = _mm_or_si128(GetGrayscaleSSE2(p1), _mm_slli_epi32(_mm_srli_epi32(p1, 24), 8));
+                _mm_storeu_si128((__m128i *)(dst + i*2), PackDwordsSSE2(v0, v1));
+            }
+        #elif defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8x4_t pixels = vld4_u8(rgba + i*4);
+                uint8x8x2_t result = { { GetGrayscaleNEON(pixels), pixels.val[3] } };
+                vst2_u8(dst + i*2, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*2] = (unsigned char)((rgba[i*4]*9798 + rgba[i*4 + 1]*19235 + rgba[i*4 + 2]*3735) >> 15);
+                dst[i*2 + 1] = rgba[i*4 + 3];
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8x4_t pixels = vld4_u8(rgba + i*4);
+                uint8x8x3_t result = { { pixels.val[0], pixels.val[1], pixels.val[2] } };
+                vst3_u8(dst + i*3, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*3] = rgba[i*4];
+                dst[i*3 + 1] = rgba[i*4 + 1];
+                dst[i*3 + 2] = rgba[i*4 + 2];
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *dst16 = (unsigned short *)dst;
+
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i v0 = PackPixels16SSE2(_mm_loadu_si128((const __m128i *)(rgba + i*4)), format);
+                __m128i v1 = PackPixels16SSE2(_mm_loadu_si128((const __m128i *)(rgba + i*4 + 16)), format);
+                _mm_storeu_si128((__m128i *)(dst16 + i), PackDwordsSSE2(v0, v1));
+            }
+        #elif defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8x4_t pixels = vld4_u8(rgba + i*4);
+                uint16x8_t result = vdupq_n_u16(0);
+
+                if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    result = vorrq_u16(vshlq_n_u16(QuantizeNEON(pixels.val[0], 31), 11), vorrq_u16(vshlq_n_u16(QuantizeNEON(pixels.val[1], 63), 5), QuantizeNEON(pixels.val[2], 31)));
+                }
+                else if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    uint16x8_t alpha = vmovl_u8(vshr_n_u8(vcgt_u8(pixels.val[3], vdup_n_u8(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), 7));
+                    result = vorrq_u16(vorrq_u16(vshlq_n_u16(QuantizeNEON(pixels.val[0], 31), 11), vshlq_n_u16(QuantizeNEON(pixels.val[1], 31), 6)), vorrq_u16(vshlq_n_u16(QuantizeNEON(pixels.val[2], 31), 1), alpha));
+                }
+                else
+                {
+                    result = vorrq_u16(vorrq_u16(vshlq_n_u16(QuantizeNEON(pixels.val[0], 15), 12), vshlq_n_u16(QuantizeNEON(pixels.val[1], 15), 8)), vorrq_u16(vshlq_n_u16(QuantizeNEON(pixels.val[2], 15), 4), QuantizeNEON(pixels.val[3], 15)));
+                }
+
+                vst1q_u16(dst16 + i, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                const unsigned char *p = rgba + i*4;
+
+                if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    dst16[i] = (unsigned short)((((p[0]*31 + 127)/255) << 11) | (((p[1]*63 + 127)/255) << 5) | ((p[2]*31 + 127)/255));
+                }
+                else if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    dst16[i] = (unsigned short)((((p[0]*31 + 127)/255) << 11) | (((p[1]*31 + 127)/255) << 6) | (((p[2]*31 + 127)/255) << 1) | ((p[3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0));
+                }
+                else
+                {
+                    dst16[i] = (unsigned short)((((p[0]*15 + 127)/255) << 12) | (((p[1]*15 + 127)/255) << 8) | (((p[2]*15 + 127)/255) << 4) | ((p[3]*15 + 127)/255));
+                }
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, rgba, (size_t)count*4); break;
+        default: break;
+    }
+}
+
+// Unpack 8bit per channel or 16bit packed format pixels into R8G8B8A8
+// NOTE: Packed channels are expanded as value*255/max, same as RaylibGetPixelColor()
+static void UnpackPixelsRGBA(const unsigned char *src, int format, unsigned char *rgba, int count)
+{
+    int i = 0;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+        #if defined(RTEXTURES_SIMD_SSE2)
+            const __m128i opaque = _mm_set1_epi8((char)0xff);
+
+            for (; (i + 16) <= count; i += 16)
+            {
+                __m128i gray = _mm_loadu_si128((const __m128i *)(src + i));
+                __m128i gg0 = _mm_unpacklo_epi8(gray, gray);
+                __m128i gg1 = _mm_unpackhi_epi8(gray, gray);
+                __m128i ga0 = _mm_unpacklo_epi8(gray, opaque);
+                __m128i ga1 = _mm_unpackhi_epi8(gray, opaque);
+
+                _mm_storeu_si128((__m128i *)(rgba + i*4), _mm_unpacklo_epi16(gg0, ga0));
+                _mm_storeu_si128((__m128i *)(rgba + i*4 + 16), _mm_unpackhi_epi16(gg0, ga0));
+                _mm_storeu_si128((__m128i *)(rgba + i*4 + 32), _mm_unpacklo_epi16(gg1, ga1));
+                _mm_storeu_si128((__m128i *)(rgba + i*4 + 48), _mm_unpackhi_epi16(gg1, ga1));
+            }
+        #elif defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8_t gray = vld1_u8(src + i);
+                uint8x8x4_t result = { { gray, gray, gray, vdup_n_u8(255) } };
+                vst4_u8(rgba + i*4, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                rgba[i*4] = src[i];
+                rgba[i*4 + 1] = src[i];
+                rgba[i*4 + 2] = src[i];
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i ga = _mm_loadu_si128((const __m128i *)(src + i*2));
+                __m128i gray = _mm_and_si128(ga, _mm_set1_epi16(0xff));
+                __m128i gg = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+
+                _mm_storeu_si128((__m128i *)(rgba + i*4), _mm_unpacklo_epi16(gg, ga));
+                _mm_storeu_si128((__m128i *)(rgba + i*4 + 16), _mm_unpackhi_epi16(gg, ga));
+            }
+        #elif defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8x2_t ga = vld2_u8(src + i*2);
+                uint8x8x4_t result = { { ga.val[0], ga.val[0], ga.val[0], ga.val[1] } };
+                vst4_u8(rgba + i*4, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                rgba[i*4] = src[i*2];
+                rgba[i*4 + 1] = src[i*2];
+                rgba[i*4 + 2] = src[i*2];
+                rgba[i*4 + 3] = src[i*2 + 1];
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint8x8x3_t rgb = vld3_u8(src + i*3);
+                uint8x8x4_t result = { { rgb.val[0], rgb.val[1], rgb.val[2], vdup_n_u8(255) } };
+                vst4_u8(rgba + i*4, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                rgba[i*4] = src[i*3];
+                rgba[i*4 + 1] = src[i*3 + 1];
+                rgba[i*4 + 2] = src[i*3 + 2];
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            const unsigned short *src16 = (const unsigned short *)src;
+
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src16 + i));
+                __m128i r, g, b, a;
+
+                if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    r = ExpandChannelSSE2(_mm_srli_epi16(v, 11), 31);
+                    g = ExpandChannelSSE2(_mm_and_si128(_mm_srli_epi16(v, 5), _mm_set1_epi16(0x3f)), 63);
+                    b = ExpandChannelSSE2(_mm_and_si128(v, _mm_set1_epi16(0x1f)), 31);
+                    a = _mm_set1_epi16(0xff);
+                }
+                else if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    r = ExpandChannelSSE2(_mm_srli_epi16(v, 11), 31);
+                    g = ExpandChannelSSE2(_mm_and_si128(_mm_srli_epi16(v, 6), _mm_set1_epi16(0x1f)), 31);
+                    b = ExpandChannelSSE2(_mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi16(0x1f)), 31);
+                    a = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1)), _mm_set1_epi16(0xff));
+                }
+                else
+                {
+                    r = _mm_mullo_epi16(_mm_srli_epi16(v, 12), _mm_set1_epi16(17));
+                    g = _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0xf)), _mm_set1_epi16(17));
+                    b = _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi16(0xf)), _mm_set1_epi16(17));
+                    a = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi16(0xf)), _mm_set1_epi16(17));
+                }
+
+                __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+                __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+
+                _mm_storeu_si128((__m128i *)(rgba + i*4), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128((__m128i *)(rgba + i*4 + 16), _mm_unpackhi_epi16(rg, ba));
+            }
+        #elif defined(RTEXTURES_SIMD_NEON)
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint16x8_t v = vld1q_u16(src16 + i);
+                uint8x8x4_t result;
+
+                if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    result.val[0] = ExpandChannelNEON(vshrq_n_u16(v, 11), 31);
+                    result.val[1] = ExpandChannelNEON(vandq_u16(vshrq_n_u16(v, 5), vdupq_n_u16(0x3f)), 63);
+                    result.val[2] = ExpandChannelNEON(vandq_u16(v, vdupq_n_u16(0x1f)), 31);
+                    result.val[3] = vdup_n_u8(255);
+                }
+                else if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    result.val[0] = ExpandChannelNEON(vshrq_n_u16(v, 11), 31);
+                    result.val[1] = ExpandChannelNEON(vandq_u16(vshrq_n_u16(v, 6), vdupq_n_u16(0x1f)), 31);
+                    result.val[2] = ExpandChannelNEON(vandq_u16(vshrq_n_u16(v, 1), vdupq_n_u16(0x1f)), 31);
+                    result.val[3] = vmovn_u16(vmulq_n_u16(vandq_u16(v, vdupq_n_u16(0x1)), 255));
+                }
+                else
+                {
+                    result.val[0] = vmovn_u16(vmulq_n_u16(vshrq_n_u16(v, 12), 17));
+                    result.val[1] = vmovn_u16(vmulq_n_u16(vandq_u16(vshrq_n_u16(v, 8), vdupq_n_u16(0xf)), 17));
+                    result.val[2] = vmovn_u16(vmulq_n_u16(vandq_u16(vshrq_n_u16(v, 4), vdupq_n_u16(0xf)), 17));
+                    result.val[3] = vmovn_u16(vmulq_n_u16(vandq_u16(v, vdupq_n_u16(0xf)), 17));
+                }
+
+                vst4_u8(rgba + i*4, result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned short v = src16[i];
+
+                if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    rgba[i*4] = (unsigned char)((v >> 11)*255/31);
+                    rgba[i*4 + 1] = (unsigned char)(((v >> 5) & 0x3f)*255/63);
+                    rgba[i*4 + 2] = (unsigned char)((v & 0x1f)*255/31);
+                    rgba[i*4 + 3] = 255;
+                }
+                else if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    rgba[i*4] = (unsigned char)((v >> 11)*255/31);
+                    rgba[i*4 + 1] = (unsigned char)(((v >> 6) & 0x1f)*255/31);
+                    rgba[i*4 + 2] = (unsigned char)(((v >> 1) & 0x1f)*255/31);
+                    rgba[i*4 + 3] = (v & 0x1)? 255 : 0;
+                }
+                else
+                {
+                    rgba[i*4] = (unsigned char)((v >> 12)*17);
+                    rgba[i*4 + 1] = (unsigned char)(((v >> 8) & 0xf)*17);
+                    rgba[i*4 + 2] = (unsigned char)(((v >> 4) & 0xf)*17);
+                    rgba[i*4 + 3] = (unsigned char)((v & 0xf)*17);
+                }
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(rgba, src, (size_t)count*4); break;
+        default: break;
+    }
+}
+
+// Blend pixels (RGBA 32bit) over destination pixels (RGBA 32bit), tint applied to source
+// NOTE: Results are exactly the same as RaylibColorAlphaBlend() per pixel, per pixel integer division
+// (blend/outAlpha) >> 8 is computed in float and fixed up with integer remainder
+static void BlendPixelsRGBA(const unsigned char *src, unsigned char *dst, int count, RaylibColor tint)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const bool tinted = ((tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i full = _mm_set1_epi32(255);
+    const __m128i tintR = _mm_set1_epi32(tint.r + 1);
+    const __m128i tintG = _mm_set1_epi32(tint.g + 1);
+    const __m128i tintB = _mm_set1_epi32(tint.b + 1);
+    const __m128i tintA = _mm_set1_epi32(tint.a + 1);
+
+    // NOTE: Channels are processed as planes of 4 pixels, one pixel per 32bit lane,
+    // multiplies with products below 2^16 use _mm_mullo_epi16() on zero extended lanes
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+
+        __m128i sr = _mm_and_si128(s, mask);
+        __m128i sg = _mm_and_si128(_mm_srli_epi32(s, 8), mask);
+        __m128i sb = _mm_and_si128(_mm_srli_epi32(s, 16), mask);
+        __m128i sa = _mm_srli_epi32(s, 24);
+
+        if (tinted)
+        {
+            sr = _mm_srli_epi32(_mm_mullo_epi16(sr, tintR), 8);
+            sg = _mm_srli_epi32(_mm_mullo_epi16(sg, tintG), 8);
+            sb = _mm_srli_epi32(_mm_mullo_epi16(sb, tintB), 8);
+            sa = _mm_srli_epi32(_mm_mullo_epi16(sa, tintA), 8);
+            s = _mm_or_si128(_mm_or_si128(sr, _mm_slli_epi32(sg, 8)), _mm_or_si128(_mm_slli_epi32(sb, 16), _mm_slli_epi32(sa, 24)));
+        }
+
+        // Fast path: Source pixels fully transparent or fully opaque
+        __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+        __m128i opaque = _mm_cmpeq_epi32(sa, full);
+        int transparentMask = _mm_movemask_epi8(transparent);
+        int opaqueMask = _mm_movemask_epi8(opaque);
+
+        if (transparentMask == 0xffff) continue;
+        if (opaqueMask == 0xffff)
+        {
+            _mm_storeu_si128((__m128i *)(dst + i*4), s);
+            continue;
+        }
+
+        __m128i dr = _mm_and_si128(d, mask);
+        __m128i dg = _mm_and_si128(_mm_srli_epi32(d, 8), mask);
+        __m128i db = _mm_and_si128(_mm_srli_epi32(d, 16), mask);
+        __m128i da = _mm_srli_epi32(d, 24);
+
+        __m128i alpha = _mm_add_epi32(sa, one);
+        __m128i inverse = _mm_sub_epi32(_mm_set1_epi32(256), alpha);
+
+        // outAlpha = (alpha*256 + da*(256 - alpha)) >> 8
+        __m128i outAlpha = _mm_add_epi32(alpha, _mm_srli_epi32(_mm_mullo_epi16(da, inverse), 8));
+        __m128i divisor = _mm_slli_epi32(outAlpha, 8);
+        __m128 divisorf = _mm_cvtepi32_ps(divisor);
+
+        __m128i result = _mm_slli_epi32(outAlpha, 24);
+        __m128i *channels[3] = { &sr, &sg, &sb };
+        __m128i dstChannels[3] = { dr, dg, db };
+
+        for (int c = 0; c < 3; c++)
+        {
+            // value = sc*alpha*256 + dc*da*(256 - alpha), 32bit product of 16bit values
+            __m128i dcda = _mm_mullo_epi16(dstChannels[c], da);
+            __m128i dstTerm = _mm_or_si128(_mm_mullo_epi16(dcda, inverse), _mm_slli_epi32(_mm_mulhi_epu16(dcda, inverse), 16));
+            __m128i value = _mm_add_epi32(_mm_slli_epi32(_mm_mullo_epi16(*channels[c], alpha), 8), dstTerm);
+
+            // Quotient estimate is off by 1 at most, fix it with remainder
+            __m128i quotient = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(value), divisorf));
+            __m128i remainder = _mm_sub_epi32(value, _mm_slli_epi32(_mm_mullo_epi16(quotient, outAlpha), 8));
+            quotient = _mm_add_epi32(quotient, _mm_cmplt_epi32(remainder, zero));
+            quotient = _mm_sub_epi32(quotient, _mm_cmpgt_epi32(remainder, _mm_sub_epi32(divisor, one)));
+
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(quotient, mask), 8*c));
+        }
+
+        // Select per pixel: transparent -> destination, opaque -> source, blended otherwise
+        result = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, result));
+        result = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, result));
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), result);
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    const bool tinted = ((tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255));
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const uint32x4_t tintR = vdupq_n_u32(tint.r + 1);
+    const uint32x4_t tintG = vdupq_n_u32(tint.g + 1);
+    const uint32x4_t tintB = vdupq_n_u32(tint.b + 1);
+    const uint32x4_t tintA = vdupq_n_u32(tint.a + 1);
+
+    // NOTE: Channels are processed as planes of 4 pixels, one pixel per 32bit lane
+    for (; (i + 4) <= count; i += 4)
+    {
+        uint32x4_t s = vreinterpretq_u32_u8(vld1q_u8(src + i*4));
+        uint32x4_t d = vreinterpretq_u32_u8(vld1q_u8(dst + i*4));
+
+        uint32x4_t sr = vandq_u32(s, mask);
+        uint32x4_t sg = vandq_u32(vshrq_n_u32(s, 8), mask);
+        uint32x4_t sb = vandq_u32(vshrq_n_u32(s, 16), mask);
+        uint32x4_t sa = vshrq_n_u32(s, 24);
+
+        if (tinted)
+        {
+            sr = vshrq_n_u32(vmulq_u32(sr, tintR), 8);
+            sg = vshrq_n_u32(vmulq_u32(sg, tintG), 8);
+            sb = vshrq_n_u32(vmulq_u32(sb, tintB), 8);
+            sa = vshrq_n_u32(vmulq_u32(sa, tintA), 8);
+            s = vorrq_u32(vorrq_u32(sr, vshlq_n_u32(sg, 8)), vorrq_u32(vshlq_n_u32(sb, 16), vshlq_n_u32(sa, 24)));
+        }
+
+        // Fast path: Source pixels fully transparent or fully opaque
+        uint32x4_t transparent = vceqq_u32(sa, vdupq_n_u32(0));
+        uint32x4_t opaque = vceqq_u32(sa, vdupq_n_u32(255));
+        uint32x2_t transparentAll = vand_u32(vget_low_u32(transparent), vget_high_u32(transparent));
+        uint32x2_t opaqueAll = vand_u32(vget_low_u32(opaque), vget_high_u32(opaque));
+
+        if ((vget_lane_u32(transparentAll, 0) & vget_lane_u32(transparentAll, 1)) != 0) continue;
+        if ((vget_lane_u32(opaqueAll, 0) & vget_lane_u32(opaqueAll, 1)) != 0)
+        {
+            vst1q_u8(dst + i*4, vreinterpretq_u8_u32(s));
+            continue;
+        }
+
+        uint32x4_t dr = vandq_u32(d, mask);
+        uint32x4_t dg = vandq_u32(vshrq_n_u32(d, 8), mask);
+        uint32x4_t db = vandq_u32(vshrq_n_u32(d, 16), mask);
+        uint32x4_t da = vshrq_n_u32(d, 24);
+
+        uint32x4_t alpha = vaddq_u32(sa, vdupq_n_u32(1));
+        uint32x4_t inverse = vsubq_u32(vdupq_n_u32(256), alpha);
+
+        // outAlpha = (alpha*256 + da*(256 - alpha)) >> 8
+        uint32x4_t outAlpha = vaddq_u32(alpha, vshrq_n_u32(vmulq_u32(da, inverse), 8));
+        int32x4_t divisor = vreinterpretq_s32_u32(vshlq_n_u32(outAlpha, 8));
+
+        // Reciprocal estimate refined with two Newton-Raphson steps
+        float32x4_t divisorf = vcvtq_f32_s32(divisor);
+        float32x4_t reciprocal = vrecpeq_f32(divisorf);
+        reciprocal = vmulq_f32(vrecpsq_f32(divisorf, reciprocal), reciprocal);
+        reciprocal = vmulq_f32(vrecpsq_f32(divisorf, reciprocal), reciprocal);
+
+        uint32x4_t result = vshlq_n_u32(outAlpha, 24);
+        uint32x4_t srcChannels[3] = { sr, sg, sb };
+        uint32x4_t dstChannels[3] = { dr, dg, db };
+
+        for (int c = 0; c < 3; c++)
+        {
+            // value = sc*alpha*256 + dc*da*(256 - alpha)
+            int32x4_t value = vreinterpretq_s32_u32(vaddq_u32(vshlq_n_u32(vmulq_u32(srcChannels[c], alpha), 8), vmulq_u32(vmulq_u32(dstChannels[c], da), inverse)));
+
+            // Quotient estimate is off by 1 at most, fix it with remainder
+            int32x4_t quotient = vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(value), reciprocal));
+            int32x4_t remainder = vsubq_s32(value, vmulq_s32(quotient, divisor));
+            quotient = vaddq_s32(quotient, vreinterpretq_s32_u32(vcltq_s32(remainder, vdupq_n_s32(0))));
+            quotient = vsubq_s32(quotient, vreinterpretq_s32_u32(vcgeq_s32(remainder, divisor)));
+
+            uint32x4_t channel = vandq_u32(vreinterpretq_u32_s32(quotient), mask);
+            if (c == 0) result = vorrq_u32(result, channel);
+            else if (c == 1) result = vorrq_u32(result, vshlq_n_u32(channel, 8));
+            else result = vorrq_u32(result, vshlq_n_u32(channel, 16));
+        }
+
+        // Select per pixel: transparent -> destination, opaque -> source, blended otherwise
+        result = vbslq_u32(transparent, d, result);
+        result = vbslq_u32(opaque, s, result);
+
+        vst1q_u8(dst + i*4, vreinterpretq_u8_u32(result));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        RaylibColor colSrc = { src[i*4], src[i*4 + 1], src[i*4 + 2], src[i*4 + 3] };
+        RaylibColor colDst = { dst[i*4], dst[i*4 + 1], dst[i*4 + 2], dst[i*4 + 3] };
+        RaylibColor blend = RaylibColorAlphaBlend(colDst, colSrc, tint);
+
+        dst[i*4] = blend.r;
+        dst[i*4 + 1] = blend.g;
+        dst[i*4 + 2] = blend.b;
+        dst[i*4 + 3] = blend.a;
+    }
+}
+
 #endif      // RAYLIB_SUPPORT_MODULE_RTEXTURES